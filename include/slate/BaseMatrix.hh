@@ -19,6 +19,8 @@
 #include "lapack/device.hh"
 
 #include <algorithm>
+#include <limits>
+#include <map>
 #include <memory>
 #include <set>
 #include <list>
@@ -608,10 +610,100 @@ protected:
     void tileBcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
                         int radix, int tag, Layout layout,
                         Target target);
+    //--------------------------------------------------------------------------
+    /// [internal] Receive of a tile posted by tileIbcastToSet,
+    /// or a root's send queued behind earlier receives.
+    /// tileIbcastWait completes it and forwards the tile to send_to ranks.
+    struct BcastRecv {
+        int64_t i, j;
+        int device;
+        int tag;
+        int64_t begin, end;  ///< segment's vectors; end = 0 for whole tile
+        std::vector<int> send_to;
+        MPI_Request request;
+        bool arrived;        ///< received, or root's own tile
+        bool done;           ///< arrived and forwarded
+        /// For a packed message (listIbcastPackedToSet): its buffer,
+        /// and the tiles unpacked from it on arrival.
+        std::vector<scalar_t>* pack = nullptr;
+        std::vector<ij_tuple> pack_tiles;
+        /// For a reader of the shared window (tileIbcastShared): the slot
+        /// index being received, until handled by tileIbcastSlot.
+        int64_t* slot = nullptr;
+        Layout layout = Layout::ColMajor;  ///< of packed or shared tiles
+    };
+
+    void tileIbcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
+                        int radix, int tag, Layout layout,
+                        std::vector<MPI_Request>& send_requests,
+                        Target target);
     void tileIbcastToSet(int64_t i, int64_t j, std::set<int> const& bcast_set,
                         int radix, int tag, Layout layout,
                         std::vector<MPI_Request>& send_requests,
+                        std::vector<BcastRecv>& recvs,
                         Target target);
+    void tileIbcastArrived(BcastRecv& recv);
+    void tileIbcastSlot(BcastRecv& recv);
+    void tileIbcastComplete(BcastRecv& recv,
+                            std::vector<MPI_Request>& send_requests);
+    void tileIbcastCompleteTile(int64_t i, int64_t j,
+                                std::vector<BcastRecv>& recvs,
+                                std::vector<MPI_Request>& send_requests);
+    void tileIbcastWait(std::vector<BcastRecv>& recvs,
+                        std::vector<MPI_Request>& send_requests);
+    int64_t bcastSegmentVectors(Tile<scalar_t> const& tile);
+    void bcastPattern(std::vector<int> const& ranks, int rank, int radix,
+                      std::list<int>& recv_from, std::list<int>& send_to);
+    bool tileIbcastShared(int64_t i, int64_t j, std::set<int> const& bcast_set,
+                          int tag, Layout layout, std::set<int>& tree_set,
+                          std::list<int64_t>& slot_msgs,
+                          std::vector<MPI_Request>& send_requests,
+                          std::vector<BcastRecv>& recvs);
+    void listIbcastPackedToSet(std::vector<ij_tuple> const& tiles,
+                               int root_rank, std::set<int> const& bcast_set,
+                               int radix, int tag, Layout layout,
+                               std::vector<scalar_t>& buffer,
+                               std::vector<MPI_Request>& send_requests,
+                               std::vector<BcastRecv>& recvs);
+
+    //--------------------------------------------------------------------------
+    /// [internal] Reduction of a tile in progress, posted by
+    /// tileIreduceFromSet and completed by tileIreduceWait.
+    struct ReduceTile {
+        int64_t i, j;
+        int device;        ///< where contributions are accumulated
+        int parent;        ///< MPI rank to send the sum to; -1 for root
+        int tag;
+        Layout layout;
+        int64_t pending;   ///< number of contributions not yet accumulated
+        int64_t send;      ///< index in send_requests of send to parent;
+                           ///< -1 if not yet sent
+    };
+
+    /// [internal] Receive of a contribution to a ReduceTile.
+    struct ReduceRecv {
+        int64_t tile;      ///< index of ReduceTile
+        int device;        ///< where buffer is
+        scalar_t* buffer;  ///< workspace buffer from the memory pool
+        MPI_Request request;
+        bool done;
+    };
+
+    int reduceDevice(int64_t i, int64_t j, Target target);
+    void tileIreduceFromSet(int64_t i, int64_t j, int root_rank,
+                            std::set<int>& reduce_set, int radix, int tag,
+                            Layout layout, Target target,
+                            std::vector<ReduceTile>& tiles,
+                            std::vector<ReduceRecv>& recvs,
+                            std::vector<MPI_Request>& send_requests);
+    void tileIreduceComplete(ReduceRecv& recv,
+                             std::vector<ReduceTile>& tiles,
+                             std::vector<MPI_Request>& send_requests);
+    void tileIreduceSend(ReduceTile& reduce_tile,
+                         std::vector<MPI_Request>& send_requests);
+    void tileIreduceWait(std::vector<ReduceTile>& tiles,
+                         std::vector<ReduceRecv>& recvs,
+                         std::vector<MPI_Request>& send_requests);
 
 public:
     // todo: should this be private?
@@ -662,6 +754,110 @@ public:
         storage_->clearWorkspace();
     }
 
+    /// Limits host memory used by local tiles allocated by SLATE to
+    /// budget bytes, evicting least recently used tiles to a backing file
+    /// in dir, so matrices larger than host memory can be processed.
+    /// Evicted tiles are read back on access. budget = 0 disables this.
+    /// Applies to the entire parent matrix.
+    /// @see MatrixStorage::setHostMemoryBudget
+    void setHostMemoryBudget( int64_t budget, std::string const& dir = "" )
+    {
+        storage_->setHostMemoryBudget( budget, dir );
+    }
+
+    /// @return host memory budget in bytes for local tiles; 0 if unlimited.
+    int64_t hostMemoryBudget() const
+    {
+        return storage_->hostMemoryBudget();
+    }
+
+    /// @return bytes of host memory used by resident local tiles
+    /// in out-of-core mode.
+    int64_t hostResidentBytes() const
+    {
+        return storage_->hostResidentBytes();
+    }
+
+    /// Sets the max tile size in bytes that listBcast packs with other
+    /// tiles going to the same set of ranks, sending one message per hop
+    /// instead of one per tile. This reduces latency for panels of small
+    /// tiles. Must be the same on all ranks. bytes = 0 disables packing.
+    /// Applies to the entire parent matrix.
+    void setBcastPackSize( int64_t bytes )
+    {
+        storage_->setBcastPackSize( bytes );
+    }
+
+    /// @return max tile size in bytes that listBcast packs; 0 if disabled.
+    int64_t bcastPackSize() const
+    {
+        return storage_->bcastPackSize();
+    }
+
+    /// Sets the segment size in bytes for broadcasting larger tiles.
+    /// Such tiles are sent in segments, and each rank forwards a segment as
+    /// soon as it arrives, pipelining the broadcast tree. This reduces
+    /// latency for large tiles, where bandwidth dominates.
+    /// Must be the same on all ranks. bytes = 0 disables segmenting.
+    /// Applies to the entire parent matrix.
+    void setBcastSegmentSize( int64_t bytes )
+    {
+        storage_->setBcastSegmentSize( bytes );
+    }
+
+    /// @return segment size in bytes for broadcasting tiles; 0 if disabled.
+    int64_t bcastSegmentSize() const
+    {
+        return storage_->bcastSegmentSize();
+    }
+
+    /// Enables or disables node-aware broadcast of tiles. When enabled,
+    /// broadcasts use a two-level tree: across nodes, then within each node
+    /// among ranks that share memory, so a tile crosses the network once per
+    /// node instead of once per rank.
+    /// Collective on mpiComm(). Applies to the entire parent matrix.
+    void setBcastNodeAware( bool enable )
+    {
+        if (enable)
+            storage_->setBcastNodeIds( internal::commNodeIds( mpi_comm_ ) );
+        else
+            storage_->setBcastNodeIds( std::vector<int>() );
+    }
+
+    /// @return whether broadcast of tiles is node-aware.
+    bool bcastNodeAware() const
+    {
+        return ! storage_->bcastNodeIds().empty();
+    }
+
+    /// Enables or disables broadcast of tiles through node-shared memory.
+    /// When enabled, listBcast copies a tile once into an MPI-3
+    /// shared-memory window, and ranks on the same node as the tile's owner
+    /// read it there directly instead of receiving their own copy.
+    /// Other ranks get the tile as usual. Receivers must only read the
+    /// broadcast tiles, as in gemm, trsm, and potrf, and not convert their
+    /// layout.
+    /// The window is allocated by the first call with num_tiles > 0,
+    /// which is collective on mpiComm(), and freed when the matrix is
+    /// destroyed, which is then collective too.
+    /// Applies to the entire parent matrix.
+    ///
+    /// @param[in] num_tiles
+    ///     Number of tiles each rank can have in the window at a time;
+    ///     further tiles are sent as usual. 0 disables it.
+    ///
+    void setBcastSharedMemory( int64_t num_tiles )
+    {
+        storage_->setBcastSharedMemory( num_tiles, mpi_comm_ );
+    }
+
+    /// @return number of tiles per rank in the node-shared window used by
+    /// listBcast; 0 if disabled.
+    int64_t bcastSharedMemory() const
+    {
+        return storage_->bcastSharedMemory();
+    }
+
     /// Allocates batch arrays and BLAS++ queues for all devices.
     /// Matrix classes override this with versions that can also allocate based
     /// on the number of local tiles.
@@ -1385,10 +1581,16 @@ Tile<scalar_t> BaseMatrix<scalar_t>::operator()(
     if (op_ != Op::NoTrans) {
         std::swap( i, j );
     }
+    // In out-of-core mode, load and pin the host instance while in use.
+    std::shared_ptr<void> pin;
+    if (device == HostNum)
+        storage_->tileLoad( { ioffset_+i, joffset_+j }, &pin );
     auto* tile = storage_->at( { ioffset_+i, joffset_+j, device } );
-    return tile->slice( op_, (i == 0 ? row0_offset_ : 0), (j == 0 ? col0_offset_ : 0),
-                        tileMbInternal( i ), tileNbInternal( j ),
-                        (i == j ? uplo_ : Uplo::General) );
+    auto T = tile->slice( op_, (i == 0 ? row0_offset_ : 0), (j == 0 ? col0_offset_ : 0),
+                          tileMbInternal( i ), tileNbInternal( j ),
+                          (i == j ? uplo_ : Uplo::General) );
+    T.pin_ = std::move( pin );
+    return T;
 }
 
 //------------------------------------------------------------------------------
@@ -1973,12 +2175,17 @@ void BaseMatrix<scalar_t>::tileBcast(
 /// bcast_list.
 /// Data received must be in 'layout' (ColMajor/RowMajor) major.
 ///
+/// If bcastPackSize() > 0, tiles of at most that many bytes that have the
+/// same root and destination ranks are packed into one host buffer and sent
+/// as one message per hop, instead of one message per tile.
+///
 /// @tparam target
 ///     Destination to target; either Host (default) or Device.
 ///
 /// @param[in] bcast_list
 ///     List of submatrices defining the MPI ranks to send to.
 ///     Usually it is the portion of the matrix to be updated by tile {i, j}.
+///     Must be the same on all ranks.
 ///
 /// @param[in] layout
 ///     Indicates the Layout (ColMajor/RowMajor) of the broadcasted data.
@@ -2018,32 +2225,114 @@ void BaseMatrix<scalar_t>::listBcast(
 
     std::vector<MPI_Request> send_requests;
 
-    for (auto bcast : bcast_list) {
-
+    // Find the set of participating ranks for each tile.
+    int64_t num_bcasts = bcast_list.size();
+    std::vector< std::set<int> > bcast_sets( num_bcasts );
+    int64_t index = 0;
+    for (auto& bcast : bcast_list) {
         auto i = std::get<0>(bcast);
         auto j = std::get<1>(bcast);
-        auto submatrices_list = std::get<2>(bcast);
+        bcast_sets[ index ].insert( tileRank( i, j ) ); // Insert root.
+        for (auto& submatrix : std::get<2>(bcast))      // Insert destinations.
+            submatrix.getRanks( &bcast_sets[ index ] );
+        ++index;
+    }
+
+    // Receives, and the root's sends queued behind them, in the order
+    // posted; see tileIbcastToSet.
+    std::vector<BcastRecv> recvs;
+
+    // Pack small tiles having the same root and destinations into one
+    // message per hop. Since all ranks have the same bcast_list,
+    // they all find the same groups, in the same order.
+    std::vector<bool> is_packed( num_bcasts, false );
+    std::list< std::vector<scalar_t> > pack_buffers;
+    int64_t pack_size = storage_->bcastPackSize();
+    if (pack_size > 0 && mpi_size > 1) {
+        using PackKey = std::pair< int, std::set<int> >;
+        std::map< PackKey, std::vector<int64_t> > groups;
+        index = 0;
+        for (auto& bcast : bcast_list) {
+            auto i = std::get<0>(bcast);
+            auto j = std::get<1>(bcast);
+            auto& bcast_set = bcast_sets[ index ];
+            int64_t bytes = sizeof(scalar_t) * tileMb( i ) * tileNb( j );
+            if (bytes <= pack_size && bcast_set.size() > 1
+                && bcast_set.find( mpi_rank_ ) != bcast_set.end()) {
+                groups[ { tileRank( i, j ), bcast_set } ].push_back( index );
+            }
+            ++index;
+        }
 
-        // Find the set of participating ranks.
-        std::set<int> bcast_set;
-        bcast_set.insert(tileRank(i, j));       // Insert root.
-        for (auto submatrix : submatrices_list) // Insert destinations.
-            submatrix.getRanks(&bcast_set);
+        std::vector<ij_tuple> tiles;
+        for (auto& group : groups) {
+            auto& indices = group.second;
+            // A single tile is sent as usual.
+            if (indices.size() < 2)
+                continue;
+
+            tiles.clear();
+            for (int64_t k : indices) {
+                auto& bcast = bcast_list[ k ];
+                tiles.push_back( { std::get<0>(bcast), std::get<1>(bcast) } );
+                is_packed[ k ] = true;
+            }
+            pack_buffers.emplace_back();
+            listIbcastPackedToSet(
+                tiles, group.first.first, group.first.second, 2, tag, layout,
+                pack_buffers.back(), send_requests, recvs );
+        }
+    }
 
-        // If this rank is in the set.
-        if (bcast_set.find(mpi_rank_) != bcast_set.end()) {
+    // Post receives and the root's sends for all tiles, then forward tiles
+    // as they arrive, so one slow message doesn't delay the others.
+    SharedWindow* window = mpi_size > 1 ? storage_->bcastWindow() : nullptr;
+    std::set<int> shared_set;
+    std::list<int64_t> slot_msgs;  // slot indices being sent or received
+    index = 0;
+    for (auto& bcast : bcast_list) {
+
+        auto i = std::get<0>(bcast);
+        auto j = std::get<1>(bcast);
+        auto& bcast_set = bcast_sets[ index ];
+        bool packed = is_packed[ index ];
+        ++index;
+
+        // If this rank is in the set and the tile wasn't already packed.
+        if (! packed && bcast_set.find(mpi_rank_) != bcast_set.end()) {
             // If receiving the tile.
             int device = HostNum;
             if (target == Target::Devices && gpu_aware_mpi()) {
                 device = tileDevice( i, j );
             }
+
+            // Ranks on the owner's node read host tiles from the shared
+            // window; the rest of the set gets them as usual.
+            std::set<int> const* tree_set = &bcast_set;
+            if (window != nullptr && device == HostNum) {
+                if (tileIbcastShared( i, j, bcast_set, tag, layout,
+                                      shared_set, slot_msgs, send_requests,
+                                      recvs ))
+                    continue;
+                tree_set = &shared_set;
+            }
+
             storage_->tilePrepareToReceive( globalIndex( i, j ), device, layout_ );
 
             // Send across MPI ranks.
             // Previous used MPI bcast: tileBcastToSet(i, j, bcast_set);
             // Currently uses 2D hypercube p2p send.
-            tileIbcastToSet(i, j, bcast_set, 2, tag, layout, send_requests, target);
+            tileIbcastToSet(i, j, *tree_set, 2, tag, layout, send_requests,
+                            recvs, target);
         }
+    }
+    tileIbcastWait( recvs, send_requests );
+
+    for (auto bcast : bcast_list) {
+
+        auto i = std::get<0>(bcast);
+        auto j = std::get<1>(bcast);
+        auto submatrices_list = std::get<2>(bcast);
 
         // Copy to devices.
         // TODO: should this be inside above if-then?
@@ -2213,21 +2502,54 @@ void BaseMatrix<scalar_t>::listBcastMT(
 }
 
 //------------------------------------------------------------------------------
+/// Sum tiles {i, j} from all MPI ranks in the list of submatrices
+/// reduce_list into the rank of the destination submatrix.
+/// Receives for all tiles are posted first, and contributions are
+/// accumulated in the order they arrive, so ranks don't wait on each tile
+/// in turn. Contributions are received into buffers from the matrix's
+/// memory pool. For target = Devices, tiles are accumulated on the device
+/// where they reside.
+/// Data sent and received are in 'layout' (ColMajor/RowMajor) major.
+///
+/// @tparam target
+///     Where to accumulate; either Host (default) or Devices.
+///
+/// @param[in] reduce_list
+///     List of tiles {i, j}, each with a destination submatrix whose
+///     rank receives the sum, and a list of submatrices defining the MPI
+///     ranks that contribute. Must be the same on all ranks.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the reduced data.
+///
+/// @param[in] tag
+///     MPI tag, default 0.
 ///
 template <typename scalar_t>
 template <Target target>
 void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, int tag)
 {
-    for (auto reduce : reduce_list) {
+    std::vector<ReduceTile> tiles;
+    std::vector<ReduceRecv> recvs;
+    std::vector<MPI_Request> send_requests;
+
+    int64_t num_reduces = reduce_list.size();
+    std::vector< std::set<int> > reduce_sets( num_reduces );
+    std::vector<int> root_ranks( num_reduces );
+
+    int64_t index = 0;
+    for (auto& reduce : reduce_list) {
 
         auto i = std::get<0>(reduce);
         auto j = std::get<1>(reduce);
-        auto submatrices_dest = std::get<2>(reduce);
-        auto submatrices_list = std::get<3>(reduce);
+        auto& submatrices_dest = std::get<2>(reduce);
+        auto& submatrices_list = std::get<3>(reduce);
 
         // Find the set of participating ranks.
-        std::set<int> reduce_set;
+        std::set<int>& reduce_set = reduce_sets[ index ];
         int root_rank = submatrices_dest.tileRank(0, 0);
+        root_ranks[ index ] = root_rank;
+        ++index;
         for (auto submatrix : submatrices_list) // Insert sources.
             submatrix.getRanks(&reduce_set);
 
@@ -2237,7 +2559,26 @@ void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, in
 
             // Reduce across MPI ranks.
             // Uses 2D hypercube p2p send.
-            tileReduceFromSet(i, j, root_rank, reduce_set, 2, tag, layout);
+            tileIreduceFromSet(i, j, root_rank, reduce_set, 2, tag, layout,
+                               target, tiles, recvs, send_requests);
+        }
+    }
+    tileIreduceWait(tiles, recvs, send_requests);
+    slate_mpi_call(
+        MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE));
+
+    index = 0;
+    for (auto& reduce : reduce_list) {
+
+        auto i = std::get<0>(reduce);
+        auto j = std::get<1>(reduce);
+        auto& reduce_set = reduce_sets[ index ];
+        int root_rank = root_ranks[ index ];
+        ++index;
+
+        // If this rank is in the set.
+        if (root_rank == mpi_rank_
+            || reduce_set.find(mpi_rank_) != reduce_set.end()) {
 
             // If not the tile owner.
             if (! tileIsLocal(i, j)) {
@@ -2248,7 +2589,7 @@ void BaseMatrix<scalar_t>::listReduce(ReduceList& reduce_list, Layout layout, in
                     tileErase( i, j, HostNum );
             }
             else if (root_rank == mpi_rank_ && reduce_set.size() > 1) {
-                tileModified( i, j );
+                tileModified( i, j, reduceDevice( i, j, target ) );
             }
         }
     }
@@ -2300,6 +2641,7 @@ void BaseMatrix<scalar_t>::tileBcastToSet(
 /// This function implements a custom pattern using sends and receives.
 /// Data received must be in 'layout' (ColMajor/RowMajor) major.
 /// Nonblocking sends are used, with requests appended to the provided vector.
+/// A receive, if any, is completed before returning.
 ///
 /// @param[in] i
 ///     Tile's block row index. 0 <= i < mt.
@@ -2328,6 +2670,42 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
     int radix, int tag, Layout layout,
     std::vector<MPI_Request>& send_requests,
     Target target)
+{
+    std::vector<BcastRecv> recvs;
+    tileIbcastToSet(i, j, bcast_set, radix, tag, layout, send_requests,
+                    recvs, target);
+    tileIbcastWait(recvs, send_requests);
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Broadcast tile {i, j} to all MPI ranks in the bcast_set,
+/// without blocking on the receive.
+/// The root posts nonblocking sends, with requests appended to send_requests.
+/// Other ranks post a nonblocking receive, appended to recvs; the tile is
+/// forwarded when tileIbcastWait completes the receive, and is not valid
+/// until then.
+/// If recvs already has a pending receive of tile {i, j}, that one is
+/// completed first, since both use the same buffer.
+///
+/// Messages between two ranks all have the same tag, so they match in the
+/// order sent. Hence tiles are sent to each child in the order that the
+/// child posts its receives, i.e., the order of tileIbcastToSet calls:
+/// forwards are in order of recvs, and if receives are pending, the root
+/// queues its sends in recvs behind them.
+///
+/// @param[in,out] recvs
+///     Vector where the receive for this bcast is appended.
+///
+/// @see tileIbcastToSet for the other parameters.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastToSet(
+    int64_t i, int64_t j, std::set<int> const& bcast_set,
+    int radix, int tag, Layout layout,
+    std::vector<MPI_Request>& send_requests,
+    std::vector<BcastRecv>& recvs,
+    Target target)
 {
     // Quit if only root in the broadcast set.
     if (bcast_set.size() == 1)
@@ -2355,39 +2733,602 @@ void BaseMatrix<scalar_t>::tileIbcastToSet(
     // Get the send/recv pattern.
     std::list<int> recv_from;
     std::list<int> send_to;
-    internal::cubeBcastPattern(new_vec.size(), new_rank, radix,
-                               recv_from, send_to);
+    bcastPattern(new_vec, new_rank, radix, recv_from, send_to);
 
     int device = HostNum;
     if (target == Target::Devices && gpu_aware_mpi()) {
         device = tileDevice( i, j );
     }
 
+    // Whether sends must wait for earlier receives to be forwarded.
+    bool pending = false;
+    for (auto& recv : recvs) {
+        pending = pending || ! recv.done;
+    }
+
+    BcastRecv recv;
+    recv.i = i;
+    recv.j = j;
+    recv.device = device;
+    recv.tag = tag;
+    for (int dst : send_to)
+        recv.send_to.push_back( new_vec[ dst ] );
+    recv.request = MPI_REQUEST_NULL;
+    recv.arrived = false;
+    recv.done = false;
+
     // Receive.
     if (! recv_from.empty()) {
-        // read tile
-        tileAcquire(i, j, device, layout);
+        // Complete any pending receive into the same tile.
+        tileIbcastCompleteTile( i, j, recvs, send_requests );
 
-        at(i, j, device).recv(new_vec[recv_from.front()], mpi_comm_, layout, tag);
-        tileModified(i, j, device, true);
+        tileAcquire(i, j, device, layout);
+        auto Aij = at(i, j, device);
+        int64_t seg_vectors = bcastSegmentVectors( Aij );
+        if (seg_vectors == 0) {
+            recv.begin = 0;
+            recv.end = 0;
+            Aij.irecv(new_vec[recv_from.front()], mpi_comm_, layout,
+                      tag, &recv.request);
+            recvs.push_back( std::move( recv ) );
+        }
+        else {
+            // Post a receive per segment; each is forwarded on arrival.
+            int64_t nvec = Aij.numVectors();
+            for (int64_t begin = 0; begin < nvec; begin += seg_vectors) {
+                recv.begin = begin;
+                recv.end = std::min( begin + seg_vectors, nvec );
+                Aij.irecvVectors(recv.begin, recv.end,
+                                 new_vec[recv_from.front()], mpi_comm_,
+                                 tag, &recv.request);
+                recvs.push_back( recv );
+            }
+        }
     }
-
-    if (! send_to.empty()) {
+    else if (! send_to.empty()) {
         // read tile
         tileGetForReading(i, j, device, LayoutConvert(layout));
 
         auto Aij = at(i, j, device);
+        int64_t seg_vectors = bcastSegmentVectors( Aij );
+        if (pending) {
+            // Queue the tile, or its segments, to send in order.
+            recv.arrived = true;
+            int64_t nvec = Aij.numVectors();
+            int64_t step = seg_vectors == 0 ? nvec : seg_vectors;
+            for (int64_t begin = 0; begin < nvec; begin += step) {
+                recv.begin = begin;
+                recv.end = seg_vectors == 0 ? 0 : std::min( begin + step, nvec );
+                recvs.push_back( recv );
+            }
+        }
+        else if (seg_vectors == 0) {
+            // Forward using multiple mpi_isend() calls
+            for (int dst : send_to) {
+                MPI_Request request;
+                Aij.isend(new_vec[dst], mpi_comm_, tag, &request);
+                send_requests.push_back(request);
+            }
+        }
+        else {
+            // Send segments in order, so every child can start forwarding
+            // the first segment while later ones are in flight.
+            int64_t nvec = Aij.numVectors();
+            for (int64_t begin = 0; begin < nvec; begin += seg_vectors) {
+                int64_t end = std::min( begin + seg_vectors, nvec );
+                for (int dst : send_to) {
+                    MPI_Request request;
+                    Aij.isendVectors(begin, end, new_vec[dst], mpi_comm_,
+                                     tag, &request);
+                    send_requests.push_back(request);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Returns the number of vectors (columns if ColMajor, rows if RowMajor)
+/// per segment for broadcasting tile, or 0 to send it whole.
+/// Tiles larger than bcastSegmentSize() bytes are segmented.
+///
+template <typename scalar_t>
+int64_t BaseMatrix<scalar_t>::bcastSegmentVectors(Tile<scalar_t> const& tile)
+{
+    int64_t seg_size = storage_->bcastSegmentSize();
+    int64_t nvec = tile.numVectors();
+    if (seg_size <= 0 || int64_t( tile.bytes() ) <= seg_size || nvec < 2)
+        return 0;
+
+    int64_t vec_bytes = tile.bytes() / nvec;
+    return std::max( seg_size / vec_bytes, int64_t( 1 ) );
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Gets the broadcast pattern for the local process: a hypercube over ranks,
+/// or if bcastNodeAware(), a hypercube across nodes and then within nodes.
+///
+/// @param[in] ranks
+///     MPI ranks participating in the broadcast, with the root first.
+///
+/// @param[in] rank
+///     Index of the local process in ranks.
+///
+/// @param[in] radix
+///     Radix of the communication pattern.
+///
+/// @param[out] recv_from
+///     Index in ranks to receive from; empty for the root.
+///
+/// @param[out] send_to
+///     Indices in ranks to forward to.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::bcastPattern(
+    std::vector<int> const& ranks, int rank, int radix,
+    std::list<int>& recv_from, std::list<int>& send_to)
+{
+    auto& node_ids = storage_->bcastNodeIds();
+    if (node_ids.empty()) {
+        internal::cubeBcastPattern(ranks.size(), rank, radix,
+                                   recv_from, send_to);
+    }
+    else {
+        internal::nodeBcastPattern(ranks, node_ids, rank, radix,
+                                   recv_from, send_to);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Marks a receive posted by tileIbcastToSet, listIbcastPackedToSet, or
+/// tileIbcastShared as arrived: marks the tile modified, or unpacks a packed
+/// message into its tiles on the host. A slot index is left to
+/// tileIbcastSlot.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastArrived(BcastRecv& recv)
+{
+    recv.arrived = true;
+    if (recv.slot != nullptr) {
+        // Handled in order by tileIbcastSlot.
+        return;
+    }
+    if (recv.pack == nullptr) {
+        tileModified( recv.i, recv.j, recv.device, true );
+        return;
+    }
+
+    int64_t offset = 0;
+    for (auto ij : recv.pack_tiles) {
+        int64_t i = std::get<0>( ij );
+        int64_t j = std::get<1>( ij );
+        storage_->tilePrepareToReceive( globalIndex( i, j ), HostNum, layout_ );
+        tileAcquire( i, j, HostNum, recv.layout );
+        auto Aij = at( i, j );
+        Aij.unpack( &(*recv.pack)[ offset ], recv.layout );
+        tileModified( i, j, HostNum, true );
+        offset += Aij.size();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Waits for a receive posted by tileIbcastToSet, if not already arrived,
+/// marks the tile modified, and forwards it using nonblocking sends,
+/// with requests appended to send_requests.
+/// To keep messages in order, the caller must complete earlier entries
+/// of recvs first.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastComplete(
+    BcastRecv& recv, std::vector<MPI_Request>& send_requests)
+{
+    if (recv.done)
+        return;
+
+    if (! recv.arrived) {
+        slate_mpi_call( MPI_Wait( &recv.request, MPI_STATUS_IGNORE ) );
+        tileIbcastArrived( recv );
+    }
+    if (recv.slot != nullptr) {
+        tileIbcastSlot( recv );
+        if (! recv.arrived) {
+            // No slot was free; receive the tile itself.
+            slate_mpi_call( MPI_Wait( &recv.request, MPI_STATUS_IGNORE ) );
+            tileIbcastArrived( recv );
+        }
+    }
+    recv.done = true;
+
+    if (recv.pack != nullptr) {
+        auto& buffer = *recv.pack;
+        for (int dst : recv.send_to) {
+            MPI_Request request;
+            slate_mpi_call(
+                MPI_Isend( buffer.data(), buffer.size(),
+                           mpi_type<scalar_t>::value,
+                           dst, recv.tag, mpi_comm_, &request ) );
+            send_requests.push_back( request );
+        }
+    }
+    else if (! recv.send_to.empty()) {
+        auto Aij = at( recv.i, recv.j, recv.device );
         // Forward using multiple mpi_isend() calls
-        for (int dst : send_to) {
+        for (int dst : recv.send_to) {
+            MPI_Request request;
+            if (recv.end == 0)
+                Aij.isend( dst, mpi_comm_, recv.tag, &request );
+            else
+                Aij.isendVectors( recv.begin, recv.end, dst, mpi_comm_,
+                                  recv.tag, &request );
+            send_requests.push_back( request );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Completes, in order, entries of recvs up to the last pending one
+/// for tile {i, j}, if any, e.g., before reusing the tile's buffer.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastCompleteTile(
+    int64_t i, int64_t j,
+    std::vector<BcastRecv>& recvs, std::vector<MPI_Request>& send_requests)
+{
+    int64_t last = -1;
+    for (size_t k = 0; k < recvs.size(); ++k) {
+        auto& recv = recvs[ k ];
+        if (recv.done)
+            continue;
+        if (recv.pack == nullptr) {
+            if (recv.i == i && recv.j == j)
+                last = k;
+        }
+        else if (std::find( recv.pack_tiles.begin(), recv.pack_tiles.end(),
+                            ij_tuple( i, j ) ) != recv.pack_tiles.end()) {
+            last = k;
+        }
+    }
+    for (int64_t k = 0; k <= last; ++k) {
+        tileIbcastComplete( recvs[ k ], send_requests );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Completes all receives posted by tileIbcastToSet, in the order they
+/// arrive, forwarding tiles as soon as they and all earlier tiles
+/// are received, so each child gets tiles in the order it posted receives.
+/// Requests for forwarded tiles are appended to send_requests.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastWait(
+    std::vector<BcastRecv>& recvs, std::vector<MPI_Request>& send_requests)
+{
+    std::vector<MPI_Request> requests;
+    requests.reserve( recvs.size() );
+    for (auto& recv : recvs) {
+        requests.push_back( recv.arrived ? MPI_REQUEST_NULL : recv.request );
+    }
+
+    size_t next = 0;  // first entry not yet forwarded
+    while (true) {
+        while (next < recvs.size() && recvs[ next ].arrived) {
+            auto& recv = recvs[ next ];
+            if (recv.slot != nullptr) {
+                tileIbcastSlot( recv );
+                if (! recv.arrived) {
+                    // No slot was free; wait for the tile itself.
+                    requests[ next ] = recv.request;
+                    break;
+                }
+            }
+            tileIbcastComplete( recv, send_requests );
+            ++next;
+        }
+        if (next == recvs.size())
+            break;
+
+        int index;
+        slate_mpi_call(
+            MPI_Waitany( requests.size(), requests.data(), &index,
+                         MPI_STATUS_IGNORE ) );
+        assert( index != MPI_UNDEFINED );
+
+        // Receive is complete, so tileIbcastComplete won't wait.
+        auto& recv = recvs[ index ];
+        recv.request = MPI_REQUEST_NULL;
+        tileIbcastArrived( recv );
+    }
+    recvs.clear();
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Broadcast tile {i, j} on the host to ranks in bcast_set on the same node
+/// as its owner, through the shared window of setBcastSharedMemory.
+/// The owner copies the tile into a slot of its segment, and sends each such
+/// rank the slot index, which then wraps the slot as its host tile.
+/// If no slot is free, the owner sends -1 and then the tile itself.
+/// This should be called by all (and only) ranks that are in bcast_set.
+///
+/// Slot indices and tiles sent instead are on the window's own
+/// communicators, so they can't match listBcast's other messages.
+/// Ranks on the owner's node post a nonblocking receive of the slot index,
+/// appended to recvs; tileIbcastWait handles slot indices in order of recvs
+/// with tileIbcastSlot, so tiles sent instead of a slot are also received
+/// in the order the owner sent them.
+///
+/// @param[out] tree_set
+///     Ranks in bcast_set that still must get the tile, including the root,
+///     using tileIbcastToSet.
+///
+/// @param[in,out] slot_msgs
+///     List where slot indices sent or received are stored. Must not be
+///     freed until recvs and send_requests are completed.
+///
+/// @return true if the local process got the tile through the window,
+///     or is getting it with a receive appended to recvs;
+///     false if it is in tree_set.
+///
+/// @see tileIbcastToSet for the other parameters.
+///
+template <typename scalar_t>
+bool BaseMatrix<scalar_t>::tileIbcastShared(
+    int64_t i, int64_t j, std::set<int> const& bcast_set,
+    int tag, Layout layout, std::set<int>& tree_set,
+    std::list<int64_t>& slot_msgs,
+    std::vector<MPI_Request>& send_requests,
+    std::vector<BcastRecv>& recvs)
+{
+    SharedWindow* window = storage_->bcastWindow();
+    int root = tileRank( i, j );
+    int root_node = window->nodeId( root );
+
+    std::vector<int> node_recvs;
+    tree_set.clear();
+    for (int rank : bcast_set) {
+        if (rank != root && window->nodeId( rank ) == root_node)
+            node_recvs.push_back( rank );
+        else
+            tree_set.insert( rank );
+    }
+    int64_t bytes = sizeof(scalar_t) * tileMb( i ) * tileNb( j );
+    if (node_recvs.empty() || size_t( bytes ) > window->slotSize()) {
+        tree_set = bcast_set;
+        return false;
+    }
+
+    if (mpi_rank_ == root) {
+        int64_t slot = window->acquire( node_recvs.size() );
+        tileGetForReading( i, j, HostNum, LayoutConvert( layout ) );
+        auto Aij = at( i, j );
+        if (slot >= 0) {
+            Aij.pack( (scalar_t*) window->data( root, slot ) );
+            window->sync();
+        }
+        slot_msgs.push_back( slot );
+        for (int dst : node_recvs) {
             MPI_Request request;
-            Aij.isend(new_vec[dst], mpi_comm_, tag, &request);
-            send_requests.push_back(request);
+            slate_mpi_call(
+                MPI_Isend( &slot_msgs.back(), 1, MPI_INT64_T, dst, tag,
+                           window->slotComm(), &request ) );
+            send_requests.push_back( request );
+            if (slot < 0) {
+                Aij.isend( dst, window->tileComm(), tag, &request );
+                send_requests.push_back( request );
+            }
         }
+        return false;
+    }
+    else if (tree_set.find( mpi_rank_ ) == tree_set.end()) {
+        // Complete any pending receive into the same tile.
+        tileIbcastCompleteTile( i, j, recvs, send_requests );
+
+        BcastRecv recv;
+        recv.i = i;
+        recv.j = j;
+        recv.device = HostNum;
+        recv.tag = tag;
+        recv.begin = 0;
+        recv.end = 0;
+        recv.arrived = false;
+        recv.done = false;
+        slot_msgs.push_back( -1 );
+        recv.slot = &slot_msgs.back();
+        recv.layout = layout;
+        slate_mpi_call(
+            MPI_Irecv( recv.slot, 1, MPI_INT64_T, root, tag,
+                       window->slotComm(), &recv.request ) );
+        recvs.push_back( std::move( recv ) );
+        return true;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Handles a slot index received by tileIbcastShared: wraps the slot as the
+/// host tile. If no slot was free, instead posts a receive of the tile
+/// itself, and marks recv as not arrived.
+/// Must be called in order of recvs, so receives of tiles match the order
+/// the owner sent them.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIbcastSlot(BcastRecv& recv)
+{
+    SharedWindow* window = storage_->bcastWindow();
+    int64_t i = recv.i;
+    int64_t j = recv.j;
+    int root = tileRank( i, j );
+    int64_t slot = *recv.slot;
+    recv.slot = nullptr;
+
+    if (slot >= 0) {
+        window->sync();
+        auto data = (scalar_t*) window->data( root, slot );
+        if (storage_->tilePrepareToReceiveShared(
+                globalIndex( i, j ), data, recv.layout )) {
+            tileModified( i, j, HostNum, true );
+        }
+        else {
+            // The tile is already here. If it is itself in the window,
+            // it is the same tile sent again (see listBcast), so keep it.
+            tileAcquire( i, j, HostNum, recv.layout );
+            auto Aij = at( i, j, HostNum );
+            if (! window->contains( Aij.data() )) {
+                Aij.unpack( data, recv.layout );
+                tileModified( i, j, HostNum, true );
+            }
+            window->release( data );
+        }
+    }
+    else {
+        storage_->tilePrepareToReceive( globalIndex( i, j ), HostNum,
+                                        layout_ );
+        tileAcquire( i, j, HostNum, recv.layout );
+        recv.arrived = false;
+        at( i, j ).irecv( root, window->tileComm(), recv.layout, recv.tag,
+                          &recv.request );
     }
 }
 
 //------------------------------------------------------------------------------
 /// [internal]
+/// Broadcast a group of tiles, packed into one message, to all MPI ranks
+/// in the bcast_set. All tiles must have the same root rank.
+/// This should be called by all (and only) ranks that are in bcast_set,
+/// as either the root sender or a receiver.
+/// Tiles are received on the host.
+/// As in tileIbcastToSet, the root posts nonblocking sends, or queues them
+/// in recvs behind pending receives, and other ranks post a nonblocking
+/// receive, appended to recvs; tileIbcastWait then unpacks the tiles and
+/// forwards the message, in order with the other entries of recvs.
+///
+/// @param[in] tiles
+///     Tiles {i, j} to broadcast. Must be in the same order on all ranks.
+///
+/// @param[in] root_rank
+///     MPI rank owning all the tiles.
+///
+/// @param[in] bcast_set
+///     Set of MPI ranks to broadcast to, including the root.
+///
+/// @param[in] radix
+///     Radix of the communication pattern.
+///
+/// @param[in] tag
+///     MPI tag.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the received data.
+///
+/// @param[out] buffer
+///     Buffer for the packed tiles. Must not be freed until recvs and
+///     send_requests are completed.
+///
+/// @param[in,out] send_requests
+///     Vector where requests for this bcast are appended.
+///
+/// @param[in,out] recvs
+///     Vector where the receive for this bcast is appended.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::listIbcastPackedToSet(
+    std::vector<ij_tuple> const& tiles,
+    int root_rank, std::set<int> const& bcast_set,
+    int radix, int tag, Layout layout,
+    std::vector<scalar_t>& buffer,
+    std::vector<MPI_Request>& send_requests,
+    std::vector<BcastRecv>& recvs)
+{
+    // Quit if only root in the broadcast set.
+    if (bcast_set.size() == 1)
+        return;
+
+    // Shift root to position zero.
+    std::vector<int> bcast_vec(bcast_set.begin(), bcast_set.end());
+    auto root_iter = std::find(bcast_vec.begin(), bcast_vec.end(), root_rank);
+    std::vector<int> new_vec(root_iter, bcast_vec.end());
+    new_vec.insert(new_vec.end(), bcast_vec.begin(), root_iter);
+
+    // Find the new rank.
+    auto rank_iter = std::find(new_vec.begin(), new_vec.end(), mpi_rank_);
+    int new_rank = std::distance(new_vec.begin(), rank_iter);
+
+    // Get the send/recv pattern.
+    std::list<int> recv_from;
+    std::list<int> send_to;
+    bcastPattern(new_vec, new_rank, radix, recv_from, send_to);
+
+    int64_t count = 0;
+    for (auto ij : tiles) {
+        count += tileMb( std::get<0>( ij ) ) * tileNb( std::get<1>( ij ) );
+    }
+    slate_assert(count <= std::numeric_limits<int>::max());
+    buffer.resize( count );
+
+    // Whether sends must wait for earlier receives to be forwarded.
+    bool pending = false;
+    for (auto& recv : recvs) {
+        pending = pending || ! recv.done;
+    }
+
+    BcastRecv recv;
+    recv.i = -1;
+    recv.j = -1;
+    recv.device = HostNum;
+    recv.tag = tag;
+    recv.begin = 0;
+    recv.end = 0;
+    for (int dst : send_to)
+        recv.send_to.push_back( new_vec[ dst ] );
+    recv.request = MPI_REQUEST_NULL;
+    recv.arrived = false;
+    recv.done = false;
+    recv.pack = &buffer;
+    recv.pack_tiles = tiles;
+    recv.layout = layout;
+
+    if (recv_from.empty()) {
+        // Root packs its tiles.
+        int64_t offset = 0;
+        for (auto ij : tiles) {
+            int64_t i = std::get<0>( ij );
+            int64_t j = std::get<1>( ij );
+            tileGetForReading( i, j, LayoutConvert( layout ) );
+            auto Aij = at( i, j );
+            Aij.pack( &buffer[ offset ] );
+            offset += Aij.size();
+        }
+
+        recv.arrived = true;
+        if (pending) {
+            // Queue the message to send in order.
+            recvs.push_back( std::move( recv ) );
+        }
+        else {
+            // Send now; as it has arrived, it isn't unpacked.
+            tileIbcastComplete( recv, send_requests );
+        }
+    }
+    else {
+        slate_mpi_call(
+            MPI_Irecv( buffer.data(), count, mpi_type<scalar_t>::value,
+                       new_vec[ recv_from.front() ], tag, mpi_comm_,
+                       &recv.request ) );
+        recvs.push_back( std::move( recv ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Sum tile {i, j} from all MPI ranks in reduce_set into root_rank,
+/// accumulating on the host.
 /// WARNING: Sent and received tiles are converted to 'layout' major.
 ///
 template <typename scalar_t>
@@ -2395,8 +3336,66 @@ void BaseMatrix<scalar_t>::tileReduceFromSet(
     int64_t i, int64_t j, int root_rank, std::set<int>& reduce_set,
     int radix, int tag, Layout layout)
 {
-    const scalar_t one = 1.0;
+    std::vector<ReduceTile> tiles;
+    std::vector<ReduceRecv> recvs;
+    std::vector<MPI_Request> send_requests;
+
+    tileIreduceFromSet(i, j, root_rank, reduce_set, radix, tag, layout,
+                       Target::Host, tiles, recvs, send_requests);
+    tileIreduceWait(tiles, recvs, send_requests);
+    slate_mpi_call(
+        MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE));
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// @return device where tile {i, j} is accumulated in a reduction:
+/// the tile's device for target = Devices, otherwise host.
+///
+template <typename scalar_t>
+int BaseMatrix<scalar_t>::reduceDevice(int64_t i, int64_t j, Target target)
+{
+    if (target == Target::Devices && num_devices() > 0)
+        return tileDevice( i, j );
+    else
+        return HostNum;
+}
 
+//------------------------------------------------------------------------------
+/// [internal]
+/// Starts summing tile {i, j} from all MPI ranks in reduce_set into
+/// root_rank, without blocking.
+/// Posts nonblocking receives of contributions from children in the
+/// reduction tree, into workspace buffers from the memory pool, appended
+/// to recvs. If there are no children, sends the tile to the parent.
+/// tileIreduceWait accumulates contributions as they arrive,
+/// then sends the sum to the parent.
+/// WARNING: Sent and received tiles are converted to 'layout' major.
+///
+/// @param[in,out] reduce_set
+///     Set of MPI ranks contributing. root_rank is inserted.
+///
+/// @param[in] target
+///     For Devices, accumulates on the tile's device, otherwise on host.
+///     With GPU-aware MPI, contributions are received on the device.
+///
+/// @param[in,out] tiles
+///     Vector where the reduction for this tile is appended.
+///
+/// @param[in,out] recvs
+///     Vector where receives for this tile are appended.
+///
+/// @param[in,out] send_requests
+///     Vector where the request for the send to the parent is appended.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIreduceFromSet(
+    int64_t i, int64_t j, int root_rank, std::set<int>& reduce_set,
+    int radix, int tag, Layout layout, Target target,
+    std::vector<ReduceTile>& tiles,
+    std::vector<ReduceRecv>& recvs,
+    std::vector<MPI_Request>& send_requests)
+{
     // Quit if the reduction set is empty
     if (reduce_set.empty())
         return;
@@ -2426,29 +3425,175 @@ void BaseMatrix<scalar_t>::tileReduceFromSet(
     internal::cubeReducePattern(new_vec.size(), new_rank, radix,
                                 recv_from, send_to);
 
-    if (! (send_to.empty() && recv_from.empty())) {
-        // read tile on host memory
-        tileGetForReading(i, j, LayoutConvert(layout));
+    if (send_to.empty() && recv_from.empty())
+        return;
+
+    // Complete any pending reduction of the same tile, including its send
+    // to the parent, which reads the tile this reduction accumulates into.
+    for (auto& recv : recvs) {
+        auto& reduce_tile = tiles[ recv.tile ];
+        if (! recv.done && reduce_tile.i == i && reduce_tile.j == j)
+            tileIreduceComplete( recv, tiles, send_requests );
+    }
+    for (auto& reduce_tile : tiles) {
+        if (reduce_tile.i == i && reduce_tile.j == j
+            && reduce_tile.send >= 0)
+        {
+            slate_mpi_call(
+                MPI_Wait( &send_requests[ reduce_tile.send ],
+                          MPI_STATUS_IGNORE ) );
+        }
+    }
 
-        auto Aij = at(i, j);
+    ReduceTile reduce_tile;
+    reduce_tile.i = i;
+    reduce_tile.j = j;
+    reduce_tile.device = reduceDevice( i, j, target );
+    reduce_tile.parent = send_to.empty() ? -1 : new_vec[ send_to.front() ];
+    reduce_tile.tag = tag;
+    reduce_tile.layout = layout;
+    reduce_tile.pending = recv_from.size();
+    reduce_tile.send = -1;
+    tiles.push_back( reduce_tile );
+
+    int recv_device = HostNum;
+    if (gpu_aware_mpi())
+        recv_device = reduce_tile.device;
+
+    int64_t count = tileMb( i ) * tileNb( j );
+    for (int src : recv_from) {
+        ReduceRecv recv;
+        recv.tile = tiles.size() - 1;
+        recv.device = recv_device;
+        recv.buffer = storage_->allocWorkspaceBuffer( recv_device, count );
+        recv.done = false;
+        slate_mpi_call(
+            MPI_Irecv( recv.buffer, count, mpi_type<scalar_t>::value,
+                       new_vec[ src ], tag, mpi_comm_, &recv.request ) );
+        recvs.push_back( recv );
+    }
+
+    // Leaves send their contribution now.
+    if (reduce_tile.pending == 0)
+        tileIreduceSend( tiles.back(), send_requests );
+}
 
-        std::vector<scalar_t> data(Aij.mb() * Aij.nb());
-        int64_t lda = (Aij.op() == Op::NoTrans ? Aij.mb() : Aij.nb());
-        Tile<scalar_t> tile(Aij, &data[0], lda, TileKind::Workspace);
+//------------------------------------------------------------------------------
+/// [internal]
+/// Waits for a contribution posted by tileIreduceFromSet, and adds it to
+/// the tile, on the device where the reduction accumulates.
+/// If it is the last contribution, sends the sum to the parent.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIreduceComplete(
+    ReduceRecv& recv, std::vector<ReduceTile>& tiles,
+    std::vector<MPI_Request>& send_requests)
+{
+    if (recv.done)
+        return;
 
-        // Receive, accumulate.
-        for (int src : recv_from) {
-            // Receive.
-            tile.recv(new_vec[src], mpi_comm_, layout, tag);
-            tileGetForWriting(i, j, LayoutConvert(layout));
-            // Accumulate.
-            tile::add( one, tile, Aij );
+    const scalar_t one = 1.0;
+
+    slate_mpi_call( MPI_Wait( &recv.request, MPI_STATUS_IGNORE ) );
+    recv.done = true;
+
+    auto& reduce_tile = tiles[ recv.tile ];
+    int64_t i = reduce_tile.i;
+    int64_t j = reduce_tile.j;
+    int device = reduce_tile.device;
+
+    tileGetForWriting( i, j, device, LayoutConvert( reduce_tile.layout ) );
+    auto Aij = at( i, j, device );
+
+    // Received data is contiguous: vectors (columns if ColMajor,
+    // rows if RowMajor) of length ld.
+    int64_t nvec = Aij.numVectors();
+    int64_t ld = Aij.size() / nvec;
+
+    if (device == HostNum) {
+        Tile<scalar_t> tile( Aij, recv.buffer, ld, TileKind::Workspace );
+        tile::add( one, tile, Aij );
+    }
+    else {
+        blas::Queue* queue = comm_queue( device );
+        scalar_t* buffer = recv.buffer;
+        if (recv.device != device) {
+            // Without GPU-aware MPI, copy the contribution to the device.
+            buffer = storage_->allocWorkspaceBuffer( device, Aij.size() );
+            blas::device_memcpy<scalar_t>(
+                buffer, recv.buffer, Aij.size(), *queue );
         }
+        device::geadd( ld, nvec, one, buffer, ld,
+                       one, Aij.data(), Aij.stride(), *queue );
+        queue->sync();
+        if (buffer != recv.buffer)
+            storage_->releaseWorkspaceBuffer( buffer, device );
+    }
+    storage_->releaseWorkspaceBuffer( recv.buffer, recv.device );
+    recv.buffer = nullptr;
 
-        // Forward.
-        if (! send_to.empty())
-            Aij.send(new_vec[send_to.front()], mpi_comm_, tag);
+    --reduce_tile.pending;
+    if (reduce_tile.pending == 0)
+        tileIreduceSend( reduce_tile, send_requests );
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Sends the sum of a reduction to its parent, if any, using a nonblocking
+/// send, with the request appended to send_requests and its index recorded
+/// in reduce_tile.send.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIreduceSend(
+    ReduceTile& reduce_tile, std::vector<MPI_Request>& send_requests)
+{
+    if (reduce_tile.parent < 0)
+        return;
+
+    int64_t i = reduce_tile.i;
+    int64_t j = reduce_tile.j;
+    int send_device = gpu_aware_mpi() ? reduce_tile.device : HostNum;
+    tileGetForReading( i, j, send_device, LayoutConvert( reduce_tile.layout ) );
+
+    MPI_Request request;
+    at( i, j, send_device ).isend( reduce_tile.parent, mpi_comm_,
+                                   reduce_tile.tag, &request );
+    reduce_tile.send = send_requests.size();
+    send_requests.push_back( request );
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Completes all reductions posted by tileIreduceFromSet, accumulating
+/// contributions in the order they arrive, and forwarding each sum to its
+/// parent as soon as it is complete.
+/// Requests for sends to parents are appended to send_requests.
+///
+template <typename scalar_t>
+void BaseMatrix<scalar_t>::tileIreduceWait(
+    std::vector<ReduceTile>& tiles, std::vector<ReduceRecv>& recvs,
+    std::vector<MPI_Request>& send_requests)
+{
+    std::vector<MPI_Request> requests;
+    requests.reserve( recvs.size() );
+    for (auto& recv : recvs) {
+        requests.push_back( recv.done ? MPI_REQUEST_NULL : recv.request );
     }
+
+    while (true) {
+        int index;
+        slate_mpi_call(
+            MPI_Waitany( requests.size(), requests.data(), &index,
+                         MPI_STATUS_IGNORE ) );
+        if (index == MPI_UNDEFINED)
+            break;
+
+        // Receive is complete, so tileIreduceComplete won't wait.
+        recvs[ index ].request = MPI_REQUEST_NULL;
+        tileIreduceComplete( recvs[ index ], tiles, send_requests );
+    }
+    recvs.clear();
+    tiles.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -2651,6 +3796,11 @@ void BaseMatrix<scalar_t>::tileGet(int64_t i, int64_t j, int dst_device,
     const int invalid_dev = HostNum - 1; // invalid device number
     int src_device = invalid_dev;
 
+    // In out-of-core mode, read host instance back from disk if evicted,
+    // and keep it resident until the copy below is done.
+    std::shared_ptr<void> pin;
+    storage_->tileLoad( globalIndex( i, j ), &pin );
+
     // find tile on destination
     auto& tile_node = storage_->at(globalIndex(i, j));
 
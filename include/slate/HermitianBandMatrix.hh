@@ -28,9 +28,18 @@ namespace slate {
 template <typename scalar_t>
 class HermitianBandMatrix: public BaseTriangularBandMatrix<scalar_t> {
 public:
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
     // constructors
     HermitianBandMatrix();
 
+    HermitianBandMatrix(
+        Uplo uplo, int64_t n, int64_t kd,
+        std::function<int64_t (int64_t j)>& inTileNb,
+        std::function<int (ij_tuple ij)>& inTileRank,
+        std::function<int (ij_tuple ij)>& inTileDevice,
+        MPI_Comm mpi_comm);
+
     HermitianBandMatrix(
         Uplo uplo,
         int64_t n, int64_t kd,
@@ -71,6 +80,24 @@ HermitianBandMatrix<scalar_t>::HermitianBandMatrix()
     : BaseTriangularBandMatrix<scalar_t>()
 {}
 
+//------------------------------------------------------------------------------
+/// Constructor creates an n-by-n Hermitian band matrix, with no tiles
+/// allocated, where tileNb, tileRank, tileDevice are given as functions.
+/// Tiles can be added with tileInsert().
+///
+/// @see slate::func for common functions.
+///
+template <typename scalar_t>
+HermitianBandMatrix<scalar_t>::HermitianBandMatrix(
+    Uplo uplo, int64_t n, int64_t kd,
+    std::function<int64_t (int64_t j)>& inTileNb,
+    std::function<int (ij_tuple ij)>& inTileRank,
+    std::function<int (ij_tuple ij)>& inTileDevice,
+    MPI_Comm mpi_comm)
+    : BaseTriangularBandMatrix<scalar_t>(uplo, n, kd, inTileNb, inTileRank,
+                                         inTileDevice, mpi_comm)
+{}
+
 //------------------------------------------------------------------------------
 /// Constructor creates an n-by-n Hermitian band matrix, with no tiles allocated.
 /// Tiles can be added with tileInsert().
@@ -303,7 +330,10 @@ void HermitianBandMatrix<scalar_t>::gatherAll(std::set<int>& rank_set, int tag)
 
 //------------------------------------------------------------------------------
 /// Gather the distributed triangular band portion of a HermitianMatrix A
-//  to HermitianBandMatrix B on MPI rank 0.
+/// to this HermitianBandMatrix B. Each tile of the band is sent to the rank
+/// owning it in B, which may have a different distribution than A,
+/// e.g., all on rank 0, or block columns distributed for hb2st.
+/// Local tiles of B must be inserted before calling.
 /// Primarily for EVD code
 ///
 template <typename scalar_t>
@@ -321,31 +351,27 @@ void HermitianBandMatrix<scalar_t>::he2hbGather(HermitianMatrix<scalar_t>& A)
 
         int64_t istart = upper ? blas::max( 0, j-kdt ) : j;
         int64_t iend   = upper ? j : blas::min( j+kdt, mt-1 );
-        for (int64_t i = 0; i < mt; ++i) {
-            if (i >= istart && i <= iend) {
-                if (this->mpi_rank_ == 0) {
-                    if (! A.tileIsLocal(i, j)) {
-                        this->tileInsert( i, j, HostNum );
-                        auto Bij = this->at(i, j);
-                        Bij.recv(A.tileRank(i, j), this->mpi_comm_, this->layout());
-                    }
-                    else {
-                        A.tileGetForReading(i, j, LayoutConvert(this->layout()));
-                        // TODO add: this->tileGetForWriting(i, j, LayoutConvert(this->layout()));
-                        // copy local tiles if needed.
-                        auto Aij = A(i, j);
-                        auto Bij = this->at(i, j);
-                        if (Aij.data() != Bij.data() ) {
-                            tile::gecopy( A(i, j), Bij );
-                        }
-                    }
+        for (int64_t i = istart; i <= iend; ++i) {
+            int dst = this->tileRank( i, j );
+            if (this->mpi_rank_ == dst) {
+                auto Bij = this->at(i, j);
+                if (! A.tileIsLocal(i, j)) {
+                    Bij.recv(A.tileRank(i, j), this->mpi_comm_, this->layout());
                 }
-                else if (A.tileIsLocal(i, j)) {
+                else {
                     A.tileGetForReading(i, j, LayoutConvert(this->layout()));
+                    // copy local tiles if needed.
                     auto Aij = A(i, j);
-                    Aij.send(0, this->mpi_comm_);
+                    if (Aij.data() != Bij.data() ) {
+                        tile::gecopy( A(i, j), Bij );
+                    }
                 }
             }
+            else if (A.tileIsLocal(i, j)) {
+                A.tileGetForReading(i, j, LayoutConvert(this->layout()));
+                auto Aij = A(i, j);
+                Aij.send(dst, this->mpi_comm_);
+            }
         }
     }
 
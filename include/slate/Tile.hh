@@ -134,6 +134,18 @@ public:
     void irecv(int src, MPI_Comm mpi_comm, Layout layout, int tag, MPI_Request *req);
     void bcast(int bcast_root, MPI_Comm mpi_comm);
 
+    void pack(scalar_t* buffer) const;
+    void unpack(scalar_t const* buffer, Layout layout);
+
+    /// Returns number of columns (ColMajor) or rows (RowMajor) in storage,
+    /// i.e., the number of vectors of length stride apart.
+    int64_t numVectors() const { return layout_ == Layout::ColMajor ? nb_ : mb_; }
+
+    void isendVectors(int64_t begin, int64_t end, int dst, MPI_Comm mpi_comm,
+                      int tag, MPI_Request* request) const;
+    void irecvVectors(int64_t begin, int64_t end, int src, MPI_Comm mpi_comm,
+                      int tag, MPI_Request* request);
+
     /// Returns shallow copy of tile that is transposed.
     template <typename TileType>
     friend TileType transpose(TileType& A);
@@ -339,6 +351,8 @@ public:
         Op op, int64_t i, int64_t j, int64_t mb, int64_t nb, Uplo uplo);
 
 protected:
+    MPI_Datatype vectorsType(int64_t begin, int64_t end) const;
+
     // BaseMatrix sets tile state
     template <typename T>
     friend class BaseMatrix;
@@ -397,6 +411,11 @@ protected:
 
     // @end data members
     //--------------------
+
+    /// In out-of-core mode, keeps the host instance resident while this
+    /// Tile or a copy of it exists; see MatrixStorage::tileLoad.
+    /// Kept after the data members above, which the C API mirrors.
+    std::shared_ptr<void> pin_;
 };
 
 //------------------------------------------------------------------------------
@@ -1139,6 +1158,147 @@ void Tile<scalar_t>::irecv(int src, MPI_Comm mpi_comm, Layout layout,
     // by receiving less / compacted data
 }
 
+//------------------------------------------------------------------------------
+/// [internal]
+/// Returns MPI datatype for vectors [begin, end) of the tile, i.e.,
+/// columns if ColMajor or rows if RowMajor. The caller must free it.
+///
+template <typename scalar_t>
+MPI_Datatype Tile<scalar_t>::vectorsType(int64_t begin, int64_t end) const
+{
+    assert(0 <= begin && begin < end && end <= numVectors());
+
+    int count = end - begin;
+    int blocklength = layout_ == Layout::ColMajor ? mb_ : nb_;
+    int stride = stride_;
+    MPI_Datatype newtype;
+
+    slate_mpi_call(
+        MPI_Type_vector(count, blocklength, stride,
+                        mpi_type<scalar_t>::value, &newtype));
+    slate_mpi_call(MPI_Type_commit(&newtype));
+    return newtype;
+}
+
+//------------------------------------------------------------------------------
+/// Sends vectors [begin, end) of the tile, i.e., columns if ColMajor or
+/// rows if RowMajor, to MPI rank dst.
+/// Used to send a large tile in segments that can be forwarded
+/// while later segments are in flight.
+/// Destination rank must call irecvVectors() with the same range.
+///
+/// @param[in] begin
+///     First vector to send. 0 <= begin < end.
+///
+/// @param[in] end
+///     One past the last vector to send. end <= numVectors().
+///
+/// @param[in] dst
+///     Destination MPI rank in mpi_comm.
+///
+/// @param[in] mpi_comm
+///     MPI communicator.
+///
+/// @param[in] tag
+///     MPI tag
+///
+/// @param[out] request
+///     MPI request object
+///
+template <typename scalar_t>
+void Tile<scalar_t>::isendVectors(
+    int64_t begin, int64_t end, int dst, MPI_Comm mpi_comm, int tag,
+    MPI_Request* request) const
+{
+    trace::Block trace_block("MPI_Isend");
+
+    MPI_Datatype newtype = vectorsType( begin, end );
+    slate_mpi_call(
+        MPI_Isend(&data_[ begin*stride_ ], 1, newtype, dst, tag, mpi_comm,
+                  request));
+    slate_mpi_call(MPI_Type_free(&newtype));
+}
+
+//------------------------------------------------------------------------------
+/// Receives vectors [begin, end) of the tile, i.e., columns if ColMajor or
+/// rows if RowMajor, from MPI rank src.
+/// The tile must already have the layout of the sender.
+///
+/// @param[in] begin
+///     First vector to receive. 0 <= begin < end.
+///
+/// @param[in] end
+///     One past the last vector to receive. end <= numVectors().
+///
+/// @param[in] src
+///     Source MPI rank in mpi_comm.
+///
+/// @param[in] mpi_comm
+///     MPI communicator.
+///
+/// @param[in] tag
+///     MPI tag
+///
+/// @param[out] request
+///     MPI request object
+///
+template <typename scalar_t>
+void Tile<scalar_t>::irecvVectors(
+    int64_t begin, int64_t end, int src, MPI_Comm mpi_comm, int tag,
+    MPI_Request* request)
+{
+    trace::Block trace_block("MPI_Irecv");
+
+    MPI_Datatype newtype = vectorsType( begin, end );
+    slate_mpi_call(
+        MPI_Irecv(&data_[ begin*stride_ ], 1, newtype, src, tag, mpi_comm,
+                  request));
+    slate_mpi_call(MPI_Type_free(&newtype));
+}
+
+//------------------------------------------------------------------------------
+/// Copies tile data, in the tile's layout, into the contiguous host buffer,
+/// which must hold mb*nb elements.
+/// Used to pack several tiles into one message.
+///
+/// @param[out] buffer
+///     Host buffer of size mb*nb.
+///
+template <typename scalar_t>
+void Tile<scalar_t>::pack(scalar_t* buffer) const
+{
+    slate_assert(device_ == HostNum);
+
+    int64_t m = layout_ == Layout::ColMajor ? mb_ : nb_;
+    int64_t n = layout_ == Layout::ColMajor ? nb_ : mb_;
+    for (int64_t j = 0; j < n; ++j) {
+        std::memcpy( &buffer[ j*m ], &data_[ j*stride_ ], m * sizeof(scalar_t) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies tile data from the contiguous host buffer, filled by pack().
+///
+/// @param[in] buffer
+///     Host buffer of size mb*nb.
+///
+/// @param[in] layout
+///     Indicates the Layout (ColMajor/RowMajor) of the packed data.
+///
+template <typename scalar_t>
+void Tile<scalar_t>::unpack(scalar_t const* buffer, Layout layout)
+{
+    slate_assert(device_ == HostNum);
+
+    this->setLayout( layout );
+
+    int64_t m = layout_ == Layout::ColMajor ? mb_ : nb_;
+    int64_t n = layout_ == Layout::ColMajor ? nb_ : mb_;
+    for (int64_t j = 0; j < n; ++j) {
+        std::memcpy( &data_[ j*stride_ ], &buffer[ j*m ], m * sizeof(scalar_t) );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Broadcasts tile from MPI rank bcast_root, using given communicator.
 ///
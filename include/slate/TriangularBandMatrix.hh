@@ -319,10 +319,12 @@ void TriangularBandMatrix<scalar_t>::gatherAll(std::set<int>& rank_set, int tag)
 
 //------------------------------------------------------------------------------
 /// Gather the distributed triangular band portion of a general Matrix A
-/// to TriangularBandMatrix B on MPI rank 0.
+/// to this TriangularBandMatrix B. Each tile of the band is sent to the rank
+/// owning it in B, which may have a different distribution than A,
+/// e.g., all on rank 0, or block columns distributed for tb2bd.
+/// Local tiles of B must be inserted before calling.
 /// Primarily for SVD code
 ///
-// todo: parameter for rank to collect on, default 0
 template <typename scalar_t>
 void TriangularBandMatrix<scalar_t>::ge2tbGather(Matrix<scalar_t>& A)
 {
@@ -338,30 +340,27 @@ void TriangularBandMatrix<scalar_t>::ge2tbGather(Matrix<scalar_t>& A)
 
         int64_t istart = upper ? blas::max( 0, j-kdt ) : j;
         int64_t iend   = upper ? j : blas::min( j+kdt, mt-1 );
-        for (int64_t i = 0; i < mt; ++i) {
-            if (i >= istart && i <= iend) {
-                if (this->mpi_rank_ == 0) {
-                    if (! A.tileIsLocal(i, j)) {
-                        this->tileInsert( i, j, HostNum );
-                        auto Bij = this->at(i, j);
-                        Bij.recv(A.tileRank(i, j), this->mpi_comm_, this->layout());
-                    }
-                    else {
-                        A.tileGetForReading(i, j, LayoutConvert(this->layout()));
-                        // copy local tiles if needed.
-                        auto Aij = A(i, j);
-                        auto Bij = this->at(i, j);
-                        if (Aij.data() != Bij.data() ) {
-                            tile::gecopy( A(i, j), Bij );
-                        }
-                    }
+        for (int64_t i = istart; i <= iend; ++i) {
+            int dst = this->tileRank( i, j );
+            if (this->mpi_rank_ == dst) {
+                auto Bij = this->at(i, j);
+                if (! A.tileIsLocal(i, j)) {
+                    Bij.recv(A.tileRank(i, j), this->mpi_comm_, this->layout());
                 }
-                else if (A.tileIsLocal(i, j)) {
+                else {
                     A.tileGetForReading(i, j, LayoutConvert(this->layout()));
+                    // copy local tiles if needed.
                     auto Aij = A(i, j);
-                    Aij.send(0, this->mpi_comm_);
+                    if (Aij.data() != Bij.data() ) {
+                        tile::gecopy( A(i, j), Bij );
+                    }
                 }
             }
+            else if (A.tileIsLocal(i, j)) {
+                A.tileGetForReading(i, j, LayoutConvert(this->layout()));
+                auto Aij = A(i, j);
+                Aij.send(dst, this->mpi_comm_);
+            }
         }
     }
 
@@ -30,6 +30,7 @@ using lapack::Norm;
 using lapack::Direction;
 
 using lapack::Job;
+using lapack::Range;
 
 //------------------------------------------------------------------------------
 /// Location and method of computation.
@@ -39,7 +40,7 @@ enum class Target : char {
     Host      = 'H',    ///< data resides on host
     HostTask  = 'T',    ///< computation using OpenMP nested tasks on host
     HostNest  = 'N',    ///< computation using OpenMP nested parallel for loops on host
-    HostBatch = 'B',    ///< computation using batch BLAS on host (Intel MKL)
+    HostBatch = 'B',    ///< computation using grouped batch BLAS on host (Intel MKL, or portable)
     Devices   = 'D',    ///< computation using batch BLAS on devices (cuBLAS)
 };
 
@@ -51,6 +52,21 @@ template <Target> class TargetType {};
 
 } // namespace internal
 
+//------------------------------------------------------------------------------
+/// Storage precision of the low-precision factor in the mixed-precision
+/// solvers, gesv_mixed, gesv_mixed_gmres, posv_mixed, and posv_mixed_gmres.
+/// The factorization is always computed in single precision; with Half or
+/// BFloat16, the factor is then stored in 16 bits and solves convert it
+/// back to single precision tile by tile. This saves memory only during
+/// refinement; the factorization's peak memory is unchanged.
+/// @ingroup enum
+///
+enum class FactorPrecision : char {
+    Single   = 's',     ///< single precision (float) [default]
+    Half     = 'h',     ///< IEEE half precision (fp16), scaled per tile
+    BFloat16 = 'b',     ///< bfloat16
+};
+
 //------------------------------------------------------------------------------
 // Methods
 
@@ -360,7 +376,7 @@ enum class MethodEig : char {
     Auto      = '*',    ///< Let SLATE decide
     QR        = 'Q',    ///< QR iteration
     DC        = 'D',    ///< Divide and conquer
-    Bisection = 'B',    ///< Bisection; not yet implemented
+    Bisection = 'B',    ///< Bisection and inverse iteration
     MRRR      = 'M',    ///< Multiple Relatively Robust Representations (MRRR); not yet implemented
 };
 
@@ -412,8 +428,8 @@ inline void from_string( std::string const& str, MethodEig* val )
 enum class MethodSVD : char {
     Auto      = '*',    ///< Let SLATE decide
     QR        = 'Q',    ///< QR iteration
-    DC        = 'D',    ///< Divide and conquer; not yet implemented
-    Bisection = 'B',    ///< Bisection; not yet implemented
+    DC        = 'D',    ///< LAPACK bdsdc, serial on rank 0, then redistributed
+    Bisection = 'B',    ///< Bisection and inverse iteration; not yet implemented
 };
 
 extern const char* MethodSVD_help;
@@ -472,6 +488,18 @@ enum class Option : char {
     MaxIterations,      ///< maximum iteration count
     UseFallbackSolver,  ///< whether to fallback to a robust solver if iterations do not converge
     PivotThreshold,     ///< threshold for pivoting, >= 0, <= 1
+    BcastPackSize,      ///< max tile size in bytes that listBcast packs
+                        ///< with other tiles going to the same ranks
+                        ///< into one message per hop; 0 disables packing
+    BcastSegmentSize,   ///< segment size in bytes for pipelined broadcast
+                        ///< of larger tiles; 0 disables segmenting
+    BcastSharedMemory,  ///< tiles per rank in the node-shared window that
+                        ///< listBcast uses for ranks on the owner's node;
+                        ///< 0 disables it
+    FactorPrecision,    ///< storage precision of the factor in mixed-precision
+                        ///< solvers (@see FactorPrecision)
+    FusedConversion,    ///< convert A to low precision within getrf in
+                        ///< mixed-precision LU solvers, not in a separate pass
 
     // Printing parameters
     PrintVerbose = 50,  ///< verbose, 0: no printing,
@@ -8,6 +8,7 @@
 
 #include "slate/func.hh"
 #include "slate/internal/Memory.hh"
+#include "slate/internal/SharedWindow.hh"
 #include "slate/Tile.hh"
 #include "slate/types.hh"
 #include "slate/internal/util.hh"
@@ -17,12 +18,20 @@
 #include "lapack/device.hh"
 
 #include <algorithm>
+#include <cerrno>
 #include <functional>
+#include <atomic>
+#include <list>
 #include <memory>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "slate/internal/mpi.hh"
 #include "slate/internal/openmp.hh"
 #include "slate/internal/LockGuard.hh"
@@ -41,6 +50,16 @@ private:
     /// This variable is used for only MPI communications.
     int64_t receive_count_;
 
+    /// Out-of-core state of the host instance, used only when MatrixStorage
+    /// has a host memory budget. When on disk, the host instance's data
+    /// pointer is null and its data is in the backing file at disk_offset_.
+    bool on_disk_;
+    int64_t disk_offset_;  ///< -1 if never written to the backing file
+    std::list< std::tuple<int64_t, int64_t> >::iterator lru_pos_;
+    /// Shared with Tile objects returned by BaseMatrix::operator();
+    /// the host instance isn't evicted while any of them exists.
+    std::shared_ptr<void> pin_;
+
     /// OMP lock used to protect operations that modify the Tiles within
     mutable omp_nest_lock_t lock_;
 
@@ -48,7 +67,9 @@ public:
     /// Constructor for TileNode class
     TileNode(int num_devices)
         : num_instances_(0),
-          receive_count_(0)
+          receive_count_(0),
+          on_disk_(false),
+          disk_offset_(-1)
     {
         slate_assert(num_devices >= 0);
         omp_init_nest_lock(&lock_);
@@ -136,6 +157,40 @@ public:
         return receive_count_;
     }
 
+    //--------------------------------------------------------------------------
+    /// Whether host instance's data was evicted to the backing file.
+    bool& onDisk()
+    {
+        return on_disk_;
+    }
+
+    /// Offset of host instance's data in the backing file.
+    int64_t& diskOffset()
+    {
+        return disk_offset_;
+    }
+
+    /// Position of host instance in the LRU list of resident tiles.
+    std::list< std::tuple<int64_t, int64_t> >::iterator& lruPos()
+    {
+        return lru_pos_;
+    }
+
+    /// Pin shared with Tile objects in use; see MatrixStorage::tileLoad.
+    std::shared_ptr<void>& pin()
+    {
+        return pin_;
+    }
+
+    /// Whether host instance is pinned by a Tile object in use.
+    bool pinned() const
+    {
+        bool is_pinned = pin_.use_count() > 1;
+        // Order the caller's reads of tile data after the last unpin.
+        std::atomic_thread_fence( std::memory_order_acquire );
+        return is_pinned;
+    }
+
     bool empty() const
     {
         return num_instances_ == 0;
@@ -145,6 +200,12 @@ public:
 //------------------------------------------------------------------------------
 /// Slate::MatrixStorage class
 /// Used to store the map of distributed tiles.
+///
+/// Tiles are kept in a map, which is used for iterating over tiles.
+/// For lookups, matrices with at most max_index_size tiles also have a
+/// dense mt-by-nt index of map iterators, so finding a tile is O(1)
+/// instead of O(log n) in the number of tiles.
+///
 /// @tparam scalar_t Data type for the elements of the matrix
 ///
 template <typename scalar_t>
@@ -159,6 +220,11 @@ public:
     using ij_tuple    = std::tuple<int64_t, int64_t>;
     using TilesMap = std::map< ij_tuple, std::shared_ptr<TileNode_t> >;
 
+    /// Max number of tiles for which the dense tile index is used;
+    /// larger matrices use only the map. The index takes
+    /// 8 bytes per tile, so 32 MiB at this size.
+    static constexpr int64_t max_index_size = 4*1024*1024;
+
     MatrixStorage( int64_t m, int64_t n, int64_t mb, int64_t nb,
                    GridOrder order, int p, int q, MPI_Comm mpi_comm );
 
@@ -255,6 +321,85 @@ public:
     scalar_t* allocWorkspaceBuffer(int device, int size);
     void      releaseWorkspaceBuffer(scalar_t* data, int device);
 
+    //--------------------------------------------------------------------------
+    // out-of-core
+    void setHostMemoryBudget(int64_t budget, std::string const& dir);
+
+    /// @return host memory budget in bytes for local tiles;
+    /// 0 if all tiles stay in host memory.
+    int64_t hostMemoryBudget() const
+    {
+        return host_budget_;
+    }
+
+    /// @return bytes of host memory used by resident local tiles
+    /// in out-of-core mode.
+    int64_t hostResidentBytes() const
+    {
+        return host_resident_bytes_;
+    }
+
+    //--------------------------------------------------------------------------
+    // communication
+    /// Sets max tile size in bytes that listBcast packs into one message.
+    /// Must be the same on all ranks. 0 disables packing.
+    void setBcastPackSize(int64_t bytes)
+    {
+        slate_assert(bytes >= 0);
+        bcast_pack_size_ = bytes;
+    }
+
+    /// @return max tile size in bytes that listBcast packs; 0 if disabled.
+    int64_t bcastPackSize() const
+    {
+        return bcast_pack_size_;
+    }
+
+    /// Sets segment size in bytes for pipelined broadcast of larger tiles.
+    /// Must be the same on all ranks. 0 disables segmenting.
+    void setBcastSegmentSize(int64_t bytes)
+    {
+        slate_assert(bytes >= 0);
+        bcast_segment_size_ = bytes;
+    }
+
+    /// @return segment size in bytes for pipelined broadcast; 0 if disabled.
+    int64_t bcastSegmentSize() const
+    {
+        return bcast_segment_size_;
+    }
+
+    /// Sets node id of each MPI rank, for node-aware broadcast.
+    /// Empty disables node-aware broadcast.
+    /// @see internal::commNodeIds
+    void setBcastNodeIds(std::vector<int> const& node_ids)
+    {
+        bcast_node_ids_ = node_ids;
+    }
+
+    /// @return node id of each MPI rank; empty if broadcast isn't node-aware.
+    std::vector<int> const& bcastNodeIds() const
+    {
+        return bcast_node_ids_;
+    }
+
+    void setBcastSharedMemory(int64_t num_tiles, MPI_Comm mpi_comm);
+
+    /// @return number of tiles per rank in the shared window used by
+    /// listBcast; 0 if disabled.
+    int64_t bcastSharedMemory() const
+    {
+        return bcast_shared_ ? bcast_window_->numSlots() : 0;
+    }
+
+    /// @return shared window used by listBcast; nullptr if disabled.
+    SharedWindow* bcastWindow()
+    {
+        return bcast_shared_ ? bcast_window_.get() : nullptr;
+    }
+
+    void tileLoad(ij_tuple ij, std::shared_ptr<void>* pin = nullptr);
+
 private:
     // Iterator routines should be called only within a Tiles Map LockGuard.
     // Otherwise, there may be race conditions with the returned iterator.
@@ -266,7 +411,7 @@ private:
         int64_t i  = std::get<0>(ijdev);
         int64_t j  = std::get<1>(ijdev);
         int device = std::get<2>(ijdev);
-        auto it = tiles_.find({i, j});
+        auto it = find( {i, j} );
         if (it != tiles_.end() && it->second->existsOn(device))
             return it;
         else
@@ -277,9 +422,24 @@ private:
     /// @return TileNode(i, j) if found, end() otherwise
     typename TilesMap::iterator find(ij_tuple ij)
     {
-        return tiles_.find(ij);
+        int64_t i = std::get<0>(ij);
+        int64_t j = std::get<1>(ij);
+        if (isIndexed( i, j ))
+            return tile_index_[ i + j*index_mt_ ];
+        else
+            return tiles_.find(ij);
     }
 
+    //--------------------------------------------------------------------------
+    /// @return whether tile {i, j} is covered by the dense tile index.
+    bool isIndexed(int64_t i, int64_t j) const
+    {
+        return 0 <= i && i < index_mt_
+            && 0 <= j && j < index_nt_;
+    }
+
+    void initIndex(int64_t mt, int64_t nt);
+
     //--------------------------------------------------------------------------
     /// @return begin iterator of TileNode map
     typename TilesMap::iterator begin()
@@ -302,16 +462,22 @@ public:
     TileNode_t& at(ij_tuple ij)
     {
         LockGuard guard(getTilesMapLock());
-        return *(tiles_.at(ij));
+        auto iter = find( ij );
+        if (iter == end())
+            throw std::out_of_range( "MatrixStorage::at: tile doesn't exist" );
+        return *(iter->second);
     }
 
     /// @return pointer to an actual Tile object
     /// Throws exception if entry doesn't exist.
+    /// In out-of-core mode, reads a host tile back from disk if needed.
     Tile<scalar_t>* at(ijdev_tuple ijdev)
     {
         int64_t i  = std::get<0>(ijdev);
         int64_t j  = std::get<1>(ijdev);
         int device = std::get<2>(ijdev);
+        if (device == HostNum && host_budget_ > 0)
+            tileLoad( {i, j} );
         auto& tile_node = at( {i, j} );
 
         // TODO ideally, this would be accessed with a lock on the tile node,
@@ -324,6 +490,13 @@ public:
     void release(ijdev_tuple ijdev);
 private:
     void release(typename TilesMap::iterator iter, int device);
+
+    bool isOutOfCore(ij_tuple ij, TileNode_t& tile_node);
+    void lruInsert(ij_tuple ij, TileNode_t& tile_node);
+    void lruErase(TileNode_t& tile_node);
+    void evictToBudget();
+    void tileEvict(TileNode_t& tile_node);
+    void tileRead(ij_tuple ij, TileNode_t& tile_node);
 public:
     void freeTileMemory(Tile<scalar_t>* tile);
     void clear();
@@ -380,7 +553,7 @@ public:
     int64_t tileReceiveCount(ij_tuple ij)
     {
         LockGuard guard( getTilesMapLock() );
-        return tiles_.at( ij )->receiveCount();
+        return at( ij ).receiveCount();
     }
 
     //--------------------------------------------------------------------------
@@ -388,7 +561,7 @@ public:
     void tileIncrementReceiveCount(ij_tuple ij)
     {
         LockGuard guard( getTilesMapLock() );
-        tiles_.at( ij )->receiveCount()++;
+        at( ij ).receiveCount()++;
     }
 
     //--------------------------------------------------------------------------
@@ -396,7 +569,7 @@ public:
     void tileDecrementReceiveCount( ij_tuple ij, int64_t release_count = 1 )
     {
         LockGuard guard( getTilesMapLock() );
-        tiles_.at( ij )->receiveCount() -= release_count;
+        at( ij ).receiveCount() -= release_count;
     }
 
     /// Ensures the tile node exists and increments the receive count.
@@ -419,6 +592,29 @@ public:
         }
     }
 
+    /// Like tilePrepareToReceive, for a tile received on the host through
+    /// the shared window. If there is no host tile, inserts a host workspace
+    /// tile wrapping data, a slot of the window, which is released when the
+    /// tile is freed.
+    /// @return true if the tile wraps data; false if a host tile already
+    /// existed, so the caller must copy data to it and release the slot.
+    bool tilePrepareToReceiveShared(ij_tuple ij, scalar_t* data, Layout layout)
+    {
+        slate_assert( ! tileIsLocal( ij ) );
+        LockGuard guard( getTilesMapLock() );
+        int64_t i  = std::get<0>( ij );
+        int64_t j  = std::get<1>( ij );
+
+        bool inserted = false;
+        if (find( {i, j, HostNum} ) == end()) {
+            int64_t lda = (layout == Layout::ColMajor) ? tileMb( i ) : tileNb( j );
+            tileInsert( {i, j, HostNum}, data, lda, TileKind::Workspace, layout );
+            inserted = true;
+        }
+        tileIncrementReceiveCount( ij );
+        return inserted;
+    }
+
     // MOSI management
     /// Gets the state of the given tile
     MOSI tileState(ijdev_tuple ijdev)
@@ -456,6 +652,27 @@ public:
 private:
     TilesMap tiles_;        ///< map of tiles and associated states
     mutable omp_nest_lock_t lock_;  ///< TilesMap lock
+
+    /// Dense index of tiles_: entry i + j*index_mt_ is the iterator to
+    /// TileNode(i, j), or tiles_.end() if it doesn't exist.
+    std::vector< typename TilesMap::iterator > tile_index_;
+    int64_t index_mt_;
+    int64_t index_nt_;
+
+    // out-of-core: local SlateOwned host tiles beyond host_budget_ bytes
+    // are evicted, least recently used first, to the backing file.
+    // Protected by lock_.
+    int64_t host_budget_;          ///< 0 disables out-of-core
+    int64_t host_resident_bytes_;  ///< bytes of tiles in lru_
+    std::list< ij_tuple > lru_;    ///< resident tiles, most recent first
+    int backing_fd_;
+    int64_t backing_size_;
+
+    int64_t bcast_pack_size_;      ///< 0 disables packed listBcast
+    int64_t bcast_segment_size_;   ///< 0 disables segmented broadcast
+    std::vector<int> bcast_node_ids_;  ///< empty disables node-aware bcast
+    std::unique_ptr<SharedWindow> bcast_window_;  ///< for listBcast on node
+    bool bcast_shared_;            ///< whether listBcast uses bcast_window_
     slate::Memory memory_;  ///< memory allocator
 
     int mpi_rank_;
@@ -480,6 +697,15 @@ MatrixStorage<scalar_t>::MatrixStorage(
     int64_t m, int64_t n, int64_t mb, int64_t nb,
     GridOrder order, int p, int q, MPI_Comm mpi_comm)
     : tiles_(),
+      index_mt_(0),
+      index_nt_(0),
+      host_budget_(0),
+      host_resident_bytes_(0),
+      backing_fd_(-1),
+      backing_size_(0),
+      bcast_pack_size_(0),
+      bcast_segment_size_(0),
+      bcast_shared_(false),
       memory_(sizeof(scalar_t) * mb * nb),  // block size in bytes
       batch_array_size_(0)
 {
@@ -510,6 +736,7 @@ MatrixStorage<scalar_t>::MatrixStorage(
         };
     }
 
+    initIndex( ceildiv( m, mb ), ceildiv( n, nb ) );
     initQueues();
     omp_init_nest_lock(&lock_);
 }
@@ -529,6 +756,15 @@ MatrixStorage<scalar_t>::MatrixStorage(
       tileRank(inTileRank),
       tileDevice(inTileDevice),
       tiles_(),
+      index_mt_(0),
+      index_nt_(0),
+      host_budget_(0),
+      host_resident_bytes_(0),
+      backing_fd_(-1),
+      backing_size_(0),
+      bcast_pack_size_(0),
+      bcast_segment_size_(0),
+      bcast_shared_(false),
       memory_(sizeof(scalar_t) * func::max_blocksize(mt, inTileMb) // block size in bytes
                                * func::max_blocksize(nt, inTileNb)),
       batch_array_size_(0)
@@ -536,10 +772,26 @@ MatrixStorage<scalar_t>::MatrixStorage(
     slate_mpi_call(
         MPI_Comm_rank(mpi_comm, &mpi_rank_));
 
+    initIndex( mt, nt );
     initQueues();
     omp_init_nest_lock(&lock_);
 }
 
+//------------------------------------------------------------------------------
+/// Sets up the dense tile index for an mt-by-nt matrix, if it has
+/// at most max_index_size tiles. Otherwise, lookups use only the map.
+/// Called in constructor.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::initIndex(int64_t mt, int64_t nt)
+{
+    if (mt > 0 && nt > 0 && mt <= max_index_size / nt) {
+        index_mt_ = mt;
+        index_nt_ = nt;
+        tile_index_.assign( mt*nt, tiles_.end() );
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Destructor deletes all tiles and frees workspace buffers.
 ///
@@ -556,6 +808,8 @@ MatrixStorage<scalar_t>::~MatrixStorage()
             memory_.clearDeviceBlocks(device, queue);
         }
         destroyQueues(); // must occur after clearBatchArrays
+        if (backing_fd_ >= 0)
+            close( backing_fd_ );
         omp_destroy_nest_lock(&lock_);
     }
     catch (std::exception const& ex) {
@@ -775,9 +1029,16 @@ template <typename scalar_t>
 void MatrixStorage<scalar_t>::freeTileMemory(Tile<scalar_t>* tile)
 {
     slate_assert(tile != nullptr);
-    if (tile->allocated())
-        //delete[] tile->data();
-        memory_.free(tile->data(), tile->device());
+    // data is null if the tile was evicted to disk
+    if (tile->allocated() && tile->data() != nullptr) {
+        // tiles received through the shared window release their slot
+        if (tile->device() != HostNum || bcast_window_ == nullptr
+            || ! bcast_window_->release( tile->data() ))
+        {
+            //delete[] tile->data();
+            memory_.free(tile->data(), tile->device());
+        }
+    }
     if (tile->extended())
         memory_.free(tile->extData(), tile->device());
 }
@@ -872,6 +1133,8 @@ void MatrixStorage<scalar_t>::erase(ijdev_tuple ijdev)
         int64_t j  = std::get<1>(ijdev);
         int device = std::get<2>(ijdev);
 
+        if (device == HostNum && isOutOfCore( {i, j}, tile_node ))
+            lruErase( tile_node );
         freeTileMemory(tile_node[device]);
         tile_node.eraseOn(device);
 
@@ -972,18 +1235,25 @@ void MatrixStorage<scalar_t>::erase(ij_tuple ij)
 {
     LockGuard guard(getTilesMapLock());
 
-    auto iter = tiles_.find(ij);
-    if (iter != tiles_.end()) {
+    auto iter = find(ij);
+    if (iter != end()) {
 
         auto& tile_node = iter->second;
 
+        if (isOutOfCore( ij, *tile_node ))
+            lruErase( *tile_node );
         for (int d = HostNum; (! tile_node->empty()) && d < num_devices(); ++d) {
             if (tile_node->existsOn(d)) {
                 freeTileMemory(tile_node->at(d));
                 tile_node->eraseOn(d);
             }
         }
-        tiles_.erase(ij);
+
+        int64_t i = std::get<0>(ij);
+        int64_t j = std::get<1>(ij);
+        if (isIndexed( i, j ))
+            tile_index_[ i + j*index_mt_ ] = tiles_.end();
+        tiles_.erase(iter);
     }
 }
 
@@ -1085,8 +1355,12 @@ Tile<scalar_t>* MatrixStorage<scalar_t>::tileInsert(
     LockGuard guard(getTilesMapLock());
 
     if (find({i, j}) == end()) {
-        // insert new-entry in map
-        tiles_[{i, j}] = std::make_shared<TileNode_t>( num_devices() );
+        // insert new-entry in map and index
+        auto iter = tiles_.emplace(
+            ij_tuple( i, j ),
+            std::make_shared<TileNode_t>( num_devices() ) ).first;
+        if (isIndexed( i, j ))
+            tile_index_[ i + j*index_mt_ ] = iter;
     }
 
     auto& tile_node = this->at({i, j});
@@ -1107,10 +1381,285 @@ Tile<scalar_t>* MatrixStorage<scalar_t>::tileInsert(
         tile_node.insertOn(device, tile, kind == TileKind::Workspace ?
                                          MOSI::Invalid :
                                          MOSI::Shared);
+
+        if (device == HostNum && isOutOfCore( {i, j}, tile_node )) {
+            lruInsert( {i, j}, tile_node );
+            evictToBudget();
+        }
     }
     return tile_node[device];
 }
 
+//------------------------------------------------------------------------------
+/// Enables or disables the shared window for listBcast. Ranks on the same
+/// node as a tile's owner then read the tile from a slot of the owner's
+/// segment in an MPI-3 shared-memory window, instead of receiving a copy.
+/// Each slot holds one tile.
+///
+/// The window is allocated by the first call with num_tiles > 0, which is
+/// collective on mpi_comm, and kept until the matrix is destroyed; later
+/// calls only enable or disable it. Since freeing the window is collective,
+/// all ranks must destroy the matrix.
+///
+/// @param[in] num_tiles
+///     Number of tiles per rank in the window. 0 disables it.
+///
+/// @param[in] mpi_comm
+///     MPI communicator of the matrix.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::setBcastSharedMemory(
+    int64_t num_tiles, MPI_Comm mpi_comm)
+{
+    slate_assert( num_tiles >= 0 );
+    if (num_tiles > 0 && bcast_window_ == nullptr) {
+        bcast_window_.reset(
+            new SharedWindow( mpi_comm, memory_.blockSize(), num_tiles ) );
+    }
+    bcast_shared_ = num_tiles > 0;
+}
+
+//------------------------------------------------------------------------------
+/// Enables out-of-core mode: local tiles allocated by SLATE on the host
+/// are kept in host memory only up to budget bytes. When over budget, the
+/// least recently used tiles are written to a backing file and their host
+/// memory is released; they are read back when next accessed through
+/// at() or BaseMatrix::tileGet and its variants.
+///
+/// A tile is never evicted while it is OnHold, or while it is pinned:
+/// each Tile object returned by BaseMatrix::operator() (A(i, j)) and its
+/// copies pin the host instance until the last of them is destroyed, so
+/// tiles in use by tasks stay resident until those tasks finish.
+/// Raw data pointers must not outlive the Tile they were taken from.
+/// Workspace tiles and user-owned tiles are not evicted.
+///
+/// @param[in] budget
+///     Host memory budget in bytes for local tiles. 0 disables out-of-core,
+///     reading all evicted tiles back into host memory.
+///
+/// @param[in] dir
+///     Directory for the backing file. If empty, uses TMPDIR or /tmp.
+///     The file is unlinked as soon as it is created.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::setHostMemoryBudget(
+    int64_t budget, std::string const& dir)
+{
+    slate_assert( budget >= 0 );
+    LockGuard guard( getTilesMapLock() );
+
+    if (budget > 0 && backing_fd_ < 0) {
+        std::string path = dir;
+        if (path.empty()) {
+            const char* tmpdir = std::getenv( "TMPDIR" );
+            path = (tmpdir != nullptr ? tmpdir : "/tmp");
+        }
+        path += "/slate_tiles_XXXXXX";
+        backing_fd_ = mkstemp( &path[ 0 ] );
+        if (backing_fd_ < 0) {
+            slate_error( "can't create out-of-core backing file " + path
+                         + ": " + std::strerror( errno ) );
+        }
+        unlink( path.c_str() );
+    }
+
+    if (budget > 0 && host_budget_ == 0) {
+        // Track existing tiles.
+        host_budget_ = budget;
+        for (auto iter = begin(); iter != end(); ++iter) {
+            auto& tile_node = *(iter->second);
+            if (isOutOfCore( iter->first, tile_node ))
+                lruInsert( iter->first, tile_node );
+        }
+    }
+    else if (budget == 0 && host_budget_ > 0) {
+        // Read back all evicted tiles, then stop tracking.
+        for (auto iter = begin(); iter != end(); ++iter) {
+            auto& tile_node = *(iter->second);
+            if (tile_node.onDisk())
+                tileRead( iter->first, tile_node );
+        }
+        for (auto& ij : lru_)
+            find( ij )->second->lruPos() = lru_.end();
+        lru_.clear();
+        host_resident_bytes_ = 0;
+    }
+    host_budget_ = budget;
+    evictToBudget();
+}
+
+//------------------------------------------------------------------------------
+/// In out-of-core mode, ensures the host instance of tile {i, j}
+/// is in host memory, reading it from the backing file if needed,
+/// and marks it as most recently used. Otherwise, does nothing.
+/// May evict other tiles to stay within the host memory budget.
+///
+/// @param[out] pin
+///     If not null, set to the tile's pin, which keeps the host instance
+///     resident until *pin and all its copies are destroyed.
+///     Set only in out-of-core mode.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileLoad(ij_tuple ij, std::shared_ptr<void>* pin)
+{
+    if (host_budget_ == 0)
+        return;
+
+    LockGuard guard( getTilesMapLock() );
+    auto iter = find( ij );
+    if (iter == end() || ! iter->second->existsOn( HostNum ))
+        return;
+
+    auto& tile_node = *(iter->second);
+    if (! isOutOfCore( ij, tile_node ))
+        return;
+
+    if (tile_node.onDisk()) {
+        tileRead( ij, tile_node );
+    }
+    else {
+        // Move to front.
+        lru_.splice( lru_.begin(), lru_, tile_node.lruPos() );
+    }
+    // Pin before evicting, so this tile isn't evicted itself.
+    // Pins are taken only within the tiles map lock, as is evictToBudget,
+    // so a tile can't become pinned while it is being evicted.
+    if (pin != nullptr) {
+        if (tile_node.pin() == nullptr)
+            tile_node.pin() = std::make_shared<char>( 0 );
+        *pin = tile_node.pin();
+    }
+    evictToBudget();
+}
+
+//------------------------------------------------------------------------------
+/// Reads evicted host instance of tile {i, j} from the backing file, if it
+/// was ever written, into newly allocated host memory, and adds it as
+/// most recently used.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileRead(ij_tuple ij, TileNode_t& tile_node)
+{
+    Tile<scalar_t>* tile = tile_node[ HostNum ];
+    size_t bytes = sizeof(scalar_t) * tile->mb() * tile->nb();
+    scalar_t* data = (scalar_t*) memory_.alloc( HostNum, bytes, nullptr );
+    // A tile that was Invalid at every eviction was never written;
+    // its contents don't matter, so there is nothing to read.
+    if (tile_node.diskOffset() >= 0) {
+        ssize_t cnt = pread( backing_fd_, data, bytes,
+                             tile_node.diskOffset() );
+        if (cnt != ssize_t( bytes )) {
+            memory_.free( data, HostNum );
+            slate_error( std::string( "out-of-core read failed: " )
+                         + std::strerror( errno ) );
+        }
+    }
+    tile->data_ = data;
+    tile_node.onDisk() = false;
+    lruInsert( ij, tile_node );
+}
+
+//------------------------------------------------------------------------------
+/// @return whether the host instance of tile {i, j} is managed by
+/// out-of-core mode, i.e., it is a local, SLATE allocated origin tile.
+///
+template <typename scalar_t>
+bool MatrixStorage<scalar_t>::isOutOfCore(ij_tuple ij, TileNode_t& tile_node)
+{
+    return host_budget_ > 0
+           && tile_node.existsOn( HostNum )
+           && tile_node[ HostNum ]->kind() == TileKind::SlateOwned
+           && tileIsLocal( ij );
+}
+
+//------------------------------------------------------------------------------
+/// Adds resident tile {i, j} as most recently used.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::lruInsert(ij_tuple ij, TileNode_t& tile_node)
+{
+    Tile<scalar_t>* tile = tile_node[ HostNum ];
+    lru_.push_front( ij );
+    tile_node.lruPos() = lru_.begin();
+    host_resident_bytes_ += sizeof(scalar_t) * tile->mb() * tile->nb();
+}
+
+//------------------------------------------------------------------------------
+/// Stops tracking the host instance of a tile, e.g., when it is erased.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::lruErase(TileNode_t& tile_node)
+{
+    if (! tile_node.onDisk()) {
+        Tile<scalar_t>* tile = tile_node[ HostNum ];
+        lru_.erase( tile_node.lruPos() );
+        tile_node.lruPos() = lru_.end();
+        host_resident_bytes_ -= sizeof(scalar_t) * tile->mb() * tile->nb();
+    }
+    tile_node.onDisk() = false;
+}
+
+//------------------------------------------------------------------------------
+/// Evicts least recently used tiles until resident tiles fit in the
+/// host memory budget, skipping tiles that are pinned, OnHold, locked,
+/// or have an extended buffer. The most recently used tile, which was
+/// just inserted or loaded, is never evicted.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::evictToBudget()
+{
+    int64_t n = lru_.size();
+    auto iter = lru_.end();
+    while (host_resident_bytes_ > host_budget_
+           && n > 1 && iter != lru_.begin())
+    {
+        --iter;
+        --n;
+        auto& tile_node = *(find( *iter )->second);
+        Tile<scalar_t>* tile = tile_node[ HostNum ];
+        // Skip tiles whose node is locked, e.g., being copied in tileGet.
+        if (! tile_node.pinned()
+            && ! tile->stateOn( MOSI::OnHold ) && ! tile->extended()
+            && omp_test_nest_lock( tile_node.getLock() ))
+        {
+            // tileEvict erases iter from lru_; continue from its successor.
+            ++iter;
+            tileEvict( tile_node );
+            omp_unset_nest_lock( tile_node.getLock() );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Writes host instance of a tile to the backing file, unless it is
+/// Invalid, and releases its host memory.
+///
+template <typename scalar_t>
+void MatrixStorage<scalar_t>::tileEvict(TileNode_t& tile_node)
+{
+    Tile<scalar_t>* tile = tile_node[ HostNum ];
+    size_t bytes = sizeof(scalar_t) * tile->mb() * tile->nb();
+
+    if (! tile->stateOn( MOSI::Invalid )) {
+        // Space in the file is reserved only when first written.
+        if (tile_node.diskOffset() < 0) {
+            tile_node.diskOffset() = backing_size_;
+            backing_size_ += bytes;
+        }
+        // Writes through A(i, j) aren't tracked, so always write back.
+        ssize_t cnt = pwrite( backing_fd_, tile->data(), bytes,
+                              tile_node.diskOffset() );
+        if (cnt != ssize_t( bytes )) {
+            slate_error( std::string( "out-of-core write failed: " )
+                         + std::strerror( errno ) );
+        }
+    }
+    lruErase( tile_node );
+    memory_.free( tile->data(), HostNum );
+    tile->data_ = nullptr;
+    tile_node.onDisk() = true;
+}
+
 //------------------------------------------------------------------------------
 /// Makes tile layout convertible by extending its data buffer.
 /// Attaches an auxiliary buffer to hold the transposed data when needed.
@@ -12,8 +12,10 @@
 #include <iostream>
 #include <iomanip>
 
+#include <atomic>
 #include <map>
 #include <stack>
+#include <vector>
 
 #include "blas.hh"
 
@@ -26,6 +28,15 @@ namespace slate {
 /// Allocates workspace blocks for host and GPU devices.
 /// Currently assumes a fixed-size block of block_size bytes,
 /// e.g., block_size = sizeof(scalar_t) * mb * nb.
+///
+/// Host blocks are aligned to a cache line, or to a page for blocks of
+/// at least one page.
+///
+/// Each device, including the host, has one free list per OpenMP thread.
+/// A thread pushes freed blocks onto its own list and pops from its own
+/// list, stealing from other threads' lists only when its list is empty.
+/// Since each list has its own lock, threads allocating tiles on the same
+/// or different devices rarely contend.
 class Memory {
 public:
     friend class Debug;
@@ -41,10 +52,10 @@ public:
     ~Memory();
 
     // todo: change add* to reserve*?
-    void addHostBlocks(int64_t num_blocks) { /* No host pool currently */ }
+    void addHostBlocks(int64_t num_blocks);
     void addDeviceBlocks(int device, int64_t num_blocks, blas::Queue *queue);
 
-    void clearHostBlocks() { /* No host pool currently */ }
+    void clearHostBlocks();
     void clearDeviceBlocks(int device, blas::Queue *queue);
 
     void* alloc(int device, size_t size, blas::Queue *queue);
@@ -54,20 +65,20 @@ public:
     /// which can be host.
     size_t available(int device) const
     {
-        if (device == HostNum)
-            return 0;
-        else
-            return free_blocks_.at(device).size();
+        size_t cnt = 0;
+        for (auto& list : pool( device ).free_lists) {
+            omp_set_lock( &list.lock );
+            cnt += list.blocks.size();
+            omp_unset_lock( &list.lock );
+        }
+        return cnt;
     }
 
     /// @return total number of blocks in device's memory pool,
     /// which can be host.
     size_t capacity(int device) const
     {
-        if (device == HostNum)
-            return 0;
-        else
-            return capacity_.at(device);
+        return pool( device ).capacity;
     }
 
     /// @return total number of allocated blocks from device's memory pool,
@@ -77,12 +88,60 @@ public:
         return capacity(device) - available(device);
     }
 
+    /// @return size in bytes of blocks.
+    size_t blockSize() const
+    {
+        return block_size_;
+    }
+
+    /// @return alignment in bytes of host blocks.
+    size_t hostAlignment() const
+    {
+        return host_alignment_;
+    }
+
     // ----------------------------------------
     // public static variables
     static int num_devices_;
 
 private:
+    //----------------------------------------
+    /// Free list of blocks owned by one thread.
+    /// Padded to a cache line so threads don't falsely share locks.
+    struct alignas(64) FreeList {
+        mutable omp_lock_t lock;
+        std::vector<void*> blocks;
+    };
+
+    //----------------------------------------
+    /// Memory pool for one device, which can be host.
+    struct Pool {
+        // per-thread free lists
+        std::vector< FreeList > free_lists;
+
+        // allocations, protected by lock
+        omp_lock_t lock;
+        std::vector<void*> allocated_mem;
+
+        std::atomic<size_t> capacity;
+    };
+
+    /// @return pool for device, which can be host.
+    Pool& pool(int device)
+    {
+        return pools_.at( device + 1 );
+    }
+
+    Pool const& pool(int device) const
+    {
+        return pools_.at( device + 1 );
+    }
+
     void* allocBlock(int device, blas::Queue *queue);
+    void* popBlock(int device);
+    void  pushBlock(int device, void* block);
+    void  addBlocks(int device, void* mem, int64_t num_blocks, size_t stride);
+    void  clearBlocks(int device, blas::Queue *queue);
 
     void* allocHostMemory(size_t size);
     void* allocDeviceMemory(int device, size_t size, blas::Queue *queue);
@@ -94,10 +153,12 @@ private:
     // member variables
     size_t block_size_;
 
-    // map device number to stack of blocks
-    std::vector< std::stack<void*> > free_blocks_;
-    std::vector< std::stack<void*> > allocated_mem_;
-    std::vector< size_t > capacity_;
+    // host blocks are host_stride_ bytes, aligned to host_alignment_
+    size_t host_alignment_;
+    size_t host_stride_;
+
+    // pools indexed by device + 1, so host is pools_[ 0 ]
+    std::vector< Pool > pools_;
 };
 
 } // namespace slate
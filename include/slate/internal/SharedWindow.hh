@@ -0,0 +1,114 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef SLATE_SHARED_WINDOW_HH
+#define SLATE_SHARED_WINDOW_HH
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "slate/internal/mpi.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Fixed-size slots in an MPI-3 shared-memory window, which all ranks on a
+/// node can read directly. Each rank owns num_slots slots of slot_size bytes
+/// in its segment of the window.
+///
+/// The owner acquires a free slot for a number of readers, fills it, and
+/// sends the slot index to the readers. Readers map the slot into their
+/// address space, and release it when done. The slot becomes free again
+/// once all readers released it. Reader counts are atomics in the window,
+/// so this needs no MPI synchronization besides the slot index message.
+/// Slot indices, and tiles sent instead when no slot is free, are sent on
+/// their own duplicates of the communicator, so they never match other
+/// messages between the same ranks.
+///
+/// Construction and destruction are collective on the communicator.
+///
+class SharedWindow {
+public:
+    SharedWindow(MPI_Comm mpi_comm, size_t slot_size, int64_t num_slots);
+    ~SharedWindow();
+
+    SharedWindow(SharedWindow const& orig) = delete;
+    SharedWindow& operator = (SharedWindow const& orig) = delete;
+
+    /// @return node id of MPI rank, which is the lowest rank in the
+    /// communicator on the same node.
+    int nodeId(int rank) const
+    {
+        return node_ids_[ rank ];
+    }
+
+    /// @return size of slots in bytes.
+    size_t slotSize() const
+    {
+        return slot_size_;
+    }
+
+    /// @return number of slots each rank owns.
+    int64_t numSlots() const
+    {
+        return num_slots_;
+    }
+
+    /// @return communicator for slot index messages.
+    MPI_Comm slotComm() const
+    {
+        return slot_comm_;
+    }
+
+    /// @return communicator for tiles sent when no slot is free.
+    MPI_Comm tileComm() const
+    {
+        return tile_comm_;
+    }
+
+    int64_t acquire(int64_t num_readers);
+    void* data(int rank, int64_t slot) const;
+    bool contains(void const* ptr) const;
+    bool release(void const* ptr);
+    void sync();
+
+private:
+    using Counter = std::atomic<int64_t>;
+
+    static_assert( Counter::is_always_lock_free,
+                   "reader counts must be lock free to be shared by processes" );
+
+    Counter* counters(int node_rank) const
+    {
+        return (Counter*) segments_[ node_rank ];
+    }
+
+    int findSegment(void const* ptr, int64_t* slot) const;
+
+    // ----------------------------------------
+    // member variables
+    size_t slot_size_;
+    size_t slot_stride_;    ///< slot_size_ rounded up to a cache line
+    size_t header_size_;    ///< reader counts, before the slots
+    int64_t num_slots_;
+
+    MPI_Comm node_comm_;
+    MPI_Comm slot_comm_;    ///< duplicate of mpi_comm for slot indices
+    MPI_Comm tile_comm_;    ///< duplicate of mpi_comm for tiles without slot
+    MPI_Win win_;
+    int node_rank_;
+
+    std::vector<int> node_ids_;     ///< node id of each rank in mpi_comm
+    std::vector<int> node_ranks_;   ///< rank in node_comm_ of each rank in
+                                    ///< mpi_comm; MPI_UNDEFINED if off node
+    std::vector<char*> segments_;   ///< base of each node rank's segment
+
+    std::atomic<int64_t> next_slot_;  ///< where acquire starts searching
+};
+
+} // namespace slate
+
+#endif // SLATE_SHARED_WINDOW_HH
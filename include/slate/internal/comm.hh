@@ -11,6 +11,7 @@
 
 #include <list>
 #include <set>
+#include <vector>
 
 #include "slate/internal/mpi.hh"
 
@@ -27,6 +28,13 @@ void cubeBcastPattern(int size, int rank, int radix,
 void cubeReducePattern(int size, int rank, int radix,
                        std::list<int>& recv_from, std::list<int>& send_to);
 
+std::vector<int> commNodeIds(MPI_Comm mpi_comm);
+
+void nodeBcastPattern(std::vector<int> const& ranks,
+                      std::vector<int> const& node_ids,
+                      int rank, int radix,
+                      std::list<int>& recv_from, std::list<int>& send_to);
+
 } // namespace internal
 } // namespace slate
 
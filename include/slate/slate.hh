@@ -475,6 +475,16 @@ norm(
     return norm< TrapezoidMatrix<scalar_t> >( trnorm, A, opts );
 }
 
+//-----------------------------------------
+// norms()
+// several norms in one pass
+template <typename scalar_t>
+void norms(
+    std::vector<Norm> const& in_norms,
+    Matrix<scalar_t>& A,
+    blas::real_type<scalar_t>* values,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // colNorms()
 // all cols max norm
@@ -576,6 +586,12 @@ int64_t getrf(
     Matrix<scalar_t>& A, Pivots& pivots,
     Options const& opts = Options());
 
+template <typename scalar_hi, typename scalar_t>
+int64_t getrf(
+    Matrix<scalar_hi>& A_hi,
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // getrf_nopiv()
 template <typename scalar_t>
@@ -1026,6 +1042,26 @@ void bdsqr(
     Matrix<scalar_t>& VT,
     Options const& opts = Options());
 
+// low-level implementation
+template <typename scalar_t>
+int64_t bdsqr(
+    Uplo uplo, int64_t n, int64_t ncvt, int64_t nru,
+    blas::real_type<scalar_t>* D,
+    blas::real_type<scalar_t>* E,
+    scalar_t* VT, int64_t ldvt,
+    scalar_t* U,  int64_t ldu );
+
+//-----------------------------------------
+// bdsdc()
+template <typename scalar_t>
+void bdsdc(
+    Job jobu, Job jobvt,
+    std::vector< blas::real_type<scalar_t> >& D,
+    std::vector< blas::real_type<scalar_t> >& E,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& VT,
+    Options const& opts = Options());
+
 //------------------------------------------------------------------------------
 // Symmetric/Hermitian eigenvalues
 
@@ -1036,6 +1072,31 @@ void heev(
     Matrix<scalar_t>& Z,
     Options const& opts = Options());
 
+/// With range, compute selected eigenvalues and, optionally, eigenvectors.
+template <typename scalar_t>
+void heev(
+    Range range,
+    blas::real_type<scalar_t> vl, blas::real_type<scalar_t> vu,
+    int64_t il, int64_t iu,
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts = Options());
+
+/// With range, without Z, compute only selected eigenvalues.
+template <typename scalar_t>
+void heev(
+    Range range,
+    blas::real_type<scalar_t> vl, blas::real_type<scalar_t> vu,
+    int64_t il, int64_t iu,
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Options const& opts = Options())
+{
+    Matrix<scalar_t> Z;
+    heev( range, vl, vu, il, iu, A, Lambda, Z, opts );
+}
+
 /// Without Z, compute only eigenvalues.
 template <typename scalar_t>
 void heev(
@@ -1272,6 +1333,27 @@ void unmbr_tb2bd(
     Matrix<scalar_t>& C,
     Options const& opts = Options());
 
+//-----------------------------------------
+// stebz()
+template <typename real_t>
+void stebz(
+    Range range, real_t vl, real_t vu, int64_t il, int64_t iu,
+    std::vector<real_t> const& D,
+    std::vector<real_t> const& E,
+    std::vector<real_t>& Lambda,
+    MPI_Comm mpi_comm,
+    Options const& opts = Options());
+
+//-----------------------------------------
+// stein()
+template <typename scalar_t>
+int64_t stein(
+    std::vector< blas::real_type<scalar_t> > const& D,
+    std::vector< blas::real_type<scalar_t> > const& E,
+    std::vector< blas::real_type<scalar_t> > const& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts = Options());
+
 //-----------------------------------------
 // sterf()
 template <typename scalar_t>
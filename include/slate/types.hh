@@ -46,6 +46,9 @@ public:
     OptionValue(Target t) : i_(int(t))
     {}
 
+    OptionValue( FactorPrecision p ) : i_( int( p ) )
+    {}
+
     //----- Methods, alphabetical
     OptionValue( MethodCholQR m ) : i_( int( m ) )
     {}
@@ -251,6 +254,10 @@ template<> struct OptValueType<Option::Depth>              { using T = int64_t;
 template<> struct OptValueType<Option::MaxIterations>      { using T = int64_t; };
 template<> struct OptValueType<Option::UseFallbackSolver>  { using T = bool; };
 template<> struct OptValueType<Option::PivotThreshold>     { using T = double; };
+template<> struct OptValueType<Option::BcastPackSize>      { using T = int64_t; };
+template<> struct OptValueType<Option::BcastSegmentSize>   { using T = int64_t; };
+template<> struct OptValueType<Option::BcastSharedMemory>  { using T = int64_t; };
+template<> struct OptValueType<Option::FactorPrecision>    { using T = FactorPrecision; };
 template<> struct OptValueType<Option::PrintVerbose>       { using T = int; };
 template<> struct OptValueType<Option::PrintEdgeItems>     { using T = int; };
 template<> struct OptValueType<Option::PrintWidth>         { using T = int; };
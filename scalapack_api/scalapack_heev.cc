@@ -136,7 +136,7 @@ void slate_pheev(const char* jobzstr, const char* uplostr, int n, scalar_t* a, i
     slate::Matrix<scalar_t> Z;
     if (jobz == lapack::Job::Vec) {
         Cblacs_gridinfo(desc_CTXT(descz), &nprow, &npcol, &myprow, &mypcol);
-        Z = slate::Matrix<scalar_t>::fromScaLAPACK(desc_M(descz), desc_N(descz), z, desc_LLD(descz), desc_MB(descz), desc_NB(descz), grid_order, nprow, npcol, MPI_COMM_WORLD);
+        Z = slate_scalapack_matrix(desc_M(descz), desc_N(descz), z, desc_LLD(descz), desc_MB(descz), desc_NB(descz), grid_order, nprow, npcol, MPI_COMM_WORLD);
         Z = slate_scalapack_submatrix(Zm, Zn, Z, iz, jz, descz);
     }
 
@@ -16,6 +16,9 @@ extern "C" void Cblacs_pcoord(int icontxt, int pnum, int* prow, int* pcol);
 extern "C" void Cblacs_get(int icontxt, int what, int* val);
 
 #include <complex>
+#include <list>
+#include <mutex>
+#include <tuple>
 
 namespace slate {
 namespace scalapack_api {
@@ -199,6 +202,125 @@ inline int64_t slate_scalapack_set_lookahead()
     return 1;
 }
 
+inline int64_t slate_scalapack_set_cache_size()
+{
+    // number of matrices kept in the cache; 0 disables it
+    int64_t cache_size = 16;
+    char* cachestr = std::getenv("SLATE_SCALAPACK_CACHE");
+    if (cachestr) {
+        cache_size = std::max( (int64_t)strtol(cachestr, NULL, 0), int64_t(0) );
+    }
+    return cache_size;
+}
+
+inline void slate_scalapack_cache_clear();
+
+// -----------------------------------------------------------------------------
+// Cache of SLATE matrices wrapping the user's ScaLAPACK arrays, keyed by
+// the array pointer and its layout. Legacy codes often call the same routine
+// in a loop on the same arrays; reusing the matrix keeps its tiles map,
+// device tile copies, and workspace memory, instead of rebuilding them on
+// every call. The user may change the array between calls, so on reuse the
+// host tiles are marked as the only valid copies. Least recently used
+// matrices are evicted; all are released in MPI_Finalize.
+template <typename scalar_t>
+class ScaLAPACKMatrixCache {
+public:
+    static ScaLAPACKMatrixCache& get()
+    {
+        static ScaLAPACKMatrixCache cache;
+        return cache;
+    }
+
+    slate::Matrix<scalar_t> matrix(
+        int64_t m, int64_t n, scalar_t* a, int64_t lld, int64_t mb, int64_t nb,
+        slate::GridOrder grid_order, int nprow, int npcol, MPI_Comm comm)
+    {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        if (max_size_ == 0) {
+            return slate::Matrix<scalar_t>::fromScaLAPACK(
+                m, n, a, lld, mb, nb, grid_order, nprow, npcol, comm );
+        }
+
+        auto key = std::make_tuple( a, m, n, lld, mb, nb, grid_order,
+                                    nprow, npcol, comm );
+        for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+            if (iter->first == key) {
+                // Move to front as most recently used.
+                entries_.splice( entries_.begin(), entries_, iter );
+                auto& A = entries_.front().second;
+                for (int64_t j = 0; j < A.nt(); ++j) {
+                    for (int64_t i = 0; i < A.mt(); ++i) {
+                        if (A.tileIsLocal( i, j ))
+                            A.tileModified( i, j, slate::HostNum, true );
+                    }
+                }
+                return A;
+            }
+        }
+
+        if (entries_.empty())
+            register_finalize();
+        entries_.emplace_front(
+            key, slate::Matrix<scalar_t>::fromScaLAPACK(
+                     m, n, a, lld, mb, nb, grid_order, nprow, npcol, comm ) );
+        if (int64_t( entries_.size() ) > max_size_)
+            entries_.pop_back();
+        return entries_.front().second;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        entries_.clear();
+    }
+
+private:
+    ScaLAPACKMatrixCache()
+        : max_size_( slate_scalapack_set_cache_size() )
+    {}
+
+    // Attributes on MPI_COMM_SELF are deleted at the start of MPI_Finalize,
+    // while matrices can still free their MPI resources.
+    static void register_finalize()
+    {
+        static std::once_flag flag;
+        std::call_once( flag, [] {
+            int keyval;
+            MPI_Comm_create_keyval( MPI_COMM_NULL_COPY_FN,
+                                    [](MPI_Comm, int, void*, void*) {
+                                        slate_scalapack_cache_clear();
+                                        return MPI_SUCCESS;
+                                    },
+                                    &keyval, nullptr );
+            MPI_Comm_set_attr( MPI_COMM_SELF, keyval, nullptr );
+        } );
+    }
+
+    using Key = std::tuple< scalar_t*, int64_t, int64_t, int64_t, int64_t,
+                            int64_t, slate::GridOrder, int, int, MPI_Comm >;
+    std::list< std::pair< Key, slate::Matrix<scalar_t> > > entries_;
+    std::mutex mutex_;
+    int64_t max_size_;
+};
+
+inline void slate_scalapack_cache_clear()
+{
+    ScaLAPACKMatrixCache<float>::get().clear();
+    ScaLAPACKMatrixCache<double>::get().clear();
+    ScaLAPACKMatrixCache< std::complex<float> >::get().clear();
+    ScaLAPACKMatrixCache< std::complex<double> >::get().clear();
+}
+
+// -----------------------------------------------------------------------------
+// Returns a SLATE matrix over the ScaLAPACK array, reused from the cache
+// if this array was seen before with the same layout.
+template< typename scalar_t >
+inline slate::Matrix<scalar_t> slate_scalapack_matrix(int64_t m, int64_t n, scalar_t* a, int64_t lld, int64_t mb, int64_t nb, slate::GridOrder grid_order, int nprow, int npcol, MPI_Comm comm)
+{
+    return ScaLAPACKMatrixCache<scalar_t>::get().matrix(m, n, a, lld, mb, nb, grid_order, nprow, npcol, comm);
+}
+
 // -----------------------------------------------------------------------------
 // helper funtion to check and do type conversion
 // TODO: this is duplicated at the testing module
@@ -291,7 +291,7 @@ void Debug::printNumFreeMemBlocks(Memory const& m)
     printf("\n");
     for (int dev = 0; dev < m.num_devices_; ++dev) {
         printf("\tdevice: %d\tfree blocks: %lu\n",
-               dev, m.free_blocks_[dev].size());
+               dev, m.available( dev ));
     }
 }
 
@@ -301,17 +301,17 @@ void Debug::checkHostMemoryLeaks(Memory const& m)
 {
     using llu = long long unsigned;
     if (! debug_) return;
-    if (m.free_blocks_.at( HostNum ).size() < m.capacity_.at( HostNum )) {
+    size_t available = m.available( HostNum );
+    size_t capacity  = m.capacity( HostNum );
+    if (available < capacity) {
         fprintf(stderr,
                 "Error: memory leak: freed %llu of %llu blocks on host\n",
-                (llu) m.free_blocks_.at( HostNum ).size(),
-                (llu) m.capacity_.at( HostNum ));
+                (llu) available, (llu) capacity);
     }
-    else if (m.free_blocks_.at( HostNum ).size() > m.capacity_.at( HostNum )) {
+    else if (available > capacity) {
         fprintf(stderr,
                 "Error: freed too many: %llu of %llu blocks on host\n",
-                (llu) m.free_blocks_.at( HostNum ).size(),
-                (llu) m.capacity_.at( HostNum ));
+                (llu) available, (llu) capacity);
     }
 }
 
@@ -321,17 +321,17 @@ void Debug::checkDeviceMemoryLeaks(Memory const& m, int device)
 {
     using llu = long long unsigned;
     if (! debug_) return;
-    if (m.free_blocks_.at(device).size() < m.capacity_.at(device)) {
+    size_t available = m.available( device );
+    size_t capacity  = m.capacity( device );
+    if (available < capacity) {
         fprintf(stderr,
                 "Error: memory leak: freed %llu of %llu blocks on device %d\n",
-                (llu) m.free_blocks_.at(device).size(),
-                (llu) m.capacity_.at(device), device);
+                (llu) available, (llu) capacity, device);
     }
-    else if (m.free_blocks_.at(device).size() > m.capacity_.at(device)) {
+    else if (available > capacity) {
         fprintf(stderr,
                 "Error: freed too many: %llu of %llu blocks on device %d\n",
-                (llu) m.free_blocks_.at(device).size(),
-                (llu) m.capacity_.at(device), device);
+                (llu) available, (llu) capacity, device);
     }
 }
 
@@ -246,6 +246,7 @@ std::map<std::string, Color> function_color_ = {
     {"slate::device::genorm",    Color::LightSkyBlue},
     {"slate::device::transpose", Color::SkyBlue},
     {"slate::convert_layout",    Color::DeepSkyBlue},
+    {"slate::bdsdc",             Color::DeepSkyBlue},
     {"slate::bdsqr",             Color::DeepSkyBlue},
     {"slate::gatherAll",         Color::RosyBrown},
 
@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+//------------------------------------------------------------------------------
+/// Computes the singular values and, optionally, the right and/or
+/// left singular vectors from the singular value decomposition (SVD) of
+/// a real upper bidiagonal matrix, using the divide and conquer algorithm,
+/// as in LAPACK's `bdsdc`.
+///
+/// This is a serial fallback, not a distributed divide and conquer:
+/// the bidiagonal SVD is computed by LAPACK on rank 0 alone, where the merge
+/// steps are dominated by matrix multiplies that run on multithreaded BLAS;
+/// then the singular vectors are redistributed to U and VT,
+/// which may have any distribution. Other ranks are idle meanwhile,
+/// and rank 0 needs memory for two full n-by-n matrices, plus LAPACK's
+/// workspace, so this doesn't scale to large n. For large problems, use
+/// bdsqr, whose rotations are applied in parallel to distributed rows.
+///
+/// ATTENTION: only host computation supported for now.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+///     The singular vectors of a real bidiagonal matrix are real;
+///     for complex, they are stored with zero imaginary parts.
+//------------------------------------------------------------------------------
+/// @param[in] jobu
+///     Whether to compute the left singular vectors in U.
+///
+/// @param[in] jobvt
+///     Whether to compute the right singular vectors in VT.
+///
+/// @param[in,out] D
+///     On entry, the n diagonal elements of the bidiagonal matrix.
+///     On exit, the singular values in descending order.
+///     D is duplicated on all MPI ranks.
+///
+/// @param[in,out] E
+///     On entry, the n-1 super-diagonal elements of the bidiagonal matrix.
+///     On exit, E has been destroyed.
+///     E is duplicated on all MPI ranks.
+///
+/// @param[out] U
+///     The m-by-n matrix U, m >= n. On exit, if jobu = Vec,
+///     U = [ U1; 0 ] where U1 contains the n left singular vectors.
+///     If jobu = NoVec, not referenced.
+///
+/// @param[out] VT
+///     The n-by-n matrix VT. On exit, if jobvt = Vec, VT contains the
+///     n right singular vectors. If jobvt = NoVec, not referenced.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup svd_computational
+///
+template <typename scalar_t>
+void bdsdc(
+    Job jobu, Job jobvt,
+    std::vector< blas::real_type<scalar_t> >& D,
+    std::vector< blas::real_type<scalar_t> >& E,
+    Matrix<scalar_t>& U,
+    Matrix<scalar_t>& VT,
+    Options const& opts )
+{
+    trace::Block trace_block( "slate::bdsdc" );
+
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0, one = 1.0;
+    const int root = 0;
+    const auto mpi_real_type = mpi_type<real_t>::value;
+
+    int64_t n = D.size();
+
+    bool wantu  = (jobu  == Job::Vec ||
+                   jobu  == Job::AllVec ||
+                   jobu  == Job::SomeVec );
+    bool wantvt = (jobvt == Job::Vec ||
+                   jobvt == Job::AllVec ||
+                   jobvt == Job::SomeVec );
+
+    scalar_t dummy[1];
+    if (! (wantu || wantvt)) {
+        // Singular values only; LAPACK uses dqds for both bdsqr and bdsdc.
+        lapack::bdsqr( Uplo::Upper, n, 0, 0, 0, &D[0], &E[0],
+                       dummy, 1, dummy, 1, dummy, 1 );
+        return;
+    }
+
+    MPI_Comm mpi_comm = wantu ? U.mpiComm() : VT.mpiComm();
+    int mpi_rank;
+    slate_mpi_call(
+        MPI_Comm_rank( mpi_comm, &mpi_rank ) );
+
+    // Serial fallback: rank 0 computes all singular vectors of the
+    // bidiagonal matrix, in O(n^2) memory; other ranks wait in the Bcast.
+    int64_t ld = std::max( n, int64_t( 1 ) );
+    std::vector<scalar_t> U_data, VT_data;
+    if (mpi_rank == root) {
+        std::vector<real_t> Ur( ld*n ), VTr( ld*n );
+        real_t Q[1];
+        int64_t IQ[1];
+        lapack::bdsdc( Uplo::Upper, lapack::CompQ::Vec, n, &D[0], &E[0],
+                       &Ur[0], ld, &VTr[0], ld, Q, IQ );
+        U_data.assign( Ur.begin(), Ur.end() );
+        VT_data.assign( VTr.begin(), VTr.end() );
+    }
+    slate_mpi_call(
+        MPI_Bcast( &D[0], n, mpi_real_type, root, mpi_comm ) );
+
+    // Redistribute from rank 0 to U and VT.
+    if (wantu) {
+        slate_assert( U.m() >= n && U.n() == n );
+        set( zero, one, U, opts );
+        auto U_root = Matrix<scalar_t>::fromLAPACK(
+            n, n, U_data.data(), ld, U.tileMb( 0 ), U.tileNb( 0 ),
+            1, 1, mpi_comm );
+        auto U_11 = U.slice( 0, n-1, 0, n-1 );
+        redistribute( U_root, U_11, opts );
+    }
+    if (wantvt) {
+        slate_assert( VT.m() == n && VT.n() == n );
+        auto VT_root = Matrix<scalar_t>::fromLAPACK(
+            n, n, VT_data.data(), ld, VT.tileMb( 0 ), VT.tileNb( 0 ),
+            1, 1, mpi_comm );
+        redistribute( VT_root, VT, opts );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void bdsdc<float>(
+    Job jobu, Job jobvt,
+    std::vector<float>& D,
+    std::vector<float>& E,
+    Matrix<float>& U,
+    Matrix<float>& VT,
+    Options const& opts);
+
+template
+void bdsdc<double>(
+    Job jobu, Job jobvt,
+    std::vector<double>& D,
+    std::vector<double>& E,
+    Matrix<double>& U,
+    Matrix<double>& VT,
+    Options const& opts);
+
+template
+void bdsdc< std::complex<float> >(
+    Job jobu, Job jobvt,
+    std::vector<float>& D,
+    std::vector<float>& E,
+    Matrix< std::complex<float> >& U,
+    Matrix< std::complex<float> >& VT,
+    Options const& opts);
+
+template
+void bdsdc< std::complex<double> >(
+    Job jobu, Job jobvt,
+    std::vector<double>& D,
+    std::vector<double>& E,
+    Matrix< std::complex<double> >& U,
+    Matrix< std::complex<double> >& VT,
+    Options const& opts);
+
+} // namespace slate
@@ -10,17 +10,143 @@
 #include "internal/internal_util.hh"
 
 #include <atomic>
+#include <tuple>
 
 namespace slate {
 
+//------------------------------------------------------------------------------
+/// Computes the singular values and, optionally, singular vectors of a
+/// real bidiagonal matrix, updating local parts of VT and U, using
+/// the implicit zero-shift QR algorithm, as in LAPACK's `bdsqr`.
+///
+/// To use multiple threads, the columns of VT and rows of U are split into
+/// blocks, and each OpenMP thread runs LAPACK `bdsqr` on its own copy of
+/// D and E, applying the rotation sequences to one block.
+/// Since the rotations depend only on D and E, every thread computes the
+/// same rotations, so the blocks are updated consistently.
+/// This is the same strategy MPI ranks use to update their local rows.
+///
+/// This is the low-level implementation, with similar semantics to LAPACK.
+/// An overloaded higher-level wrapper is available.
+//------------------------------------------------------------------------------
+/// @param[in] uplo
+///     Whether the bidiagonal matrix is upper or lower bidiagonal.
+///
+/// @param[in] n
+///     The order of the bidiagonal matrix. n >= 0.
+///
+/// @param[in] ncvt
+///     The number of columns of VT. ncvt >= 0.
+///
+/// @param[in] nru
+///     The number of rows of U. nru >= 0.
+///
+/// @param[in,out] D
+///     real array, dimension (n)
+///     On entry, the diagonal elements of the bidiagonal matrix.
+///     On exit, if info = 0, the singular values in descending order.
+///
+/// @param[in,out] E
+///     real array, dimension (n-1)
+///     On entry, the off-diagonal elements of the bidiagonal matrix.
+///     On exit, E has been destroyed.
+///
+/// @param[in,out] VT
+///     The n-by-ncvt matrix VT, which is premultiplied by the
+///     right singular vectors, P^H VT.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT. ldvt >= max( 1, n ) if ncvt > 0.
+///
+/// @param[in,out] U
+///     The nru-by-n matrix U, which is postmultiplied by the
+///     left singular vectors, U Q.
+///
+/// @param[in] ldu
+///     The leading dimension of the array U. ldu >= max( 1, nru ).
+///
+/// @return info, as in LAPACK `bdsqr`.
+///
+/// @ingroup svd_computational
+///
+template <typename scalar_t>
+int64_t bdsqr(
+    Uplo uplo, int64_t n, int64_t ncvt, int64_t nru,
+    blas::real_type<scalar_t>* D,
+    blas::real_type<scalar_t>* E,
+    scalar_t* VT, int64_t ldvt,
+    scalar_t* U,  int64_t ldu )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Minimum number of rows or columns per block, so applying the
+    // rotations outweighs computing them redundantly.
+    const int64_t min_block = 32;
+
+    scalar_t dummy[1];
+
+    int64_t nvec = ncvt + nru;
+    int64_t nthreads = omp_get_max_threads();
+    int64_t block = std::max( min_block, ceildiv( nvec, nthreads ) );
+    if (nvec <= block || n <= 1) {
+        return lapack::bdsqr( uplo, n, ncvt, nru, 0, D, E,
+                              VT, ldvt, U, ldu, dummy, 1 );
+    }
+
+    // Blocks of { is_U, begin, size }: columns of VT, then rows of U.
+    // Each block is non-empty, so every call follows the same path in
+    // LAPACK bdsqr (which uses dqds if there are no vectors).
+    std::vector< std::tuple< bool, int64_t, int64_t > > blocks;
+    for (int64_t j = 0; j < ncvt; j += block)
+        blocks.push_back( { false, j, std::min( block, ncvt - j ) } );
+    for (int64_t i = 0; i < nru; i += block)
+        blocks.push_back( { true, i, std::min( block, nru - i ) } );
+
+    std::vector<real_t> D_in( D, D + n );
+    std::vector<real_t> E_in( E, E + n - 1 );
+    int64_t info = 0;
+    int64_t nblocks = blocks.size();
+
+    #pragma omp parallel for schedule( dynamic, 1 ) slate_omp_default_none \
+        shared( blocks, D_in, E_in, info ) \
+        firstprivate( uplo, n, nblocks, D, E, VT, ldvt, U, ldu )
+    for (int64_t b = 0; b < nblocks; ++b) {
+        bool is_U     = std::get<0>( blocks[ b ] );
+        int64_t begin = std::get<1>( blocks[ b ] );
+        int64_t size  = std::get<2>( blocks[ b ] );
+
+        std::vector<real_t> D_b( D_in ), E_b( E_in );
+        scalar_t dummy_b[1];
+        int64_t info_b;
+        if (is_U) {
+            info_b = lapack::bdsqr( uplo, n, 0, size, 0, &D_b[0], &E_b[0],
+                                    dummy_b, 1, &U[ begin ], ldu, dummy_b, 1 );
+        }
+        else {
+            info_b = lapack::bdsqr( uplo, n, size, 0, 0, &D_b[0], &E_b[0],
+                                    &VT[ begin*ldvt ], ldvt, dummy_b, 1,
+                                    dummy_b, 1 );
+        }
+
+        // All blocks compute the same D and E; keep the first.
+        if (b == 0) {
+            std::copy( D_b.begin(), D_b.end(), D );
+            std::copy( E_b.begin(), E_b.end(), E );
+            info = info_b;
+        }
+    }
+    return info;
+}
+
 //------------------------------------------------------------------------------
 /// Computes the singular values and, optionally, the right and/or
 /// left singular vectors from the singular value decomposition (SVD) of
 /// a real (upper or lower) bidiagonal matrix.
+/// U and VT are redistributed to 1D layouts, and each rank updates its
+/// local rows of U and columns of VT in parallel using OpenMP threads.
 /// Generic implementation for any target.
 ///
-/// ATTENTION: only singular values computed for now, no singular vectors.
-/// Only host computation supported for now.
+/// ATTENTION: only host computation supported for now.
 ///
 /// @ingroup svd_computational
 ///
@@ -56,7 +182,6 @@ void bdsqr(
 
     std::vector<scalar_t> u1d(1);
     std::vector<scalar_t> vt1d(1);
-    scalar_t dummy[1];
 
     bool wantu  = (jobu  == Job::Vec ||
                    jobu  == Job::AllVec ||
@@ -100,8 +225,8 @@ void bdsqr(
     }
 
     // Call the SVD
-    lapack::bdsqr(Uplo::Upper, min_mn, ncvt, nru, 0,
-                  &D[0], &E[0], &vt1d[0], min_mn, &u1d[0], ldu, dummy, 1);
+    bdsqr<scalar_t>( Uplo::Upper, min_mn, ncvt, nru,
+                     &D[0], &E[0], &vt1d[0], ldvt, &u1d[0], ldu );
 
     // Redistribute the 1-dim distributed U and VT into 2-dim matrices
     if (wantu) {
@@ -115,6 +240,39 @@ void bdsqr(
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
+int64_t bdsqr<float>(
+    Uplo uplo, int64_t n, int64_t ncvt, int64_t nru,
+    float* D,
+    float* E,
+    float* VT, int64_t ldvt,
+    float* U,  int64_t ldu );
+
+template
+int64_t bdsqr<double>(
+    Uplo uplo, int64_t n, int64_t ncvt, int64_t nru,
+    double* D,
+    double* E,
+    double* VT, int64_t ldvt,
+    double* U,  int64_t ldu );
+
+template
+int64_t bdsqr< std::complex<float> >(
+    Uplo uplo, int64_t n, int64_t ncvt, int64_t nru,
+    float* D,
+    float* E,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* U,  int64_t ldu );
+
+template
+int64_t bdsqr< std::complex<double> >(
+    Uplo uplo, int64_t n, int64_t ncvt, int64_t nru,
+    double* D,
+    double* E,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* U,  int64_t ldu );
+
+//------------------------------------------------------------------------------
+template
 void bdsqr<float>(
     lapack::Job jobu,
     lapack::Job jobvt,
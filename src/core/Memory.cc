@@ -6,20 +6,43 @@
 #include "auxiliary/Debug.hh"
 #include "slate/internal/Memory.hh"
 #include "slate/Exception.hh"
+#include "slate/internal/util.hh"
+
+#include <algorithm>
+#include <new>
 
 namespace slate {
 
 int Memory::num_devices_;
 Memory::StaticConstructor Memory::static_constructor_;
 
+namespace {
+
+// Alignment of host blocks: blocks of at least a page are page aligned,
+// smaller blocks are cache-line aligned.
+const size_t cache_line_size = 64;
+const size_t page_size = 4096;
+
+} // namespace
+
 //------------------------------------------------------------------------------
 /// Construct saves block size, but does not allocate any memory.
+/// Sets up, for host and each device, one free list per OpenMP thread.
 Memory::Memory(size_t block_size):
     block_size_(block_size),
-    free_blocks_( num_devices_ ),
-    allocated_mem_( num_devices_ ),
-    capacity_( num_devices_ )
+    host_alignment_( block_size >= page_size ? page_size : cache_line_size ),
+    host_stride_( roundup( std::max( block_size, size_t( 1 ) ),
+                           host_alignment_ ) ),
+    pools_( num_devices_ + 1 )
 {
+    int num_lists = std::max( omp_get_max_threads(), 1 );
+    for (auto& p : pools_) {
+        p.free_lists.resize( num_lists );
+        for (auto& list : p.free_lists)
+            omp_init_lock( &list.lock );
+        omp_init_lock( &p.lock );
+        p.capacity = 0;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -31,66 +54,76 @@ Memory::~Memory()
     // needed to release memory (and can't be passed in here).  So to
     // release the memory, an explicit clear must called using the
     // queue parameter ( Memory::clearDeviceBlocks(device, *queue) ).
-    //assert(capacity_[ HostNum ] == 0);
     for (int device = 0; device < num_devices_; ++device) {
-        assert(capacity_[ device ] == 0);
+        assert(capacity( device ) == 0);
     }
     // Debug::printNumFreeMemBlocks(*this);
+
+    // Host memory doesn't need a queue, so it is released here.
+    clearHostBlocks();
+
+    for (auto& p : pools_) {
+        for (auto& list : p.free_lists)
+            omp_destroy_lock( &list.lock );
+        omp_destroy_lock( &p.lock );
+    }
 }
 
-/*
 //------------------------------------------------------------------------------
 /// Allocates num_blocks in host memory
 /// and adds them to the pool of free blocks.
 ///
-// todo: merge with addDeviceBlocks by recognizing HostNum?
 void Memory::addHostBlocks(int64_t num_blocks)
 {
-    // or std::byte* (C++17)
-    uint8_t* host_mem;
-    host_mem = (uint8_t*) allocHostMemory(block_size_*num_blocks);
-    capacity_[ HostNum ] += num_blocks;
+    if (num_blocks <= 0)
+        return;
 
-    for (int64_t i = 0; i < num_blocks; ++i)
-        free_blocks_[ HostNum ].push(host_mem + i*block_size_);
+    void* host_mem = allocHostMemory( host_stride_*num_blocks );
+    addBlocks( HostNum, host_mem, num_blocks, host_stride_ );
 }
-*/
 
 //------------------------------------------------------------------------------
 /// Allocates num_blocks in given device's memory
 /// and adds them to the pool of free blocks.
 ///
 void Memory::addDeviceBlocks(int device, int64_t num_blocks, blas::Queue *queue)
+{
+    if (num_blocks <= 0)
+        return;
+
+    void* dev_mem = allocDeviceMemory(device, block_size_*num_blocks, queue);
+    addBlocks( device, dev_mem, num_blocks, block_size_ );
+}
+
+//------------------------------------------------------------------------------
+/// Splits an allocation of num_blocks into blocks and adds them to the
+/// device's free lists, spread round-robin over the threads' lists.
+///
+void Memory::addBlocks(int device, void* mem, int64_t num_blocks, size_t stride)
 {
     // or std::byte* (C++17)
-    uint8_t* dev_mem;
-    dev_mem = (uint8_t*) allocDeviceMemory(device, block_size_*num_blocks, queue);
-    capacity_[device] += num_blocks;
+    uint8_t* mem_bytes = (uint8_t*) mem;
+    auto& p = pool( device );
+    p.capacity += num_blocks;
 
-    for (int64_t i = 0; i < num_blocks; ++i)
-        free_blocks_[device].push(dev_mem + i*block_size_);
+    int num_lists = p.free_lists.size();
+    for (int64_t i = 0; i < num_blocks; ++i) {
+        auto& list = p.free_lists[ i % num_lists ];
+        omp_set_lock( &list.lock );
+        list.blocks.push_back( mem_bytes + i*stride );
+        omp_unset_lock( &list.lock );
+    }
 }
 
-/*
 //------------------------------------------------------------------------------
 /// Empties the pool of free blocks of host memory and frees the allocations.
+/// All blocks must have been returned to the pool with free().
 ///
-// todo: merge with clearDeviceBlocks by recognizing HostNum?
 void Memory::clearHostBlocks()
 {
     Debug::checkHostMemoryLeaks(*this);
-
-    while (! free_blocks_[ HostNum ].empty())
-        free_blocks_[ HostNum ].pop();
-
-    while (! allocated_mem_[ HostNum ].empty()) {
-        void* host_mem = allocated_mem_[ HostNum ].top();
-        freeHostMemory( host_mem );
-        allocated_mem_[ HostNum ].pop();
-    }
-    capacity_[ HostNum ] = 0;
+    clearBlocks( HostNum, nullptr );
 }
-*/
 
 //------------------------------------------------------------------------------
 /// Empties the pool of free blocks of given device's memory and frees the
@@ -98,17 +131,33 @@ void Memory::clearHostBlocks()
 ///
 void Memory::clearDeviceBlocks(int device, blas::Queue *queue)
 {
-    while (! free_blocks_[device].empty())
-        free_blocks_[device].pop();
+    Debug::checkDeviceMemoryLeaks(*this, device);
+    clearBlocks( device, queue );
+}
 
-    while (! allocated_mem_[device].empty()) {
-        void* dev_mem = allocated_mem_[device].top();
-        freeDeviceMemory(device, dev_mem, queue);
-        allocated_mem_[device].pop();
+//------------------------------------------------------------------------------
+/// Empties the free lists of given device, which can be host,
+/// and frees the allocations.
+///
+void Memory::clearBlocks(int device, blas::Queue *queue)
+{
+    auto& p = pool( device );
+    for (auto& list : p.free_lists) {
+        omp_set_lock( &list.lock );
+        list.blocks.clear();
+        omp_unset_lock( &list.lock );
     }
-    capacity_[device] = 0;
 
-    Debug::checkDeviceMemoryLeaks(*this, device);
+    omp_set_lock( &p.lock );
+    for (void* mem : p.allocated_mem) {
+        if (device == HostNum)
+            freeHostMemory( mem );
+        else
+            freeDeviceMemory( device, mem, queue );
+    }
+    p.allocated_mem.clear();
+    p.capacity = 0;
+    omp_unset_lock( &p.lock );
 }
 
 //------------------------------------------------------------------------------
@@ -117,26 +166,11 @@ void Memory::clearDeviceBlocks(int device, blas::Queue *queue)
 ///
 void* Memory::alloc(int device, size_t size, blas::Queue* queue)
 {
-    void* block;
+    slate_assert( size <= block_size_ );
 
-    if (device == HostNum) {
-        //block = malloc(size);
-        block = new char[size];
-    }
-    else {
-        slate_assert( size <= block_size_ );
-        // this block for device only
-        #pragma omp critical(slate_memory)
-        {
-            if (free_blocks_[device].size() > 0) {
-                block = free_blocks_[device].top();
-                free_blocks_[device].pop();
-            }
-            else {
-                block = allocBlock(device, queue);
-            }
-        }
-    }
+    void* block = popBlock( device );
+    if (block == nullptr)
+        block = allocBlock( device, queue );
     return block;
 }
 
@@ -146,16 +180,48 @@ void* Memory::alloc(int device, size_t size, blas::Queue* queue)
 ///
 void Memory::free(void* block, int device)
 {
-    if (device == HostNum) {
-        //std::free(block);
-        delete[] (char*)block;
-    }
-    else {
-        #pragma omp critical(slate_memory)
-        {
-            free_blocks_[device].push(block);
+    pushBlock( device, block );
+}
+
+//------------------------------------------------------------------------------
+/// @return a free block of the given device, which can be host,
+/// from the calling thread's free list if possible, else stolen from
+/// another thread's free list, else nullptr.
+///
+void* Memory::popBlock(int device)
+{
+    auto& p = pool( device );
+    int num_lists = p.free_lists.size();
+    int home = omp_get_thread_num() % num_lists;
+
+    // Start with own list, then look at other threads' lists.
+    for (int k = 0; k < num_lists; ++k) {
+        auto& list = p.free_lists[ (home + k) % num_lists ];
+        void* block = nullptr;
+        omp_set_lock( &list.lock );
+        if (! list.blocks.empty()) {
+            block = list.blocks.back();
+            list.blocks.pop_back();
         }
+        omp_unset_lock( &list.lock );
+        if (block != nullptr)
+            return block;
     }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+/// Puts a block onto the calling thread's free list of the given device,
+/// which can be host.
+///
+void Memory::pushBlock(int device, void* block)
+{
+    auto& p = pool( device );
+    int num_lists = p.free_lists.size();
+    auto& list = p.free_lists[ omp_get_thread_num() % num_lists ];
+    omp_set_lock( &list.lock );
+    list.blocks.push_back( block );
+    omp_unset_lock( &list.lock );
 }
 
 //------------------------------------------------------------------------------
@@ -165,29 +231,30 @@ void* Memory::allocBlock(int device, blas::Queue *queue)
 {
     void* block;
     if (device == HostNum)
-        block = allocHostMemory(block_size_);
+        block = allocHostMemory( host_stride_ );
     else
         block = allocDeviceMemory(device, block_size_, queue);
 
-    capacity_[device] += 1;
+    pool( device ).capacity += 1;
     return block;
 }
 
 //------------------------------------------------------------------------------
-/// Allocates host memory of given size.
+/// Allocates host memory of given size, aligned to host_alignment_.
+/// Size must be a multiple of host_alignment_.
 ///
 void* Memory::allocHostMemory(size_t size)
 {
-    slate_not_implemented( "Memory pool currently doesn't handle host memory" );
-    return nullptr;
-    /*
-    void* host_mem;
-    host_mem = malloc(size);
-    assert(host_mem != nullptr);
-    allocated_mem_[ HostNum ].push( host_mem );
+    void* host_mem = std::aligned_alloc( host_alignment_, size );
+    if (host_mem == nullptr)
+        throw std::bad_alloc();
+
+    auto& p = pool( HostNum );
+    omp_set_lock( &p.lock );
+    p.allocated_mem.push_back( host_mem );
+    omp_unset_lock( &p.lock );
 
     return host_mem;
-    */
 }
 
 //------------------------------------------------------------------------------
@@ -196,7 +263,11 @@ void* Memory::allocHostMemory(size_t size)
 void* Memory::allocDeviceMemory(int device, size_t size, blas::Queue *queue)
 {
     void* dev_mem = blas::device_malloc<char>(size, *queue);
-    allocated_mem_[device].push(dev_mem);
+
+    auto& p = pool( device );
+    omp_set_lock( &p.lock );
+    p.allocated_mem.push_back( dev_mem );
+    omp_unset_lock( &p.lock );
 
     return dev_mem;
 }
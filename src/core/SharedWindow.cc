@@ -0,0 +1,235 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/internal/SharedWindow.hh"
+#include "slate/Exception.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/internal/util.hh"
+
+#include <algorithm>
+#include <new>
+
+namespace slate {
+
+namespace {
+
+const size_t cache_line_size = 64;
+
+} // namespace
+
+//------------------------------------------------------------------------------
+/// Allocates the shared window, with num_slots slots of slot_size bytes
+/// owned by each rank. Collective on mpi_comm; all ranks must pass the same
+/// slot_size and num_slots.
+///
+/// @param[in] mpi_comm
+///     MPI communicator. Ranks sharing memory are found with
+///     MPI_Comm_split_type( MPI_COMM_TYPE_SHARED ).
+///
+/// @param[in] slot_size
+///     Size of each slot in bytes.
+///
+/// @param[in] num_slots
+///     Number of slots each rank owns. num_slots >= 0.
+///
+SharedWindow::SharedWindow(
+    MPI_Comm mpi_comm, size_t slot_size, int64_t num_slots)
+    : slot_size_( slot_size ),
+      slot_stride_( roundup( std::max( slot_size, size_t( 1 ) ),
+                             cache_line_size ) ),
+      header_size_( roundup( std::max( num_slots, int64_t( 1 ) )
+                             * sizeof(Counter), cache_line_size ) ),
+      num_slots_( num_slots ),
+      next_slot_( 0 )
+{
+    slate_assert( num_slots >= 0 );
+
+    int mpi_rank, mpi_size;
+    slate_mpi_call(MPI_Comm_rank(mpi_comm, &mpi_rank));
+    slate_mpi_call(MPI_Comm_size(mpi_comm, &mpi_size));
+
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Comm_split_type(mpi_comm, MPI_COMM_TYPE_SHARED, mpi_rank,
+                                MPI_INFO_NULL, &node_comm_));
+        slate_mpi_call(MPI_Comm_dup(mpi_comm, &slot_comm_));
+        slate_mpi_call(MPI_Comm_dup(mpi_comm, &tile_comm_));
+    }
+
+    int node_size;
+    slate_mpi_call(MPI_Comm_rank(node_comm_, &node_rank_));
+    slate_mpi_call(MPI_Comm_size(node_comm_, &node_size));
+
+    // Node id is the lowest rank on the node, as in internal::commNodeIds.
+    int node_id;
+    node_ids_.resize( mpi_size );
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Allreduce(&mpi_rank, &node_id, 1, MPI_INT, MPI_MIN,
+                          node_comm_));
+        slate_mpi_call(
+            MPI_Allgather(&node_id, 1, MPI_INT, node_ids_.data(), 1, MPI_INT,
+                          mpi_comm));
+    }
+
+    // Map ranks in mpi_comm to ranks in node_comm_.
+    std::vector<int> ranks( mpi_size );
+    for (int r = 0; r < mpi_size; ++r)
+        ranks[ r ] = r;
+    node_ranks_.resize( mpi_size );
+    MPI_Group group, node_group;
+    slate_mpi_call(MPI_Comm_group(mpi_comm, &group));
+    slate_mpi_call(MPI_Comm_group(node_comm_, &node_group));
+    slate_mpi_call(
+        MPI_Group_translate_ranks(group, mpi_size, ranks.data(),
+                                  node_group, node_ranks_.data()));
+    slate_mpi_call(MPI_Group_free(&group));
+    slate_mpi_call(MPI_Group_free(&node_group));
+
+    // Each segment has the reader counts, then the slots.
+    MPI_Aint bytes = header_size_ + num_slots * slot_stride_;
+    void* base;
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Win_allocate_shared(bytes, 1, MPI_INFO_NULL, node_comm_,
+                                    &base, &win_));
+        slate_mpi_call(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+    }
+
+    Counter* local = (Counter*) base;
+    for (int64_t s = 0; s < num_slots; ++s)
+        new (&local[ s ]) Counter( 0 );
+
+    // Make the counters visible before any rank reads them.
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(MPI_Win_sync(win_));
+        slate_mpi_call(MPI_Barrier(node_comm_));
+        slate_mpi_call(MPI_Win_sync(win_));
+    }
+
+    segments_.resize( node_size );
+    for (int r = 0; r < node_size; ++r) {
+        MPI_Aint size;
+        int disp_unit;
+        void* ptr;
+        slate_mpi_call(
+            MPI_Win_shared_query(win_, r, &size, &disp_unit, &ptr));
+        segments_[ r ] = (char*) ptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Frees the shared window. Collective on the communicator.
+/// No slots may be in use by any rank.
+SharedWindow::~SharedWindow()
+{
+    #pragma omp critical(slate_mpi)
+    {
+        MPI_Win_unlock_all(win_);
+        MPI_Win_free(&win_);
+        MPI_Comm_free(&node_comm_);
+        MPI_Comm_free(&slot_comm_);
+        MPI_Comm_free(&tile_comm_);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Acquires a free slot owned by this rank. Thread safe.
+///
+/// @param[in] num_readers
+///     Number of readers, each of which must call release() on the slot.
+///     num_readers >= 1.
+///
+/// @return slot index, or -1 if all slots are in use.
+///
+int64_t SharedWindow::acquire(int64_t num_readers)
+{
+    slate_assert( num_readers >= 1 );
+    if (num_slots_ == 0)
+        return -1;
+
+    Counter* cnt = counters( node_rank_ );
+    int64_t start = next_slot_++;
+    for (int64_t k = 0; k < num_slots_; ++k) {
+        int64_t slot = (start + k) % num_slots_;
+        int64_t expected = 0;
+        if (cnt[ slot ].compare_exchange_strong(
+                expected, num_readers, std::memory_order_acquire))
+        {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+/// @return address of slot owned by MPI rank, which must be on this node.
+void* SharedWindow::data(int rank, int64_t slot) const
+{
+    int node_rank = node_ranks_[ rank ];
+    slate_assert( node_rank != MPI_UNDEFINED );
+    slate_assert( 0 <= slot && slot < num_slots_ );
+    return segments_[ node_rank ] + header_size_ + slot * slot_stride_;
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// @return rank in the node communicator owning the slot that contains ptr,
+/// setting slot; or -1 if ptr is not in a slot.
+int SharedWindow::findSegment(void const* ptr, int64_t* slot) const
+{
+    char const* p = (char const*) ptr;
+    for (int r = 0; r < int( segments_.size() ); ++r) {
+        char const* begin = segments_[ r ] + header_size_;
+        char const* end   = begin + num_slots_ * slot_stride_;
+        if (begin <= p && p < end) {
+            *slot = (p - begin) / slot_stride_;
+            return r;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+/// @return whether ptr is in a slot of this window, owned by any rank.
+bool SharedWindow::contains(void const* ptr) const
+{
+    int64_t slot;
+    return findSegment( ptr, &slot ) >= 0;
+}
+
+//------------------------------------------------------------------------------
+/// Releases the slot containing ptr, owned by any rank on this node.
+/// Thread safe.
+///
+/// @return true if ptr was in a slot; false if it isn't in this window.
+///
+bool SharedWindow::release(void const* ptr)
+{
+    int64_t slot;
+    int r = findSegment( ptr, &slot );
+    if (r < 0)
+        return false;
+
+    int64_t readers = counters( r )[ slot ].fetch_sub(
+        1, std::memory_order_release );
+    slate_assert( readers >= 1 );
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Synchronizes the public and private copies of the window. The owner calls
+/// this after filling a slot and before sending its index; readers call it
+/// after receiving the index and before reading the slot.
+void SharedWindow::sync()
+{
+    slate_mpi_call(MPI_Win_sync(win_));
+}
+
+} // namespace slate
@@ -29,8 +29,8 @@ const char* MethodLU_help     = "auto; PPLU or PartialPiv; CALU; NoPiv; RBT; BEA
 const char* MethodEig_help    = "auto; QR (QR iteration); DC (divide & conquer); "
                                 "bisection; MRRR";
 
-const char* MethodSVD_help    = "auto; QR (QR iteration); DC (divide & conquer); "
-                                "bisection";
+const char* MethodSVD_help    = "auto; QR (QR iteration); "
+                                "DC (LAPACK bdsdc on rank 0); bisection";
 
 const char* NormScope_help    = "m or matrix; c, cols, or columns; r or rows";
 
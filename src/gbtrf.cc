@@ -45,6 +45,15 @@ int64_t gbtrf(
     int64_t max_panel_threads  = std::max(omp_get_max_threads()/2, 1);
     max_panel_threads = get_option<int64_t>( opts, Option::MaxPanelThreads,
                                              max_panel_threads );
+    // Band panels are only a few tiles tall, so unless the matrix already
+    // sets a pack size, pack tiles up to a full tile into one message per hop.
+    int64_t saved_pack_size = A.bcastPackSize();
+    int64_t default_pack_size = saved_pack_size;
+    if (default_pack_size == 0)
+        default_pack_size = sizeof(scalar_t) * A.tileMb( 0 ) * A.tileNb( 0 );
+    int64_t bcast_pack_size = get_option<int64_t>(
+        opts, Option::BcastPackSize, default_pack_size );
+    A.setBcastPackSize( bcast_pack_size );
 
     int64_t info = 0;
     int64_t A_nt = A.nt();
@@ -229,6 +238,7 @@ int64_t gbtrf(
     // during the solve (gbtrs).
 
     A.releaseWorkspace();
+    A.setBcastPackSize( saved_pack_size );
 
     internal::reduce_info( &info, A.mpiComm() );
     return info;
@@ -291,6 +301,11 @@ int64_t gbtrf(
 ///      Strictness of the pivot selection.  Between 0 and 1 with 1 giving
 ///      partial pivoting and 0 giving no pivoting.  Default 1.
 ///
+///    - Option::BcastPackSize:
+///      Max tile size in bytes for which panel tiles sent to the same ranks
+///      are packed into one message. 0 disables packing.
+///      Default A.bcastPackSize() if set, otherwise the size of tile (0, 0).
+///
 /// @return 0: successful exit
 /// @return i > 0: $U(i,i)$ is exactly zero, where $i$ is a 1-based index.
 ///         The factorization has been completed, but the factor $U$ is exactly
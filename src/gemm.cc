@@ -69,6 +69,11 @@ MethodGemm select_algo( TA& A, TB& B, Options& opts )
 ///           - Auto: let the routine decides [default]
 ///           - gemmA: select gemmA routine
 ///           - gemmC: select gemmC routine
+///         - Option::BcastSharedMemory:
+///           Number of tiles per rank in a node-shared window, through
+///           which ranks on the same node as a tile's owner read
+///           broadcast tiles of A and B without copying them.
+///           0 disables it. Default A.bcastSharedMemory().
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -93,6 +98,13 @@ void gemm(scalar_t alpha, Matrix<scalar_t>& A,
     if (method == MethodGemm::Auto)
         method = select_algo( A, B, tuned_opts );
 
+    int64_t saved_shared_A = A.bcastSharedMemory();
+    int64_t saved_shared_B = B.bcastSharedMemory();
+    A.setBcastSharedMemory(
+        get_option<Option::BcastSharedMemory>( opts, saved_shared_A ) );
+    B.setBcastSharedMemory(
+        get_option<Option::BcastSharedMemory>( opts, saved_shared_B ) );
+
     switch (method) {
         case MethodGemm::A:
             gemmA( alpha, A, B, beta, C, tuned_opts );
@@ -102,6 +114,9 @@ void gemm(scalar_t alpha, Matrix<scalar_t>& A,
             gemmC( alpha, A, B, beta, C, tuned_opts );
             break;
     }
+
+    A.setBcastSharedMemory( saved_shared_A );
+    B.setBcastSharedMemory( saved_shared_B );
 }
 
 //------------------------------------------------------------------------------
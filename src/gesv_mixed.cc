@@ -8,6 +8,7 @@
 #include "slate/Matrix.hh"
 #include "internal/internal.hh"
 #include "internal/internal_util.hh"
+#include "internal/internal_lowprec.hh"
 
 namespace slate {
 
@@ -94,6 +95,26 @@ namespace slate {
 ///     - Option::UseFallbackSolver:
 ///       If true and iterative refinement fails to converge, the problem is
 ///       resolved with partial-pivoted LU. Default true
+///     - Option::FactorPrecision:
+///       Storage precision of the low-precision LU factor. Possible values:
+///       - Single:   keep the single precision factor [default].
+///       - Half:     store the factor in fp16 after getrf.
+///       - BFloat16: store the factor in bfloat16 after getrf.
+///       The factorization is done in single precision either way, so
+///       its peak memory and communication are unchanged. Storing the
+///       factor in 16 bits saves memory only during refinement, after the
+///       single precision factor is freed. The 16-bit factor is applied
+///       in single precision on the host, and refinement recovers the
+///       accuracy.
+///     - Option::FusedConversion:
+///       If true, A is converted to low precision within getrf, one tile
+///       column at a time ahead of the panels that use it, instead of in a
+///       separate pass before getrf, so the conversion overlaps with the
+///       first panels. It does not lower peak memory: the trailing update
+///       of the first step writes every tile, so all of the low precision
+///       copy is allocated by then. Only partial pivoting on host targets
+///       is fused; with Target::Devices, or MethodLU::CALU or NoPiv,
+///       A is converted in a separate pass as before. Default false.
 ///
 /// @return 0: successful exit
 /// @return i > 0: $U(i,i)$ is exactly zero, where $i$ is a 1-based index.
@@ -125,6 +146,10 @@ int64_t gesv_mixed(
     int64_t itermax = get_option<int64_t>( opts, Option::MaxIterations, 30 );
     double tol = get_option<double>( opts, Option::Tolerance, eps*std::sqrt(A.m()) );
     bool use_fallback = get_option<int64_t>( opts, Option::UseFallbackSolver, true );
+    FactorPrecision factor_precision = get_option(
+        opts, Option::FactorPrecision, FactorPrecision::Single );
+    bool fused_conversion = get_option<int64_t>(
+        opts, Option::FusedConversion, false );
 
     bool converged = false;
     iter = 0;
@@ -134,6 +159,7 @@ int64_t gesv_mixed(
     // workspace
     auto R    = B.emptyLike();
     auto A_lo = A.template emptyLike<scalar_lo>();
+    internal::LowPrecisionFactor<scalar_lo> A_factor( factor_precision );
     auto X_lo = X.template emptyLike<scalar_lo>();
 
     std::vector<real_hi> colnorms_X( X.n() );
@@ -142,7 +168,9 @@ int64_t gesv_mixed(
     // insert local tiles
     X_lo.insertLocalTiles( target );
     R.   insertLocalTiles( target );
-    A_lo.insertLocalTiles( target );
+    // With fused conversion, getrf inserts the tiles of A_lo.
+    if (! fused_conversion)
+        A_lo.insertLocalTiles( target );
 
     if (target == Target::Devices) {
         #pragma omp parallel
@@ -175,20 +203,33 @@ int64_t gesv_mixed(
     // Convert B from high to low precision, store result in X_lo.
     copy( B, X_lo, opts );
 
-    // Convert A from high to low precision, store result in A_lo.
-    copy( A, A_lo, opts );
-
-    // Compute the LU factorization of A_lo.
+    // Convert A from high to low precision, store result in A_lo,
+    // and compute the LU factorization of A_lo.
     Timer t_getrf_lo;
-    int64_t info = getrf( A_lo, pivots, opts );
+    int64_t info;
+    if (fused_conversion) {
+        info = getrf( A, A_lo, pivots, opts );
+    }
+    else {
+        copy( A, A_lo, opts );
+        info = getrf( A_lo, pivots, opts );
+    }
     timers[ "gesv_mixed::getrf_lo" ] = t_getrf_lo.stop();
     if (info != 0) {
         iter = -3;
     }
     else {
+        if (A_factor.compressed()) {
+            // Store the factor in 16 bits and free the single precision copy.
+            Timer t_compress_lo;
+            A_factor.compress( A_lo );
+            A_lo.clear();
+            timers[ "gesv_mixed::compress_lo" ] = t_compress_lo.stop();
+        }
+
         // Solve the system A_lo * X_lo = B_lo.
         Timer t_getrs_lo;
-        getrs( A_lo, pivots, X_lo, opts );
+        A_factor.getrs( A_lo, pivots, X_lo, opts );
         timers[ "gesv_mixed::getrs_lo" ] = t_getrs_lo.stop();
 
         // Convert X_lo to high precision.
@@ -221,7 +262,7 @@ int64_t gesv_mixed(
 
             // Solve the system A_lo * X_lo = R_lo.
             t_getrs_lo.start();
-            getrs( A_lo, pivots, X_lo, opts );
+            A_factor.getrs( A_lo, pivots, X_lo, opts );
             timers[ "gesv_mixed::getrs_lo" ] += t_getrs_lo.stop();
 
             // Convert X_lo back to double precision and update the current iterate.
@@ -8,6 +8,8 @@
 #include "slate/Matrix.hh"
 #include "internal/internal.hh"
 #include "internal/internal_util.hh"
+#include "internal/internal_gmres.hh"
+#include "internal/internal_lowprec.hh"
 
 namespace slate {
 
@@ -32,6 +34,14 @@ namespace slate {
 /// the size of the matrix into account. This might be automated in the future.
 /// Up to now, we always try iterative refinement.
 ///
+/// Multiple right-hand sides are solved together by block GMRES: all
+/// columns share one block Krylov space, so the preconditioner solves and
+/// orthogonalization operate on blocks of nrhs vectors. Each iteration
+/// counts once, whatever nrhs is. Columns of the residual that have
+/// converged, are zero, or depend on other columns (e.g., duplicate
+/// right-hand sides) are deflated from the initial block rather than
+/// causing a fallback.
+///
 /// GMRES-IR process is stopped if iter > itermax or for all the RHS,
 /// $1 \le j \le nrhs$, we have:
 ///     $\norm{r_j}_{inf} < tol \norm{x_j}_{inf} \norm{A}_{inf},$
@@ -99,6 +109,17 @@ namespace slate {
 ///     - Option::UseFallbackSolver:
 ///       If true and iterative refinement fails to converge, the problem is
 ///       resolved with partial-pivoted LU. Default true
+///     - Option::FactorPrecision:
+///       Storage precision of the low-precision LU factor. Possible values:
+///       - Single:   keep the single precision factor [default].
+///       - Half:     store the factor in fp16 after getrf.
+///       - BFloat16: store the factor in bfloat16 after getrf.
+///       The factorization is done in single precision either way, so
+///       its peak memory and communication are unchanged. Storing the
+///       factor in 16 bits saves memory only during refinement, after the
+///       single precision factor is freed. The 16-bit factor is applied
+///       in single precision on the host, and refinement recovers the
+///       accuracy.
 ///
 /// @return 0: successful exit
 /// @return i > 0: $U(i,i)$ is exactly zero, where $i$ is a 1-based index.
@@ -132,6 +153,8 @@ int64_t gesv_mixed_gmres(
     int64_t itermax = get_option<int64_t>( opts, Option::MaxIterations, 30 );
     double tol = get_option<double>( opts, Option::Tolerance, eps*std::sqrt(A.m()) );
     bool use_fallback = get_option<int64_t>( opts, Option::UseFallbackSolver, true );
+    FactorPrecision factor_precision = get_option(
+        opts, Option::FactorPrecision, FactorPrecision::Single );
     int64_t restart = blas::min( 30, itermax, A.tileMb( 0 )-1 );
 
     bool converged = false;
@@ -140,15 +163,11 @@ int64_t gesv_mixed_gmres(
     assert( B.mt() == A.mt() );
     assert( A.tileMb( 0 ) >= restart );
 
-    // TODO: implement block gmres
-    if (B.n() != 1) {
-        slate_not_implemented( "block-GMRES for multiple RHS is not yet supported" );
-    }
-
     // workspace
     auto R    = B.emptyLike();
     R.insertLocalTiles( target );
     auto A_lo = A.template emptyLike<scalar_lo>();
+    internal::LowPrecisionFactor<scalar_lo> A_factor( factor_precision );
     A_lo.insertLocalTiles( target );
     auto X_lo = X.template emptyLike<scalar_lo>();
     X_lo.insertLocalTiles( target );
@@ -156,26 +175,37 @@ int64_t gesv_mixed_gmres(
     std::vector<real_hi> colnorms_X( X.n() );
     std::vector<real_hi> colnorms_R( R.n() );
 
-    // test basis.  First column corresponds to the residual
-    auto V = internal::alloc_basis( A, restart+1, target );
-    // solution basis.  Columns correspond to those in V. First column is unused
-    auto W = internal::alloc_basis( A, restart+1, target );
-
-    // workspace vector for the orthogonalization process
-    auto z = X.template emptyLike<scalar_hi>();
-    z.insertLocalTiles( target );
-
-    // Hessenberg Matrix. Allocate as a single tile
-    slate::Matrix<scalar_hi> H(
-            restart+1, restart+1, restart+1, 1, 1, A.mpiComm() );
-    H.insertLocalTiles( Target::Host );
-    // least squares RHS. Allocate as a single tile
-    slate::Matrix<scalar_hi> S( restart+1, 1, restart+1, 1, 1, A.mpiComm() );
-    S.insertLocalTiles( Target::Host );
-    // Rotations
-    std::vector<real_hi>   givens_alpha( restart );
-    std::vector<scalar_hi> givens_beta ( restart );
-
+    // Block GMRES: all nrhs right-hand sides share one block Krylov space,
+    // built a block of nrhs vectors at a time. With nrhs = 1, this is
+    // standard GMRES. Blocks are tiled like X, and small matrices are
+    // tiled to match, on one rank.
+    const int64_t nrhs = X.n();
+    const int64_t nt = X.nt();
+    // test basis.  First block corresponds to the residual
+    auto V = internal::alloc_basis( X, restart+1, target );
+    // solution basis.  Blocks correspond to those in V. First block is unused
+    auto W = internal::alloc_basis( X, restart+1, target );
+
+    // Block Hessenberg matrix and least squares RHS
+    auto H = internal::alloc_block_workspace( X, restart+1, restart );
+    auto S = internal::alloc_block_workspace( X, restart, 1 );
+    // workspace for the orthogonalization process
+    auto Z = internal::alloc_block_workspace( X, restart, 1 );
+    // workspace for the block QR, and its R factor
+    auto G = internal::alloc_block_workspace( X, 1, 1 );
+    auto R_block = internal::alloc_block_workspace( X, 1, 1 );
+
+    // Givens rotations are applied to dense copies of H and S on their rank.
+    const int root = H.tileRank( 0, 0 );
+    const int64_t ldh = (restart+1)*nrhs;
+    std::vector<scalar_hi> H_dense, S_dense;
+    if (mpi_rank == root) {
+        H_dense.resize( ldh*restart*nrhs );
+        S_dense.resize( ldh*nrhs );
+    }
+    // Rotations, nrhs per column of H
+    std::vector<real_hi>   givens_alpha( restart*nrhs*nrhs );
+    std::vector<scalar_hi> givens_beta ( restart*nrhs*nrhs );
 
     if (target == Target::Devices) {
         #pragma omp parallel
@@ -211,10 +241,18 @@ int64_t gesv_mixed_gmres(
         iter = -3;
     }
     else {
+        if (A_factor.compressed()) {
+            // Store the factor in 16 bits and free the single precision copy.
+            Timer t_compress_lo;
+            A_factor.compress( A_lo );
+            A_lo.clear();
+            timers[ "gesv_mixed_gmres::compress_lo" ] = t_compress_lo.stop();
+        }
+
         // Solve the system A * X = B in low precision.
         slate::copy( B, X_lo, opts );
         Timer t_getrs_lo;
-        getrs( A_lo, pivots, X_lo, opts );
+        A_factor.getrs( A_lo, pivots, X_lo, opts );
         timers[ "gesv_mixed_gmres::getrs_lo" ] = t_getrs_lo.stop();
         slate::copy( X_lo, X, opts );
 
@@ -243,45 +281,50 @@ int64_t gesv_mixed_gmres(
 
             // GMRES
 
-            // Compute initial vector
-            auto v0 = V.slice( 0, V.m()-1, 0, 0 );
-            slate::copy( R, v0, opts );
-
-            std::vector<real_hi> arnoldi_residual = { norm( Norm::Fro, v0, opts ) };
-            if (arnoldi_residual[0] == 0) {
+            // Compute initial block, V_0 R_0 = R, deflating converged
+            // and dependent columns of R.
+            auto V0 = V.sub( 0, V.mt()-1, 0, nt-1 );
+            if (! internal::block_deflated_basis(
+                      R, V0, G, R_block, colnorms_R, colnorms_X, cte, iiter,
+                      opts )) {
                 // Solver broke down, but residual is not small enough yet.
                 iter = iiter;
                 converged = false;
                 break;
             }
-            scale( 1.0, arnoldi_residual[0], v0, opts );
-            if (S.tileRank( 0, 0 ) == mpi_rank) {
-                S.tileGetForWriting( 0, 0, LayoutConvert::ColMajor );
-                auto S_00 = S( 0, 0 );
-                S_00.at( 0, 0 ) = arnoldi_residual[0];
-                for (int i = 1; i < S_00.mb(); ++i) {
-                    S_00.at( i, 0 ) = 0.0;
+            std::vector<real_hi> arnoldi_residual( nrhs );
+            if (mpi_rank == root) {
+                std::fill( S_dense.begin(), S_dense.end(), zero );
+                internal::tiles_to_dense( R_block, S_dense.data(), ldh );
+                for (int64_t k = 0; k < nrhs; ++k) {
+                    arnoldi_residual[ k ] = blas::nrm2( nrhs, &S_dense[ k*ldh ], 1 );
                 }
             }
-
+            MPI_Bcast(
+                    arnoldi_residual.data(), arnoldi_residual.size(),
+                    mpi_type<real_hi>::value, root, A.mpiComm() );
 
             // N.B. convergence is detected using norm(X) at the beginning of the
             // outer iteration. Thus, changes in the magnitude of X may lead to
             // excessive restarting or delayed completion.
+            bool breakdown = false;
             int j = 0;
             for (; j < restart && iiter < itermax
                        && ! internal::iterRefConverged(
                                 arnoldi_residual, colnorms_X, cte );
                  ++j, ++iiter) {
-                auto Vj1 = V.slice( 0, V.m()-1, j+1, j+1 );
-                auto Wj1 = W.slice( 0, W.m()-1, j+1, j+1 );
+                // Tile indices of blocks j and j+1.
+                int64_t j0 = j*nt;
+                int64_t j1 = (j+1)*nt;
+                auto Vj1 = V.sub( 0, V.mt()-1, j1, j1+nt-1 );
+                auto Wj1 = W.sub( 0, W.mt()-1, j1, j1+nt-1 );
 
-                auto Vj = V.slice( 0, V.m()-1, j, j );
+                auto Vj = V.sub( 0, V.mt()-1, j0, j1-1 );
 
                 // Wj1 = M^-1 A Vj
                 slate::copy( Vj, X_lo, opts );
                 t_getrs_lo.start();
-                getrs( A_lo, pivots, X_lo, opts );
+                A_factor.getrs( A_lo, pivots, X_lo, opts );
                 timers[ "gesv_mixed_gmres::getrs_lo" ] += t_getrs_lo.stop();
                 slate::copy( X_lo, Wj1, opts );
 
@@ -293,10 +336,10 @@ int64_t gesv_mixed_gmres(
                     opts );
                 timers[ "gesv_mixed_gmres::gemm_hi" ] += t_gemm_hi.stop();
 
-                // orthogonalize w/ CGS2
-                auto V0j = V.slice( 0, V.m()-1, 0, j );
+                // orthogonalize w/ block CGS2
+                auto V0j = V.sub( 0, V.mt()-1, 0, j1-1 );
                 auto V0jT = conj_transpose( V0j );
-                auto Hj = H.slice( 0, j, j, j );
+                auto Hj = H.sub( 0, j1-1, j0, j1-1 );
                 t_gemm_hi.start();
                 gemm<scalar_hi>(
                     one,  V0jT,
@@ -309,62 +352,66 @@ int64_t gesv_mixed_gmres(
                     one,  Vj1,
                     opts );
                 timers[ "gesv_mixed_gmres::gemm_hi" ] += t_gemm_hi.stop();
-                auto zj = z.slice( 0, j, 0, 0 );
+                auto Zj = Z.sub( 0, j1-1, 0, nt-1 );
                 t_gemm_hi.start();
                 gemm<scalar_hi>(
                     one,  V0jT,
                           Vj1,
-                    zero, zj,
+                    zero, Zj,
                     opts );
                 gemm<scalar_hi>(
                     -one, V0j,
-                          zj,
+                          Zj,
                     one,  Vj1,
                     opts );
                 timers[ "gesv_mixed_gmres::gemm_hi" ] += t_gemm_hi.stop();
                 Timer t_add_hi;
-                add( one, zj, one, Hj, opts );
+                add( one, Zj, one, Hj, opts );
                 timers[ "gesv_mixed_gmres::add_hi" ] += t_add_hi.stop();
-                auto Vj1_norm = norm( Norm::Fro, Vj1, opts );
-                scale( 1.0, Vj1_norm, Vj1, opts );
-                if (H.tileRank( 0, 0 ) == mpi_rank) {
-                    H.tileGetForWriting( 0, 0, LayoutConvert::ColMajor );
-                    auto H_00 = H( 0, 0 );
-                    H_00.at( j+1, j ) = Vj1_norm;
+
+                // Vj1 H(j+1, j) = Vj1, with H(j+1, j) upper triangular.
+                if (! internal::block_orthonormalize( Vj1, G, R_block, opts )) {
+                    // Krylov space is exhausted; drop block j and restart.
+                    breakdown = true;
+                    break;
                 }
+                auto Hj1j = H.sub( j1, j1+nt-1, j0, j1-1 );
+                slate::copy( R_block, Hj1j, opts );
 
                 // apply givens rotations
                 Timer t_gesv_mixed_gmres_rotations;
-                if (H.tileRank( 0, 0 ) == mpi_rank) {
-                    auto H_00 = H( 0, 0 );
-                    for (int64_t i = 0; i < j; ++i) {
-                        blas::rot( 1, &H_00.at( i, j ), 1, &H_00.at( i+1, j ), 1,
-                                   givens_alpha[i], givens_beta[i] );
-                    }
-                    scalar_hi H_jj = H_00.at( j, j ), H_j1j = H_00.at( j+1, j );
-                    blas::rotg( &H_jj, & H_j1j, &givens_alpha[j], &givens_beta[j] );
-                    blas::rot( 1, &H_00.at( j, j ), 1, &H_00.at( j+1, j ), 1,
-                               givens_alpha[j], givens_beta[j] );
-                    auto S_00 = S( 0, 0 );
-                    blas::rot( 1, &S_00.at( j, 0 ), 1, &S_00.at( j+1, 0 ), 1,
-                               givens_alpha[j], givens_beta[j] );
-                    arnoldi_residual[0] = cabs1( S_00.at( j+1, 0 ) );
+                if (mpi_rank == root) {
+                    auto Hj_full = H.sub( 0, j1+nt-1, j0, j1-1 );
+                    internal::tiles_to_dense(
+                        Hj_full, &H_dense[ j*nrhs*ldh ], ldh );
+                    internal::block_givens(
+                        j, nrhs, H_dense.data(), ldh, S_dense.data(), ldh,
+                        givens_alpha.data(), givens_beta.data(),
+                        arnoldi_residual.data() );
                 }
                 timers[ "gesv_mixed_gmres::rotations" ] += t_gesv_mixed_gmres_rotations.stop();
                 MPI_Bcast(
                         arnoldi_residual.data(), arnoldi_residual.size(),
-                        mpi_type<scalar_hi>::value, S.tileRank( 0, 0 ),
-                        A.mpiComm() );
+                        mpi_type<real_hi>::value, root, A.mpiComm() );
+            }
+            if (breakdown && j == 0) {
+                // Broke down before extending the basis.
+                iter = iiter;
+                converged = false;
+                break;
             }
             // update X
-            auto H_j = H.slice( 0, j-1, 0, j-1 );
-            auto S_j = S.slice( 0, j-1, 0, 0 );
-            auto H_tri = TriangularMatrix<scalar_hi>(
-                    Uplo::Upper, Diag::NonUnit, H_j );
+            auto S_j = S.sub( 0, j*nt-1, 0, nt-1 );
             Timer t_trsm_hi;
-            trsm( Side::Left, one, H_tri, S_j, opts );
+            if (mpi_rank == root) {
+                blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper,
+                            Op::NoTrans, Diag::NonUnit, j*nrhs, nrhs,
+                            one, H_dense.data(), ldh, S_dense.data(), ldh );
+                internal::dense_to_tiles( S_dense.data(), ldh, S_j );
+            }
             timers[ "gesv_mixed_gmres::trsm_hi" ] += t_trsm_hi.stop();
-            auto W_0j = W.slice( 0, W.m()-1, 1, j ); // first column of W is unused
+            // first block of W is unused
+            auto W_0j = W.sub( 0, W.mt()-1, nt, (j+1)*nt-1 );
             t_gemm_hi.start();
             gemm<scalar_hi>(
                 one, W_0j,
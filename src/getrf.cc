@@ -13,16 +13,45 @@ namespace slate {
 
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// Converts tile columns j1:j2 of A_src to the precision of A, inserting
+/// local tiles of A on the host as they are reached.
+/// @ingroup gesv_impl
+///
+template <typename src_scalar_t, typename scalar_t>
+void getrf_convert_columns(
+    Matrix<src_scalar_t>& A_src, Matrix<scalar_t>& A,
+    int64_t j1, int64_t j2, int priority )
+{
+    int64_t A_mt = A.mt();
+    for (int64_t j = j1; j <= j2; ++j) {
+        for (int64_t i = 0; i < A_mt; ++i) {
+            if (A.tileIsLocal( i, j ) && ! A.tileExists( i, j ))
+                A.tileInsert( i, j );
+        }
+    }
+    internal::copy<Target::HostTask>(
+        A_src.sub( 0, A_mt-1, j1, j2 ), A.sub( 0, A_mt-1, j1, j2 ),
+        priority );
+}
+
 //------------------------------------------------------------------------------
 /// Distributed parallel LU factorization.
 /// Generic implementation for any target.
 /// Panel and lookahead computed on host using Host OpenMP task.
+///
+/// If A_src is given, A is its conversion to a lower precision and its
+/// local tiles need not be inserted yet. Each tile column of A is converted
+/// from A_src by a task ahead of the first task that uses it, so the
+/// conversion overlaps with the first panels instead of being a separate
+/// pass over the matrix.
 /// @ingroup gesv_impl
 ///
-template <Target target, typename scalar_t>
+template <Target target, typename scalar_t, typename src_scalar_t = scalar_t>
 int64_t getrf(
     Matrix<scalar_t>& A, Pivots& pivots,
-    Options const& opts )
+    Options const& opts,
+    Matrix<src_scalar_t>* A_src = nullptr )
 {
     using real_t = blas::real_type<scalar_t>;
     using BcastList = typename Matrix<scalar_t>::BcastList;
@@ -81,6 +110,26 @@ int64_t getrf(
     #pragma omp parallel
     #pragma omp master
     {
+        if (A_src != nullptr) {
+            // Convert the panel and lookahead columns of step 0 one at a
+            // time, and the trailing columns in one task ahead of the
+            // step 0 trailing update, which uses the same dependencies.
+            for (int64_t j = 0; j < 1+lookahead && j < A_nt; ++j) {
+                #pragma omp task depend(inout:column[j]) priority(1)
+                {
+                    getrf_convert_columns( *A_src, A, j, j, priority_1 );
+                }
+            }
+            if (1+lookahead < A_nt) {
+                #pragma omp task depend(inout:column[1+lookahead]) \
+                                 depend(inout:column[A_nt-1])
+                {
+                    getrf_convert_columns( *A_src, A, 1+lookahead, A_nt-1,
+                                           priority_0 );
+                }
+            }
+        }
+
         int64_t kk = 0;  // column index (not block-column)
         for (int64_t k = 0; k < min_mt_nt; ++k) {
 
@@ -355,6 +404,88 @@ int64_t getrf(
     return -3;  // shouldn't happen
 }
 
+//------------------------------------------------------------------------------
+/// Distributed parallel LU factorization of A_hi, converted to the lower
+/// precision of A.
+///
+/// Equivalent to copy( A_hi, A ) followed by getrf( A, pivots, opts ),
+/// but with partial pivoting on the host the conversion of each tile column
+/// is a task of the factorization, so the first panel starts once its
+/// column is converted and the rest of the conversion overlaps with it.
+/// Otherwise, i.e., with Target::Devices or MethodLU::CALU or NoPiv,
+/// A is converted first.
+/// Missing local tiles of A are inserted as needed, so A may be empty on
+/// entry, as from A_hi.emptyLike<scalar_t>(). This saves no memory at the
+/// peak, since the trailing update of step 0 writes every tile of A.
+//------------------------------------------------------------------------------
+/// @tparam scalar_hi
+///     One of double, std::complex<double>.
+///
+/// @tparam scalar_t
+///     One of float, std::complex<float>.
+//------------------------------------------------------------------------------
+/// @param[in] A_hi
+///     The matrix $A$ to be factored, in high precision.
+///     Must have the same tiling and distribution as A.
+///
+/// @param[in,out] A
+///     On entry, empty or with its local tiles inserted.
+///     On exit, the factors $L$ and $U$ of A_hi in low precision.
+///
+/// @param[out] pivots
+///     The pivot indices that define the permutation matrix $P$.
+///
+/// @param[in] opts
+///     Additional options, as for getrf.
+///
+/// @return 0: successful exit
+/// @return i > 0: $U(i,i)$ is exactly zero, where $i$ is a 1-based index.
+///
+/// @ingroup gesv_computational
+///
+template <typename scalar_hi, typename scalar_t>
+int64_t getrf(
+    Matrix<scalar_hi>& A_hi,
+    Matrix<scalar_t>& A, Pivots& pivots,
+    Options const& opts )
+{
+    MethodLU method = get_option<Option::MethodLU>( opts, MethodLU::PartialPiv );
+    Target target = get_option<Option::Target>( opts, Target::HostTask );
+
+    slate_assert( A_hi.mt() == A.mt() );
+    slate_assert( A_hi.nt() == A.nt() );
+
+    if (method == MethodLU::PartialPiv) {
+        switch (target) {
+            case Target::Host:
+            case Target::HostTask:
+                return impl::getrf<Target::HostTask>( A, pivots, opts, &A_hi );
+
+            case Target::HostNest:
+                return impl::getrf<Target::HostNest>( A, pivots, opts, &A_hi );
+
+            case Target::HostBatch:
+                return impl::getrf<Target::HostBatch>( A, pivots, opts, &A_hi );
+
+            case Target::Devices:
+                // Device conversion uses batch arrays of A_hi; convert first.
+                break;
+        }
+    }
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                int device = (target == Target::Devices ? A.tileDevice( i, j )
+                                                        : HostNum);
+                if (! A.tileExists( i, j, device ))
+                    A.tileInsert( i, j, device );
+            }
+        }
+    }
+    copy( A_hi, A, opts );
+    return getrf( A, pivots, opts );
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -377,4 +508,17 @@ int64_t getrf< std::complex<double> >(
     Matrix< std::complex<double> >& A, Pivots& pivots,
     Options const& opts);
 
+// ----------------------------------------
+template
+int64_t getrf<double, float>(
+    Matrix<double>& A_hi,
+    Matrix<float>& A, Pivots& pivots,
+    Options const& opts);
+
+template
+int64_t getrf< std::complex<double>, std::complex<float> >(
+    Matrix< std::complex<double> >& A_hi,
+    Matrix< std::complex<float> >& A, Pivots& pivots,
+    Options const& opts);
+
 } // namespace slate
@@ -10,7 +10,9 @@
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
 
+#include <algorithm>
 #include <atomic>
+#include <set>
 
 namespace slate {
 
@@ -37,11 +39,16 @@ using ProgressVector = std::vector< std::atomic<int64_t> >;
 ///     The step number.
 ///     Steps in each sweep have consecutive numbers.
 ///
+/// @param[in] v_prev
+///     If not null, the Householder vector from the previous step, which
+///     was computed on another rank, instead of reading it from V.
+///
 template <typename scalar_t>
 void hb2st_step(
     HermitianBandMatrix<scalar_t>& A,
     Matrix<scalar_t>& V,
-    int64_t sweep, int64_t step)
+    int64_t sweep, int64_t step,
+    scalar_t* v_prev = nullptr)
 {
     int64_t n = A.n();
     int64_t band = A.bandwidth();
@@ -88,10 +95,14 @@ void hb2st_step(
             if (i < n && j < n) {
                 int64_t m1 = std::min(j+band-1, n-1) - i + 1;
                 int64_t m2 = std::min(i+band-1, n-1) - i + 1;
-                auto V1 = V(0, vindex + (step-1)/2);
+                scalar_t* v1 = v_prev;
+                if (v1 == nullptr) {
+                    auto V1 = V(0, vindex + (step-1)/2);
+                    v1 = &V1.at(vi, vj);
+                }
                 auto V2 = V(0, vindex + (step+1)/2);
                 internal::hebr2<Target::HostTask>(
-                    m1, &V1.at(vi, vj),
+                    m1, v1,
                     m2, &V2.at(vi, vj),
                     A.slice(i, m2 + i - 1,
                             j, m1 + i - 1));
@@ -105,9 +116,13 @@ void hb2st_step(
             j = block*band + 1 + sweep;
             if (i < n && j < n) {
                 int64_t m1 = std::min(i+band-1, n-1) - i + 1;
-                auto V1 = V(0, vindex + step/2);
+                scalar_t* v1 = v_prev;
+                if (v1 == nullptr) {
+                    auto V1 = V(0, vindex + step/2);
+                    v1 = &V1.at(vi, vj);
+                }
                 internal::hebr3<Target::HostTask>(
-                    m1, &V1.at(vi, vj),
+                    m1, v1,
                     A.slice(i, m1 + i - 1));
             }
             break;
@@ -188,6 +203,692 @@ void hb2st_run(
     }
 }
 
+//------------------------------------------------------------------------------
+/// @internal
+/// @return number of steps in sweep.
+///
+inline int64_t hb2st_nsteps( int64_t n, int64_t band, int64_t sweep )
+{
+    return 2*ceildiv( n - 1 - sweep, band ) - 1;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return first column of the block that step of sweep updates,
+/// as in hb2st_step.
+///
+inline int64_t hb2st_col( int64_t band, int64_t sweep, int64_t step )
+{
+    return step == 0 ? sweep : (step/2)*band + 1 + sweep;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return first step of sweep whose block starts at or after col,
+/// or nsteps if there is none. Columns of steps increase with the step.
+///
+inline int64_t hb2st_first_step(
+    int64_t band, int64_t sweep, int64_t col, int64_t nsteps )
+{
+    int64_t step;
+    if (sweep >= col)
+        step = 0;
+    else if (sweep + 1 >= col)
+        step = 1;
+    else
+        step = 2*ceildiv( col - 1 - sweep, band );
+    return std::min( step, nsteps );
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return step that writes Householder vector index, i.e., tile
+/// vindex + index of V. Vector index is read by steps 2*index and
+/// 2*index + 1.
+///
+inline int64_t hb2st_vector_writer( int64_t index )
+{
+    return index == 0 ? 0 : 2*index - 1;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// State of distributed bulge chasing on one rank.
+///
+/// Block columns of the band are distributed in contiguous ranges,
+/// [jb, je) on this rank. A step is run by the rank owning the block column
+/// where its block starts, so each sweep passes from rank to rank.
+/// Steps of this rank near its right edge also update the first block column
+/// of the right neighbor, tiles (je, je) and (je+1, je), which this rank
+/// keeps as workspace. Those tiles are passed back and forth:
+/// - after finishing its steps of a sweep, a rank forwards the tiles and
+///   the Householder vector that the right neighbor's first step reads;
+/// - after finishing its steps of the sweep in block column jb, the right
+///   neighbor returns the tiles.
+/// A rank updates the tiles in sweep s only after they are returned for
+/// sweep s-1, which keeps them consistent, while both ranks chase other
+/// parts of the pipeline.
+///
+template <typename scalar_t>
+struct Hb2stDist {
+    int64_t n, band, nb, nt;
+    MPI_Comm comm;
+    int64_t jb, je;             ///< local block columns [jb, je)
+    int left, right;            ///< neighbor ranks, or -1 if none
+    int64_t nsweeps;            ///< local sweeps [0, nsweeps)
+    int64_t nsweeps_left;       ///< sweeps forwarded from left neighbor
+    int64_t nsweeps_right;      ///< sweeps forwarded to right neighbor
+
+    // For each local sweep.
+    std::vector<int64_t> step_begin;    ///< first local step
+    std::vector<int64_t> step_end;      ///< one past last local step
+    std::vector<int64_t> step_return;   ///< one past last step in col jb
+    std::vector<int64_t> step_right;    ///< first step updating col je
+    ProgressVector progress;
+    std::vector< std::atomic<bool> > busy;
+
+    std::atomic<int64_t> low;           ///< lowest unfinished local sweep
+    std::atomic<int64_t> returned;      ///< last sweep returned from right
+    std::atomic<bool> comm_busy;
+    std::atomic<bool> comm_done;
+    int64_t window;                     ///< sweeps scanned for ready steps
+
+    // Messages; accessed only by the thread holding comm_busy.
+    // Each index is the next sweep to send or receive.
+    int64_t fwd_recv, fwd_send, ret_recv, ret_send;
+    MPI_Request fwd_recv_req, fwd_send_req, ret_recv_req, ret_send_req;
+    std::vector<scalar_t> fwd_recv_buf, fwd_send_buf;
+    std::vector<scalar_t> ret_recv_buf, ret_send_buf;
+
+    /// Ring of Householder vectors from left neighbor, one per sweep.
+    std::vector<scalar_t> vectors;
+    int64_t ring;
+
+    static const int tag_forward = 0;
+    static const int tag_return  = 1;
+
+    /// @return whether this rank finished its steps of sweep.
+    bool done( int64_t sweep ) const
+    {
+        return progress[ sweep ].load() >= step_end[ sweep ] - 1;
+    }
+
+    /// @return Householder vector received for sweep.
+    scalar_t* vector( int64_t sweep )
+    {
+        return &vectors[ (sweep % ring)*band ];
+    }
+};
+
+//------------------------------------------------------------------------------
+/// @internal
+/// @return number of elements in tiles (j, j) and (j+1, j),
+/// which neighbors pass back and forth.
+///
+template <typename scalar_t>
+int64_t hb2st_col_size( HermitianBandMatrix<scalar_t>& A, int64_t j )
+{
+    int64_t size = 0;
+    for (int64_t i = j; i < std::min( j+2, A.mt() ); ++i)
+        size += A.tileMb( i ) * A.tileNb( j );
+    return size;
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Packs tiles (j, j) and (j+1, j) into buffer.
+///
+template <typename scalar_t>
+void hb2st_pack_col(
+    HermitianBandMatrix<scalar_t>& A, int64_t j, scalar_t* buffer )
+{
+    for (int64_t i = j; i < std::min( j+2, A.mt() ); ++i) {
+        auto T = A(i, j);
+        T.pack( buffer );
+        buffer += T.mb() * T.nb();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Unpacks tiles (j, j) and (j+1, j) from buffer.
+///
+template <typename scalar_t>
+void hb2st_unpack_col(
+    HermitianBandMatrix<scalar_t>& A, int64_t j, scalar_t const* buffer )
+{
+    for (int64_t i = j; i < std::min( j+2, A.mt() ); ++i) {
+        auto T = A(i, j);
+        T.unpack( buffer, Layout::ColMajor );
+        buffer += T.mb() * T.nb();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Sets up distributed bulge chasing: finds local steps of each sweep,
+/// inserts workspace tiles of A for fill-in and for the right neighbor's
+/// first block column, and workspace tiles of V for vectors this rank
+/// computes but another rank owns.
+///
+/// @param[in] col_rank
+///     Rank owning each block column of A.
+///
+template <typename scalar_t>
+void hb2st_dist_init(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    std::vector<int> const& col_rank,
+    int thread_size,
+    Hb2stDist<scalar_t>& D)
+{
+    const scalar_t zero = 0.0;
+
+    int mpi_rank = A.mpiRank();
+    int64_t n    = A.n();
+    int64_t band = A.bandwidth();
+    int64_t nb   = A.tileNb( 0 );
+    int64_t nt   = A.nt();
+
+    D.n    = n;
+    D.band = band;
+    D.nb   = nb;
+    D.nt   = nt;
+    D.comm = A.mpiComm();
+
+    D.jb = 0;
+    while (D.jb < nt && col_rank[ D.jb ] != mpi_rank)
+        ++D.jb;
+    D.je = D.jb;
+    while (D.je < nt && col_rank[ D.je ] == mpi_rank)
+        ++D.je;
+    bool has_cols = D.jb < nt;
+    D.left  = has_cols && D.jb > 0  ? col_rank[ D.jb - 1 ] : -1;
+    D.right = has_cols && D.je < nt ? col_rank[ D.je ]     : -1;
+
+    // Sweeps start on this rank or a rank to the left.
+    D.nsweeps       = has_cols ? std::min( D.je*nb, n-1 ) : 0;
+    D.nsweeps_left  = D.left  >= 0 ? std::min( D.jb*nb, n-1 ) : 0;
+    D.nsweeps_right = D.right >= 0 ? D.nsweeps : 0;
+
+    D.step_begin .resize( D.nsweeps );
+    D.step_end   .resize( D.nsweeps );
+    D.step_return.resize( D.nsweeps );
+    D.step_right .resize( D.nsweeps );
+    D.progress = ProgressVector( D.nsweeps );
+    D.busy = std::vector< std::atomic<bool> >( D.nsweeps );
+
+    // Mark tiles of V that local steps write.
+    std::vector<bool> v_written( V.nt(), false );
+    for (int64_t s = 0; s < D.nsweeps; ++s) {
+        int64_t nsteps = hb2st_nsteps( n, band, s );
+        int64_t begin  = hb2st_first_step( band, s, D.jb*nb, nsteps );
+        int64_t end    = D.right >= 0
+                       ? hb2st_first_step( band, s, D.je*nb, nsteps )
+                       : nsteps;
+        D.step_begin[ s ]  = begin;
+        D.step_end[ s ]    = end;
+        D.step_return[ s ] = std::max( begin,
+            hb2st_first_step( band, s, (D.jb + 1)*nb, nsteps ) );
+        // Blocks span at most band + 1 columns.
+        D.step_right[ s ]  = D.right >= 0
+                           ? hb2st_first_step( band, s, D.je*nb - band, nsteps )
+                           : nsteps;
+        D.progress[ s ].store( -1 );
+        D.busy[ s ].store( false );
+
+        // Steps 0, 1, 3, 5, ... write vectors 0, 1, 2, 3, ...
+        int64_t k = s / band;
+        int64_t vindex = k*nt - k*(k - 1)/2;
+        for (int64_t step = begin; step < end; ++step) {
+            if (step == 0 || step % 2 == 1) {
+                int64_t r = vindex + (step + 1)/2;
+                if (r < V.nt())
+                    v_written[ r ] = true;
+            }
+        }
+    }
+    for (int64_t r = 0; r < V.nt(); ++r) {
+        if (v_written[ r ] && ! V.tileIsLocal( 0, r )) {
+            auto T = V.tileInsertWorkspace( 0, r );
+            lapack::laset(
+                lapack::MatrixType::General, T.mb(), T.nb(),
+                zero, zero, T.data(), T.stride() );
+        }
+    }
+
+    // Insert workspace tiles needed for fill-in in bulge chasing
+    // and set tile entries outside the band to 0, as in hb2st.
+    // Steps in block column j update tiles (j:j+2, j:j+1).
+    for (int64_t j = D.jb; j < D.je; ++j) {
+        auto Ajj = A(j, j);
+        Ajj.uplo( Uplo::Upper );
+        tile::tzset( zero, Ajj );
+
+        if (j+1 < nt) {
+            auto Aj1 = A(j+1, j);
+            Aj1.uplo( Uplo::Lower );
+            tile::tzset( zero, Aj1 );
+
+            auto T = A.tileInsertWorkspace( j, j+1 );
+            A.tileModified( j, j+1 );
+            lapack::laset(
+                lapack::MatrixType::General, T.mb(), T.nb(),
+                zero, zero, T.data(), T.stride() );
+        }
+        if (j+2 < nt) {
+            auto T = A.tileInsertWorkspace( j+2, j );
+            A.tileModified( j+2, j );
+            lapack::laset(
+                lapack::MatrixType::General, T.mb(), T.nb(),
+                zero, zero, T.data(), T.stride() );
+        }
+    }
+    // Copy of right neighbor's first block column, received before
+    // the first sweep.
+    if (D.right >= 0) {
+        for (int64_t i = D.je; i < std::min( D.je + 2, nt ); ++i) {
+            A.tileInsertWorkspace( i, D.je );
+        }
+    }
+
+    D.low.store( 0 );
+    D.returned.store( -2 );
+    D.comm_busy.store( false );
+    D.comm_done.store( false );
+    D.window = 4*thread_size + 16;
+
+    D.fwd_recv = 0;
+    D.fwd_send = 0;
+    D.ret_recv = -1;
+    D.ret_send = -1;
+    D.fwd_recv_req = MPI_REQUEST_NULL;
+    D.fwd_send_req = MPI_REQUEST_NULL;
+    D.ret_recv_req = MPI_REQUEST_NULL;
+    D.ret_send_req = MPI_REQUEST_NULL;
+    if (D.left >= 0) {
+        int64_t size = hb2st_col_size( A, D.jb );
+        D.fwd_recv_buf.resize( size + band );
+        D.ret_send_buf.resize( size );
+    }
+    if (D.right >= 0) {
+        int64_t size = hb2st_col_size( A, D.je );
+        D.fwd_send_buf.resize( size + band );
+        D.ret_recv_buf.resize( size );
+    }
+    D.ring = D.window + 2;
+    D.vectors.resize( D.ring*band );
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Progresses messages with neighbors in distributed bulge chasing.
+/// Only one thread at a time does MPI; others return immediately.
+///
+template <typename scalar_t>
+void hb2st_dist_comm(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Hb2stDist<scalar_t>& D)
+{
+    if (D.comm_busy.exchange( true ))
+        return;
+
+    auto mpi_scalar = mpi_type<scalar_t>::value;
+    int64_t n    = D.n;
+    int64_t band = D.band;
+    int flag;
+
+    bool progressed = true;
+    while (progressed) {
+        progressed = false;
+
+        //--------------------
+        // Receive tiles and vector of sweep from left neighbor.
+        // Its vector goes to a slot in the ring that must be free, i.e.,
+        // the sweep ring ago is done and forwarded.
+        if (D.fwd_recv < D.nsweeps_left) {
+            int64_t s = D.fwd_recv;
+            if (D.fwd_recv_req == MPI_REQUEST_NULL) {
+                int64_t s_old = s - D.ring;
+                if (s_old < 0
+                    || (D.done( s_old )
+                        && (D.right < 0 || D.fwd_send > s_old)))
+                {
+                    slate_mpi_call(
+                        MPI_Irecv( D.fwd_recv_buf.data(),
+                                   D.fwd_recv_buf.size(), mpi_scalar,
+                                   D.left, D.tag_forward, D.comm,
+                                   &D.fwd_recv_req ) );
+                }
+            }
+            if (D.fwd_recv_req != MPI_REQUEST_NULL) {
+                slate_mpi_call(
+                    MPI_Test( &D.fwd_recv_req, &flag, MPI_STATUS_IGNORE ) );
+                if (flag) {
+                    int64_t size = D.fwd_recv_buf.size() - band;
+                    hb2st_unpack_col( A, D.jb, D.fwd_recv_buf.data() );
+                    std::copy( &D.fwd_recv_buf[ size ],
+                               &D.fwd_recv_buf[ size ] + band,
+                               D.vector( s ) );
+                    D.progress[ s ].store( D.step_begin[ s ] - 1 );
+                    ++D.fwd_recv;
+                    progressed = true;
+                }
+            }
+        }
+
+        //--------------------
+        // Receive tiles returned from right neighbor.
+        if (D.right >= 0 && D.ret_recv < D.nsweeps_right) {
+            if (D.ret_recv_req == MPI_REQUEST_NULL) {
+                slate_mpi_call(
+                    MPI_Irecv( D.ret_recv_buf.data(),
+                               D.ret_recv_buf.size(), mpi_scalar,
+                               D.right, D.tag_return, D.comm,
+                               &D.ret_recv_req ) );
+            }
+            slate_mpi_call(
+                MPI_Test( &D.ret_recv_req, &flag, MPI_STATUS_IGNORE ) );
+            if (flag) {
+                hb2st_unpack_col( A, D.je, D.ret_recv_buf.data() );
+                D.returned.store( D.ret_recv );
+                ++D.ret_recv;
+                progressed = true;
+            }
+        }
+
+        //--------------------
+        // Forward tiles and vector of sweep to right neighbor, once local
+        // steps are done and the tiles were returned from the previous sweep.
+        if (D.fwd_send < D.nsweeps_right) {
+            int64_t s = D.fwd_send;
+            slate_mpi_call(
+                MPI_Test( &D.fwd_send_req, &flag, MPI_STATUS_IGNORE ) );
+            if (flag && D.done( s ) && D.returned.load() >= s-1) {
+                int64_t size = D.fwd_send_buf.size() - band;
+                hb2st_pack_col( A, D.je, D.fwd_send_buf.data() );
+
+                // Vector that the right neighbor's first step reads.
+                int64_t step = D.step_end[ s ];
+                if (step < hb2st_nsteps( n, band, s )) {
+                    int64_t index = step / 2;
+                    scalar_t* v;
+                    if (hb2st_vector_writer( index ) >= D.step_begin[ s ]) {
+                        int64_t vj = s % band;
+                        int64_t vi = vj + 1;
+                        int64_t k  = s / band;
+                        int64_t vindex = k*D.nt - k*(k - 1)/2;
+                        auto Vr = V(0, vindex + index);
+                        v = &Vr.at( vi, vj );
+                    }
+                    else {
+                        v = D.vector( s );
+                    }
+                    std::copy( v, v + band, &D.fwd_send_buf[ size ] );
+                }
+                slate_mpi_call(
+                    MPI_Isend( D.fwd_send_buf.data(),
+                               D.fwd_send_buf.size(), mpi_scalar,
+                               D.right, D.tag_forward, D.comm,
+                               &D.fwd_send_req ) );
+                ++D.fwd_send;
+                progressed = true;
+            }
+        }
+
+        //--------------------
+        // Return tiles to left neighbor, initially and after each sweep's
+        // steps in block column jb.
+        if (D.left >= 0 && D.ret_send < D.nsweeps_left) {
+            int64_t s = D.ret_send;
+            slate_mpi_call(
+                MPI_Test( &D.ret_send_req, &flag, MPI_STATUS_IGNORE ) );
+            if (flag
+                && (s < 0
+                    || (D.fwd_recv > s
+                        && D.progress[ s ].load() >= D.step_return[ s ] - 1)))
+            {
+                hb2st_pack_col( A, D.jb, D.ret_send_buf.data() );
+                slate_mpi_call(
+                    MPI_Isend( D.ret_send_buf.data(),
+                               D.ret_send_buf.size(), mpi_scalar,
+                               D.left, D.tag_return, D.comm,
+                               &D.ret_send_req ) );
+                ++D.ret_send;
+                progressed = true;
+            }
+        }
+    }
+
+    // Done when all messages are sent and received.
+    if (D.fwd_recv >= D.nsweeps_left
+        && (D.right < 0 || D.ret_recv >= D.nsweeps_right)
+        && D.fwd_send >= D.nsweeps_right
+        && (D.left < 0 || D.ret_send >= D.nsweeps_left))
+    {
+        slate_mpi_call(
+            MPI_Test( &D.fwd_send_req, &flag, MPI_STATUS_IGNORE ) );
+        int flag2;
+        slate_mpi_call(
+            MPI_Test( &D.ret_send_req, &flag2, MPI_STATUS_IGNORE ) );
+        if (flag && flag2)
+            D.comm_done.store( true );
+    }
+
+    D.comm_busy.store( false );
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Implements multi-threaded, distributed tridiagonal bulge chasing.
+/// This is the main routine that each thread runs. Instead of the static
+/// schedule of hb2st_run, threads pick any ready step among the lowest
+/// unfinished sweeps, since steps wait on messages from neighbors, and
+/// take turns progressing messages.
+///
+template <typename scalar_t>
+void hb2st_dist_run(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    Hb2stDist<scalar_t>& D)
+{
+    int64_t n    = D.n;
+    int64_t band = D.band;
+
+    while (true) {
+        hb2st_dist_comm( A, V, D );
+
+        int64_t low = D.low.load();
+        if (low >= D.nsweeps && D.comm_done.load())
+            break;
+
+        int64_t high = std::min( low + D.window, D.nsweeps );
+        for (int64_t s = low; s < high; ++s) {
+            int64_t step = D.progress[ s ].load() + 1;
+            if (step < D.step_begin[ s ] || step >= D.step_end[ s ])
+                continue;
+
+            // Claim sweep, then check that step is still next and ready.
+            bool expected = false;
+            if (! D.busy[ s ].compare_exchange_strong( expected, true ))
+                continue;
+
+            step = D.progress[ s ].load() + 1;
+            bool ready = step < D.step_end[ s ];
+            if (ready && s > 0) {
+                // Wait until sweep-1 is two tasks ahead, or its local steps
+                // are finished.
+                int64_t depend = std::min( { step+2,
+                                             hb2st_nsteps( n, band, s-1 ) - 1,
+                                             D.step_end[ s-1 ] - 1 } );
+                ready = D.progress[ s-1 ].load() >= depend;
+            }
+            if (ready && step >= D.step_right[ s ]) {
+                // Wait until right neighbor returns its tiles.
+                ready = D.returned.load() >= s-1;
+            }
+            if (ready) {
+                // The first local steps may read the vector from the left.
+                scalar_t* v_prev = nullptr;
+                if (step > 0
+                    && hb2st_vector_writer( step/2 ) < D.step_begin[ s ])
+                {
+                    v_prev = D.vector( s );
+                }
+                hb2st_step( A, V, s, step, v_prev );
+
+                // Mark step as done.
+                D.progress[ s ].store( step );
+            }
+            D.busy[ s ].store( false );
+            if (ready)
+                break;
+        }
+
+        // Advance past finished sweeps.
+        while (low < D.nsweeps && D.done( low )) {
+            if (D.low.compare_exchange_strong( low, low + 1 ))
+                ++low;
+            // else low was updated by another thread.
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Sends each Householder vector to the rank owning its tile of V.
+/// Each rank computed vectors in workspace tiles of V; the ranks owning the
+/// tiles receive the vectors. All ranks compute the same list of messages.
+///
+template <typename scalar_t>
+void hb2st_dist_gatherV(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    std::vector<int> const& col_rank)
+{
+    const int tag_vector = 2;
+
+    int mpi_rank = A.mpiRank();
+    int64_t n    = A.n();
+    int64_t band = A.bandwidth();
+    int64_t nb   = A.tileNb( 0 );
+    int64_t nt   = A.nt();
+
+    std::vector<MPI_Request> requests;
+    for (int64_t k = 0; k*band < n-1; ++k) {
+        int64_t vindex = k*nt - k*(k - 1)/2;
+        for (int64_t index = 0; index < nt - k && vindex + index < V.nt();
+             ++index)
+        {
+            int64_t r = vindex + index;
+            int owner = V.tileRank( 0, r );
+
+            // Runs of consecutive columns computed by the same rank.
+            int64_t vj_begin = 0;
+            int writer_begin = -1;
+            int64_t vj_end = std::min( band, n-1 - k*band );
+            for (int64_t vj = 0; vj <= vj_end; ++vj) {
+                int writer = -1;
+                if (vj < vj_end) {
+                    int64_t s = k*band + vj;
+                    int64_t step = hb2st_vector_writer( index );
+                    if (step < hb2st_nsteps( n, band, s ))
+                        writer = col_rank[ hb2st_col( band, s, step ) / nb ];
+                }
+                if (writer != writer_begin) {
+                    if (writer_begin >= 0 && writer_begin != owner) {
+                        if (mpi_rank == writer_begin) {
+                            requests.push_back( MPI_REQUEST_NULL );
+                            V(0, r).isendVectors(
+                                vj_begin, vj, owner, A.mpiComm(),
+                                tag_vector, &requests.back() );
+                        }
+                        else if (mpi_rank == owner) {
+                            requests.push_back( MPI_REQUEST_NULL );
+                            V(0, r).irecvVectors(
+                                vj_begin, vj, writer_begin, A.mpiComm(),
+                                tag_vector, &requests.back() );
+                        }
+                    }
+                    vj_begin = vj;
+                    writer_begin = writer;
+                }
+            }
+        }
+    }
+    slate_mpi_call(
+        MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE ) );
+
+    for (int64_t r = 0; r < V.nt(); ++r) {
+        if (! V.tileIsLocal( 0, r ) && V.tileExists( 0, r ))
+            V.tileErase( 0, r, AllDevices );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Distributed tridiagonal bulge chasing, where block columns of A are
+/// distributed in contiguous ranges of ranks. Ranks owning block columns
+/// chase bulges, passing each sweep to the next rank; then each rank
+/// sends the Householder vectors it computed to the ranks owning V.
+/// Collective on all ranks in A's communicator.
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void hb2st_dist(
+    HermitianBandMatrix<scalar_t>& A,
+    Matrix<scalar_t>& V,
+    std::vector<int> const& col_rank)
+{
+    const scalar_t zero = 0.0;
+
+    int64_t nt = A.nt();
+
+    slate_error_if( A.uplo() != Uplo::Lower );
+    // Steps in block column j must update only block columns j and j+1.
+    slate_error_if( A.bandwidth() > A.tileNb( 0 ) );
+    std::set<int> ranks;
+    for (int64_t j = 0; j < nt; ++j) {
+        // Tiles in each block column are on one rank.
+        slate_error_if( j+1 < nt && A.tileRank( j+1, j ) != col_rank[ j ] );
+        // Each rank has one range of block columns.
+        if (j == 0 || col_rank[ j ] != col_rank[ j-1 ]) {
+            slate_error_if( ranks.count( col_rank[ j ] ) > 0 );
+            ranks.insert( col_rank[ j ] );
+        }
+    }
+
+    set(zero, V);
+
+    int thread_size = omp_get_max_threads();
+    Hb2stDist<scalar_t> D;
+    hb2st_dist_init( A, V, col_rank, thread_size, D );
+
+    if (D.jb < nt) {
+        // set min number for omp nested active parallel regions
+        slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+        // Threads wait on each other and on messages,
+        // so launch new threads to guarantee progress, as in hb2st.
+        #pragma omp parallel for \
+                    num_threads(thread_size) \
+                    shared(A, V, D)
+        for (int thread_rank = 0; thread_rank < thread_size; ++thread_rank) {
+            hb2st_dist_run( A, V, D );
+        }
+
+        // Release copy of right neighbor's first block column.
+        if (D.right >= 0) {
+            for (int64_t i = D.je; i < std::min( D.je + 2, nt ); ++i) {
+                A.tileErase( i, D.je, AllDevices );
+            }
+        }
+    }
+
+    hb2st_dist_gatherV( A, V, col_rank );
+}
+
 //------------------------------------------------------------------------------
 /// @internal
 /// Reduces a band Hermitian matrix to a tridiagonal matrix using bulge chasing.
@@ -204,6 +905,25 @@ void hb2st(
     int64_t n = A.n();
     int64_t band = A.bandwidth();
 
+    // Rank owning each block column. If the band is distributed,
+    // chase bulges across ranks; otherwise, one rank chases them alone.
+    std::vector<int> col_rank( A.nt() );
+    bool distributed = false;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        col_rank[ j ] = A.tileRank( j, j );
+        distributed = distributed || col_rank[ j ] != col_rank[ 0 ];
+    }
+    if (distributed) {
+        hb2st_dist( A, V, col_rank );
+        A.bandwidth(1);
+        return;
+    }
+    else if (A.nt() > 0 && A.mpiRank() != col_rank[ 0 ]) {
+        // Other ranks have nothing to do.
+        A.bandwidth(1);
+        return;
+    }
+
     ProgressVector progress(n-1);
     for (int64_t i = 0; i < n-1; ++i)
         progress.at(i).store(-1);
@@ -290,6 +1010,15 @@ void hb2st(
 //------------------------------------------------------------------------------
 /// Reduces a band Hermitian matrix to a bidiagonal matrix using bulge chasing.
 ///
+/// If all of A is on one rank, that rank chases the bulges, and only it
+/// needs to call hb2st. Otherwise, A must be lower, its block columns must
+/// be distributed in contiguous ranges of ranks, with each block column on
+/// one rank, and the bandwidth must be at most the block size. Then sweeps are
+/// pipelined across ranks, and each rank sends the Householder vectors it
+/// computes to the ranks owning their tiles in V, which may have any
+/// distribution. In that case, hb2st is collective on all ranks in A's
+/// communicator, which must have their local tiles of V inserted.
+///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///     One of float, double, std::complex<float>, std::complex<double>.
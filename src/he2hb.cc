@@ -12,6 +12,129 @@ namespace slate {
 
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// Returns the ranks with a tile of lower( A ) in block row i or block column i
+/// that is also in a block row or block column in panel_rank_rows. These are
+/// the ranks that compute partial sums of Wi = sum_j Aij Vj in he2hb_hemm,
+/// and that later update their tiles using Wi.
+/// On a p-by-p grid there are at most 2 such ranks; on a p-by-q grid, more.
+///
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+std::set<int> he2hb_W_ranks(
+    HermitianMatrix<scalar_t>& A, int64_t i,
+    std::vector<int64_t> const& panel_rank_rows)
+{
+    std::set<int> ranks;
+    for (int64_t j : panel_rank_rows) {
+        if (i >= j) // lower
+            ranks.insert( A.tileRank( i, j ) );
+        else        // upper
+            ranks.insert( A.tileRank( j, i ) );
+    }
+    return ranks;
+}
+
+//------------------------------------------------------------------------------
+/// Sums partial sums of Wi = sum_j Aij Vj, for i = k+1, ..., nt-1.
+/// Ranks from he2hb_W_ranks send their partial sums to the lowest such rank,
+/// which adds them and sends Wi back, so all of them have Wi.
+/// Uses MPI tag i for Wi, in both directions.
+///
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+void he2hb_reduce_W(
+    HermitianMatrix<scalar_t>& A,
+    HermitianMatrix<scalar_t>& W,
+    int64_t k,
+    std::vector<int64_t> const& panel_rank_rows)
+{
+    const scalar_t one = 1.0;
+    const Layout layout = Layout::ColMajor;
+    const LayoutConvert layoutc = LayoutConvert( layout );
+
+    int mpi_rank = A.mpiRank();
+    int64_t nt = A.nt();
+
+    // Root (lowest rank) for each Wi that this rank takes part in;
+    // -1 if this rank doesn't take part or is the only rank.
+    std::vector<int> roots( nt, -1 );
+    std::vector< std::vector<scalar_t> > buffers;
+    std::vector<int64_t> buffer_rows;
+    std::vector<MPI_Request> requests;
+
+    // Gather partial sums on roots.
+    for (int64_t i = k+1; i < nt; ++i) {
+        std::set<int> ranks = he2hb_W_ranks( A, i, panel_rank_rows );
+        if (ranks.size() < 2 || ranks.count( mpi_rank ) == 0)
+            continue;
+
+        int root = *ranks.begin();
+        roots[ i ] = root;
+        int64_t mb = W.tileMb( i );
+        int64_t nb = W.tileNb( k );
+        if (mpi_rank == root) {
+            for (int rank : ranks) {
+                if (rank != root) {
+                    buffers.push_back( std::vector<scalar_t>( mb*nb ) );
+                    buffer_rows.push_back( i );
+                    Tile<scalar_t> tile( mb, nb, buffers.back().data(), mb,
+                                         HostNum, TileKind::UserOwned, layout );
+                    MPI_Request req;
+                    tile.irecv( rank, A.mpiComm(), layout, i, &req );
+                    requests.push_back( req );
+                }
+            }
+        }
+        else {
+            MPI_Request req;
+            W.tileIsend( i, k, root, i, &req );
+            requests.push_back( req );
+        }
+    }
+    slate_mpi_call(
+        MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE ) );
+    requests.clear();
+
+    for (size_t b = 0; b < buffers.size(); ++b) {
+        int64_t i = buffer_rows[ b ];
+        W.tileGetForWriting( i, k, HostNum, layoutc );
+        auto Wik = W( i, k );
+        for (int64_t jj = 0; jj < Wik.nb(); ++jj) {
+            blas::axpy( Wik.mb(), one, &buffers[ b ][ jj*Wik.mb() ], 1,
+                                       &Wik.at( 0, jj ), 1 );
+        }
+    }
+    buffers.clear();
+
+    // Send sums back.
+    for (int64_t i = k+1; i < nt; ++i) {
+        int root = roots[ i ];
+        if (root < 0)
+            continue;
+
+        if (mpi_rank == root) {
+            std::set<int> ranks = he2hb_W_ranks( A, i, panel_rank_rows );
+            for (int rank : ranks) {
+                if (rank != root) {
+                    MPI_Request req;
+                    W.tileIsend( i, k, rank, i, &req );
+                    requests.push_back( req );
+                }
+            }
+        }
+        else {
+            MPI_Request req;
+            W.tileIrecv( i, k, root, layout, i, &req );
+            requests.push_back( req );
+        }
+    }
+    slate_mpi_call(
+        MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE ) );
+}
+
 //------------------------------------------------------------------------------
 /// Distributed parallel reduction to band for 2-stage Hermitian eigenvalue
 /// decomposition.
@@ -33,7 +156,7 @@ void he2hb(
     using real_t = blas::real_type<scalar_t>;
     using blas::real;
 
-    slate_assert( A.uplo() == Uplo::Lower );  // for now
+    slate_assert( A.uplo() == Uplo::Lower );
 
     // Constants
     const scalar_t zero = 0.0;
@@ -79,8 +202,11 @@ void he2hb(
     // by doing that, all the GPUs will be busy simultaneously,
     // in particular when we call he2hb_hemm,
     // which will improve the performance.
+    // Only nprow is used, which doesn't depend on the grid order.
+    // If A isn't 2D block cyclic, cycle over all block rows.
     A.gridinfo( &grid_order, &nprow, &npcol, &myrow, &mycol );
-    assert( grid_order == GridOrder::Col );  // todo: update for Row
+    if (grid_order == GridOrder::Unknown)
+        nprow = 1;
 
     auto tileNb = A.tileNbFunc();
     auto tileRank = A.tileRankFunc();
@@ -396,6 +522,17 @@ void he2hb(
                                       layout, layoutc, priority_0, queue_0 )
                     {
                         // Compute W = A V T.
+                        // On a p-by-q grid, a rank can contribute to Wi
+                        // for several panel ranks, so clear its Wi first.
+                        for (int64_t i = k+1; i < nt; ++i) {
+                            std::set<int> ranks
+                                = he2hb_W_ranks( A, i, panel_rank_rows );
+                            if (ranks.count( mpi_rank ) > 0) {
+                                W.tileGetForWriting( i, k, HostNum, layoutc );
+                                W( i, k ).set( zero );
+                            }
+                        }
+
                         // 1a. Wi_part = sum_j Aij Vj, local partial sum,
                         // for i = k+1, ..., nt-1 and j = panel_rank_rows.
                         internal::he2hb_hemm<target>(
@@ -404,54 +541,10 @@ void he2hb(
                             W.sub( k+1, nt-1, k, k ),
                             panel_rank_rows_sub );
 
-                        // 1b. Wi = Wi_part1 + Wi_part2.
-                        // At most 2 ranks contribute to each Wi; if I am one,
-                        // exchange partial sum with neighbor and both ranks sum Wi.
-                        #pragma omp taskgroup
-                        for (int64_t i = k+1; i < nt-1; ++i) {
-                            #pragma omp task slate_omp_default_none \
-                                shared( A, W, Wtmp, panel_rank_rows ) \
-                                firstprivate( one, i, k, mpi_rank, layout, layoutc )
-                            {
-                                int rank_lower = -1;
-                                int rank_upper = -1;
-                                for (int64_t j : panel_rank_rows) {
-                                    if (i >= j) { // lower
-                                        rank_lower = A.tileRank( i, j );
-                                    }
-                                    else { // upper
-                                        rank_upper = A.tileRank( j, i );
-                                    }
-                                }
-                                int neighbor = -1;
-                                if (rank_lower == mpi_rank)
-                                    neighbor = rank_upper;
-                                else if (rank_upper == mpi_rank)
-                                    neighbor = rank_lower;
-                                if (neighbor != -1 && neighbor != mpi_rank) {
-                                    Wtmp.tileInsert( i, k );
-                                    int tag_i = i;
-                                    int tag_i1 = i+1;
-                                    W.tileGetForWriting( i, k, HostNum, layoutc );
-                                    MPI_Request req;
-                                    if (neighbor < mpi_rank) {
-                                        W  .tileIsend( i, k, neighbor, tag_i, &req );
-                                        Wtmp.tileRecv( i, k, neighbor, layout, tag_i1 );
-                                    }
-                                    else {
-                                        W  .tileIsend( i, k, neighbor, tag_i1, &req );
-                                        Wtmp.tileRecv( i, k, neighbor, layout, tag_i );
-                                    }
-                                    MPI_Wait( &req, MPI_STATUS_IGNORE );
-                                    auto Wtmp_ik = Wtmp( i, k );
-                                    auto W_ik = W( i, k );
-                                    blas::axpy( W_ik.nb()*W_ik.nb(),
-                                                one, Wtmp_ik.data(), 1,
-                                                        W_ik.data(), 1 );
-                                    Wtmp.tileErase( i, k );
-                                }
-                            }
-                        }
+                        // 1b. Wi = sum of partial sums.
+                        // All ranks that contribute to Wi sum their
+                        // partial sums, so all of them have Wi.
+                        he2hb_reduce_W( A, W, k, panel_rank_rows );
 
                         // 1c. Compute Wi = Wi T, for i = k+1, ..., nt-1.
                         internal::he2hb_trmm<target>(
@@ -460,86 +553,149 @@ void he2hb(
                             W.sub( k+1, nt-1, k, k ),
                             panel_rank_rows_sub );
 
-                        if (A.tileIsLocal( i0, i0 )) {
-                            //--------------------
-                            // This rank has diagonal tiles to update.
-                            // Do 2-sided Hermitian update:
-                            // A = Q^H A Q
-                            //   = (I - V T^H V^H) A (I - V T V^H)
-                            //   = A - V Y^H - Y V^H
-                            // where
-                            // Y = A V T - 0.5 V (T^H V^H (A V T))
-                            //   = W - 0.5 V (T^H V^H W),
-                            // W = A V T from above.
-
-                            // 1d. TVAVT = V^H (A V T) = V^H W.
-                            // todo: potentially do gemm+reduce here (block inner-product)
-                            internal::he2hb_gemm<target>(
-                                one,  conj_transpose( A.sub( k+1, nt-1, k, k ) ),
-                                      W.sub( k+1, nt-1, k, k ),
-                                zero, std::move( TVAVT ),
-                                panel_rank );
-
-                            // 1e. TVAVT = T^H (V^H A V T).
-                            auto T0     = Tlocal.sub( i0, i0, k, k );
-                            auto TVAVT0 = TVAVT;
-
-                            int64_t mb = T0.tileMb( 0 );
-                            int64_t nb = T0.tileNb( 0 );
-                            bool trapezoid = (mb < nb);
-                            if (trapezoid) {
-                                // first mb-by-mb part
-                                T0 = T0.slice( 0, mb-1, 0, mb-1 );
-                                // first mb-by-nb part
-                                TVAVT0 = TVAVT0.slice( 0, mb-1, 0, nb-1 );
+                        //--------------------
+                        // Do 2-sided Hermitian update:
+                        // A = Q^H A Q
+                        //   = (I - V T^H V^H) A (I - V T V^H)
+                        //   = A - V Y^H - Y V^H
+                        // where
+                        // Y = A V T - 0.5 V (T^H V^H (A V T))
+                        //   = W - 0.5 V (T^H V^H W),
+                        // W = A V T from above.
+                        // V is zero outside panel_rank_rows, so Yi = Wi for
+                        // other rows i, and only tiles with both indices in
+                        // panel_rank_rows need Y in both terms.
+                        // On a p-by-p grid, the rank owning A( i0, i0 ) owns
+                        // all those tiles; on a p-by-q grid, several ranks do.
+                        // diag_ranks own diagonal tiles Ajj,
+                        // update_ranks own tiles Aij, for i, j in
+                        // panel_rank_rows.
+                        std::set<int> diag_ranks, update_ranks;
+                        for (int64_t j : panel_rank_rows) {
+                            diag_ranks.insert( A.tileRank( j, j ) );
+                            for (int64_t i : panel_rank_rows) {
+                                if (i >= j)
+                                    update_ranks.insert( A.tileRank( i, j ) );
                             }
-
-                            // todo: move to GPU
-                            auto Tk0 = TriangularMatrix<scalar_t>(
-                                Uplo::Upper, Diag::NonUnit, T0 );
-                            Tk0.tileGetForReading( 0, 0, HostNum, layoutc );
-                            TVAVT0.tileGetForWriting( 0, 0, HostNum, layoutc );
-                            tile::trmm( Side::Left, Diag::NonUnit,
-                                        one, conj_transpose( Tk0( 0, 0 ) ),
-                                             std::move( TVAVT0( 0, 0 ) ) );
-
-                            // 1f. Y = W - 0.5 V TVAVT, with Y in W.
-                            internal::he2hb_gemm<target>(
-                                -half, A.sub( k+1, nt-1, k, k ),
-                                       std::move( TVAVT ),
-                                one,   W.sub( k+1, nt-1, k, k ),
-                                panel_rank );
-
-                            // 2. Update trailing matrix.
-                            // A = A - V Y^H - Y V^H, with Y in W.
-                            internal::her2k<target>(
-                                -one,  A.sub( k+1, nt-1, k, k ),
-                                       W.sub( k+1, nt-1, k, k ),
-                                r_one, A.sub( k+1, nt-1 ),
-                                priority_0, queue_0, layout );
                         }
-                        else { // off-diag
-                            //--------------------
-                            // This rank has only off-diagonal tiles to update (if any).
-                            // Update from left tiles in lower( A( panel_rank_rows, : ) ):
-                            // A = Q^H A
-                            //   = (I - V T^H V^H) A = A - V T^H V^H A
-                            //   = A - V W^H
-                            // Update from right tiles in lower( A( :, panel_rank_rows ) ):
-                            // A = A Q
-                            //   = A (I - V T V^H)   = A - A V T V^H
-                            //   = A - W V^H
-                            // where
-                            // W = A V T from above.
-
-                            // 2. Update trailing matrix.
-                            // A = A - V W^H or A - W V^H.
-                            internal::he2hb_her2k_offdiag_ranks<target>(
-                                -one, A.sub( k+1, nt-1, k, k ),
-                                      W.sub( k+1, nt-1, k, k ),
-                                one,  A.sub( k+1, nt-1 ),
-                                panel_rank_rows_sub );
+                        int root = A.tileRank( i0, i0 );
+                        int tag = nt;  // W used tags k+1, ..., nt-1.
+
+                        if (update_ranks.count( mpi_rank ) > 0) {
+                            // 1d. TVAVT = V^H (A V T) = V^H W
+                            //           = sum_j Vj^H Wj, j in panel_rank_rows.
+                            // Owner of Ajj has Vj and Wj, and adds Vj^H Wj;
+                            // the partial sums are added on root.
+                            if (diag_ranks.count( mpi_rank ) > 0) {
+                                scalar_t beta = zero;
+                                for (int64_t j : panel_rank_rows) {
+                                    if (A.tileIsLocal( j, j )) {
+                                        internal::he2hb_gemm<target>(
+                                            one,  conj_transpose( A.sub( j, j, k, k ) ),
+                                                  W.sub( j, j, k, k ),
+                                            beta, std::move( TVAVT ),
+                                            panel_rank );
+                                        beta = one;
+                                    }
+                                }
+                            }
+
+                            if (mpi_rank == root) {
+                                TVAVT.tileGetForWriting( 0, 0, HostNum, layoutc );
+                                auto TVAVT00 = TVAVT( 0, 0 );
+                                for (int rank : diag_ranks) {
+                                    if (rank != root) {
+                                        Wtmp.tileRecv( 0, 0, rank, layout, tag );
+                                        auto Wtmp00 = Wtmp( 0, 0 );
+                                        for (int64_t jj = 0; jj < Wtmp00.nb(); ++jj) {
+                                            blas::axpy( Wtmp00.mb(), one,
+                                                        &Wtmp00.at( 0, jj ), 1,
+                                                        &TVAVT00.at( 0, jj ), 1 );
+                                        }
+                                        Wtmp.tileErase( 0, 0 );
+                                    }
+                                }
+
+                                // 1e. TVAVT = T^H (V^H A V T).
+                                auto T0     = Tlocal.sub( i0, i0, k, k );
+                                auto TVAVT0 = TVAVT;
+
+                                int64_t mb = T0.tileMb( 0 );
+                                int64_t nb = T0.tileNb( 0 );
+                                bool trapezoid = (mb < nb);
+                                if (trapezoid) {
+                                    // first mb-by-mb part
+                                    T0 = T0.slice( 0, mb-1, 0, mb-1 );
+                                    // first mb-by-nb part
+                                    TVAVT0 = TVAVT0.slice( 0, mb-1, 0, nb-1 );
+                                }
+
+                                // todo: move to GPU
+                                auto Tk0 = TriangularMatrix<scalar_t>(
+                                    Uplo::Upper, Diag::NonUnit, T0 );
+                                Tk0.tileGetForReading( 0, 0, HostNum, layoutc );
+                                TVAVT0.tileGetForWriting( 0, 0, HostNum, layoutc );
+                                tile::trmm( Side::Left, Diag::NonUnit,
+                                            one, conj_transpose( Tk0( 0, 0 ) ),
+                                                 std::move( TVAVT0( 0, 0 ) ) );
+
+                                for (int rank : update_ranks) {
+                                    if (rank != root)
+                                        TVAVT.tileSend( 0, 0, rank, tag );
+                                }
+                            }
+                            else {
+                                if (diag_ranks.count( mpi_rank ) > 0)
+                                    TVAVT.tileSend( 0, 0, root, tag );
+                                TVAVT.tileRecv( 0, 0, root, layout, tag );
+                            }
+
+                            // 1f. Yj = Wj - 0.5 Vj TVAVT, with Y in W,
+                            // for j in panel_rank_rows where this rank has Wj.
+                            for (int64_t j : panel_rank_rows) {
+                                std::set<int> ranks
+                                    = he2hb_W_ranks( A, j, panel_rank_rows );
+                                if (ranks.count( mpi_rank ) > 0) {
+                                    internal::he2hb_gemm<target>(
+                                        -half, A.sub( j, j, k, k ),
+                                               std::move( TVAVT ),
+                                        one,   W.sub( j, j, k, k ),
+                                        panel_rank );
+                                }
+                            }
+
+                            // 2a. Update diagonal tiles.
+                            // Ajj = Ajj - Vj Yj^H - Yj Vj^H, with Y in W.
+                            for (int64_t j : panel_rank_rows) {
+                                if (A.tileIsLocal( j, j )) {
+                                    internal::her2k<target>(
+                                        -one,  A.sub( j, j, k, k ),
+                                               W.sub( j, j, k, k ),
+                                        r_one, A.sub( j, j ),
+                                        priority_0, queue_0, layout );
+                                }
+                            }
                         }
+
+                        //--------------------
+                        // 2b. Update off-diagonal tiles.
+                        // Update from left tiles in lower( A( panel_rank_rows, : ) ):
+                        // A = Q^H A
+                        //   = (I - V T^H V^H) A = A - V T^H V^H A
+                        //   = A - V W^H
+                        // Update from right tiles in lower( A( :, panel_rank_rows ) ):
+                        // A = A Q
+                        //   = A (I - V T V^H)   = A - A V T V^H
+                        //   = A - W V^H
+                        // where
+                        // W = A V T from above, and Wj = Yj for j in
+                        // panel_rank_rows, so tiles with both indices in
+                        // panel_rank_rows get A - V Y^H - Y V^H.
+                        internal::he2hb_her2k_offdiag_ranks<target>(
+                            -one, A.sub( k+1, nt-1, k, k ),
+                                  W.sub( k+1, nt-1, k, k ),
+                            one,  A.sub( k+1, nt-1 ),
+                            panel_rank_rows_sub );
                     }
 
                     // Restore V0.
@@ -645,12 +801,16 @@ void he2hb(
 //------------------------------------------------------------------------------
 /// @param[in,out] A
 ///     On entry, the n-by-n Hermitian matrix $A$.
+///     Any p-by-q process grid is supported.
 ///     On exit:
-///     - [upper is not yet implemented]
-///       If A is upper, the elements Aij for j = i, ..., i+nb,
+///     - If A is upper, the elements Aij for j = i, ..., i+nb,
 ///       represent the Hermitian band matrix B.
 ///       The elements above the nb-th superdiagonal, along with T, represent
-///       the unitary matrix $Q$ as a product of elementary reflectors.
+///       the unitary matrix $Q$ as a product of elementary reflectors,
+///       stored conjugate-transposed, i.e., as rows.
+///       Upper is reduced as the lower matrix $A^H$, stored in a workspace
+///       that has the transposed distribution, so it needs no communication
+///       but uses extra memory for the local tiles of A.
 ///     - If A is lower, the elements Aij for j = i-nb, ..., i,
 ///       represent the Hermitian band matrix B.
 ///       The elements below the nb-th subdiagonal, along with T, represent
@@ -684,6 +844,14 @@ void he2hb(
 {
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
+    if (A.uplo() == Uplo::Upper) {
+        // Reduce lower( A^H ), then copy back to upper( A ).
+        auto AL = internal::hermitian_lower_from_upper( A );
+        he2hb( AL, T, opts );
+        internal::hermitian_upper_from_lower( AL, A );
+        return;
+    }
+
     // HostNest and HostBatch not implemented; use HostTask.
     switch (target) {
         case Target::Host:
@@ -8,6 +8,7 @@
 #include "slate/HermitianMatrix.hh"
 #include "slate/HermitianBandMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 
 namespace slate {
 
@@ -16,37 +17,65 @@ namespace slate {
 /// \[
 ///     A = Z \Lambda Z^H.
 /// \]
-/// Computes all eigenvalues and, optionally, eigenvectors of a
+/// Computes all or selected eigenvalues and, optionally, eigenvectors of a
 /// Hermitian matrix $A$. The matrix $A$ is preliminary reduced to
 /// tridiagonal form using a two-stage approach:
 /// @see he2hb First stage: reduction to band tridiagonal form.
 /// @see hb2st Second stage: reduction from band to tridiagonal form.
 ///
-/// #### Restrictions ####
+/// Selected eigenvalues are found by bisection (stebz) and their
+/// eigenvectors by inverse iteration (stein); only those m columns of Z
+/// (rounded up to whole tiles) are back-transformed.
 ///
-/// Currently requires a **lower triangular** storage Hermitian matrix.
-///
-/// Currently requires a **square MPI process grid** ($p \times p$).
-/// This is because it applies the same QR factorization on the
-/// left ($p$ block-rows) and the right ($p$ block-cols), with a size $p$
-/// reduction tree. We hope to eventually remove this restriction.
+/// A can be lower or upper, on any $p \times q$ MPI process grid.
+/// If A is upper, it is reduced as the lower matrix $A^H$, stored in a
+/// workspace with the transposed distribution, which needs no communication
+/// but uses extra memory for the local tiles of A.
 ///
 //------------------------------------------------------------------------------
 /// @tparam scalar_t
 ///     One of float, double, std::complex<float>, std::complex<double>.
 //------------------------------------------------------------------------------
+/// @param[in] range
+///     - Range::All:   all eigenvalues are found;
+///     - Range::Value: eigenvalues in the half-open interval (vl, vu]
+///                     are found;
+///     - Range::Index: the il-th through iu-th eigenvalues are found.
+///
+/// @param[in] vl
+///     If range = Value, lower bound of the interval. Otherwise, not used.
+///
+/// @param[in] vu
+///     If range = Value, upper bound of the interval, vl < vu.
+///     Otherwise, not used.
+///
+/// @param[in] il
+///     If range = Index, 1-based index of the smallest eigenvalue to find.
+///     Otherwise, not used.
+///
+/// @param[in] iu
+///     If range = Index, 1-based index of the largest eigenvalue to find,
+///     1 <= il <= iu <= n, or il = 1 and iu = 0 if n = 0.
+///     Otherwise, not used.
+///
 /// @param[in] A
 ///     On entry, the $n \times n$ Hermitian matrix $A$.
 ///     On exit, contents are destroyed.
 ///
 /// @param[out] Lambda
-///     The vector Lambda of length $n$.
-///     If successful, the eigenvalues in ascending order.
+///     On exit, resized to the number of eigenvalues found, m
+///     (n if range = All). If successful, the eigenvalues in ascending order.
 ///
 /// @param[out] Z
 ///     On entry, if $Z$ is empty, does not compute eigenvectors.
-///     Otherwise, the $n \times n$ matrix $Z$ to store eigenvectors.
-///     On exit, orthonormal eigenvectors of the matrix $A$.
+///     Otherwise, the $n \times k$ matrix $Z$ to store eigenvectors,
+///     with k = n if range = All, k >= iu - il + 1 if range = Index,
+///     and k >= the number of eigenvalues in (vl, vu] if range = Value.
+///     On exit, the first m columns are orthonormal eigenvectors of the
+///     matrix $A$.
+///     With bisection and inverse iteration, if any eigenvector fails to
+///     converge, throws slate::Exception giving the number that failed,
+///     on all ranks; Lambda then holds the eigenvalues, and Z is undefined.
 ///
 /// @param[in] opts
 ///     Additional options, as map of name = value pairs. Possible options:
@@ -60,11 +89,23 @@ namespace slate {
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::MethodEig:
+///       Tridiagonal eigensolver if range = All. Possible values:
+///       - QR:        QR iteration.
+///       - DC:        Divide and conquer [default].
+///       - Bisection: Bisection and inverse iteration,
+///                    always used if range is Value or Index.
+///       Without eigenvectors, QR and DC use sterf on rank 0, while
+///       Bisection uses parallel bisection (stebz) across all ranks and
+///       threads, which has more flops but scales with the thread count.
 ///
 /// @ingroup heev
 ///
 template <typename scalar_t>
 void heev(
+    Range range,
+    blas::real_type<scalar_t> vl, blas::real_type<scalar_t> vu,
+    int64_t il, int64_t iu,
     HermitianMatrix<scalar_t>& A,
     std::vector< blas::real_type<scalar_t> >& Lambda,
     Matrix<scalar_t>& Z,
@@ -92,14 +133,15 @@ void heev(
     MethodEig method = get_option( opts, Option::MethodEig, MethodEig::DC );
     Target target = get_option( opts, Option::Target, Target::HostTask );
 
-    // Currently he2hb requires lower triangular matrix.
-    slate_assert( A.uplo() == Uplo::Lower );
+    if (A.uplo() == Uplo::Upper) {
+        // Contents of A are destroyed, so solve with lower( A^H ) instead.
+        auto AL = internal::hermitian_lower_from_upper( A );
+        heev( range, vl, vu, il, iu, AL, Lambda, Z, opts );
+        return;
+    }
 
-    // Currently requires square process grid.
-    GridOrder grid_order;
-    int nprow, npcol, myrow, mycol;
-    A.gridinfo( &grid_order, &nprow, &npcol, &myrow, &mycol );
-    slate_assert( nprow == npcol );
+    // Selected eigenvalues use bisection and inverse iteration.
+    bool subset = range != Range::All || method == MethodEig::Bisection;
 
     // Scale matrix to allowable range, if necessary.
     real_t Anorm = norm( Norm::Max, A );
@@ -119,6 +161,10 @@ void heev(
     if (alpha != 1.0) {
         // Scale by sqrt_sml/Anorm or sqrt_big/Anorm.
         scale( alpha, Anorm, A, opts );
+        if (range == Range::Value) {
+            vl *= alpha / Anorm;
+            vu *= alpha / Anorm;
+        }
     }
 
     // 1. Reduce to band form.
@@ -127,43 +173,128 @@ void heev(
     he2hb(A, T, opts);
     timers[ "heev::he2hb" ] = t_he2hb.stop();
 
-    // Copy band.
-    // Currently, gathers band matrix to rank 0.
+    // Copy band, distributing block columns to ranks in contiguous ranges,
+    // so hb2st pipelines bulge chasing across ranks.
+    // Block column j takes part in about j*nb sweeps, so rank p gets
+    // block columns from nt sqrt( p / mpi_size ) to balance the work.
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size(A.mpiComm(), &mpi_size));
+
     int64_t nb = A.tileNb(0);
-    HermitianBandMatrix<scalar_t> Aband(A.uplo(), n, nb, nb, 1, 1, A.mpiComm());
+    int64_t nt = A.nt();
+    std::vector<int> col_rank( nt );
+    for (int64_t j = 0; j < nt; ++j) {
+        double x = (j + 0.5) / nt;
+        col_rank[ j ] = std::min( int( mpi_size * x * x ), mpi_size - 1 );
+    }
+    std::function<int64_t (int64_t j)>
+        tileNb = func::uniform_blocksize( n, nb );
+    std::function<int (func::ij_tuple ij)>
+        tileRank = [col_rank]( func::ij_tuple ij ) {
+            return col_rank[ std::min( std::get<0>( ij ), std::get<1>( ij ) ) ];
+        };
+    std::function<int (func::ij_tuple ij)>
+        tileDevice = []( func::ij_tuple ij ) { return HostNum; };
+
+    HermitianBandMatrix<scalar_t> Aband(
+        A.uplo(), n, nb, tileNb, tileRank, tileDevice, A.mpiComm() );
     Aband.insertLocalTiles();
     Aband.he2hbGather(A);
 
-    // Currently, hb2st and sterf are run on a single node.
     Lambda.resize(n);
     std::vector<real_t> E(n - 1);
-    Matrix<scalar_t> V;
+
     // Matrix to store Householder vectors.
     // Could pack into a lower triangular matrix, but we store each
     // parallelogram in a 2nb-by-nb tile, with nt(nt + 1)/2 tiles.
+    // Each tile is on the rank that computes most of its vectors, i.e.,
+    // the rank that runs the step writing its first vector in hb2st.
     int64_t vm = 2*nb;
-    int64_t nt = A.nt();
     int64_t vn = nt*(nt + 1)/2*nb;
-    V = Matrix<scalar_t>(vm, vn, vm, nb, 1, 1, A.mpiComm());
-    if (A.mpiRank() == 0) {
-        V.insertLocalTiles();
+    std::vector<int> v_rank( nt*(nt + 1)/2, 0 );
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t vindex = k*nt - k*(k - 1)/2;
+        for (int64_t index = 0; index < nt - k; ++index) {
+            // Step 2*index - 1 of sweep k*nb starts in this column.
+            int64_t col = index == 0 ? k*nb : (index - 1)*nb + 1 + k*nb;
+            v_rank[ vindex + index ] = col_rank[ std::min( col/nb, nt-1 ) ];
+        }
+    }
+    std::function<int64_t (int64_t i)>
+        tileMbV = func::uniform_blocksize( vm, vm );
+    std::function<int64_t (int64_t j)>
+        tileNbV = func::uniform_blocksize( vn, nb );
+    std::function<int (func::ij_tuple ij)>
+        tileRankV = [v_rank]( func::ij_tuple ij ) {
+            return v_rank[ std::get<1>( ij ) ];
+        };
+    Matrix<scalar_t> V( vm, vn, tileMbV, tileNbV, tileRankV,
+                        tileDevice, A.mpiComm() );
+    V.insertLocalTiles();
 
-        // 2. Reduce band to real symmetric tri-diagonal.
-        Timer t_hb2st;
-        hb2st(Aband, V, opts);
-        timers[ "heev::hb2st" ] = t_hb2st.stop();
+    // 2. Reduce band to real symmetric tri-diagonal.
+    Timer t_hb2st;
+    hb2st(Aband, V, opts);
+    timers[ "heev::hb2st" ] = t_hb2st.stop();
 
-        // Copy diagonal and super-diagonal to vectors.
-        internal::copyhb2st( Aband, Lambda, E );
+    // Copy diagonal and super-diagonal to vectors.
+    // Each rank copies its block columns; sum to get the whole vectors.
+    internal::copyhb2st( Aband, Lambda, E );
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, &Lambda[0], n, mpi_real_type, MPI_SUM,
+                       A.mpiComm() ));
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, &E[0], n-1, mpi_real_type, MPI_SUM,
+                       A.mpiComm() ));
 
-        Aband.releaseRemoteWorkspace();
-    }
+    Aband.releaseRemoteWorkspace();
 
     // 3. Tri-diagonal eigenvalue solver.
-    if (wantz) {
-        // Bcast the Lambda and E vectors (diagonal and sup/super-diagonal).
-        MPI_Bcast( &Lambda[0], n,   mpi_real_type, 0, A.mpiComm() );
-        MPI_Bcast( &E[0],      n-1, mpi_real_type, 0, A.mpiComm() );
+    if (subset) {
+        // Bisection divides the selected eigenvalues among ranks.
+        Timer t_stev;
+        std::vector<real_t> D = Lambda;
+        stebz( range, vl, vu, il, iu, D, E, Lambda, A.mpiComm(), opts );
+        int64_t m = Lambda.size();
+
+        if (wantz && m > 0) {
+            slate_assert( Z.n() >= m );
+
+            // Back-transform only the tile columns of Z holding the m vectors.
+            int64_t zt = 0;
+            for (int64_t cols = 0; cols < m; ++zt)
+                cols += Z.tileNb( zt );
+            auto Zk = Z.sub( 0, Z.mt()-1, 0, zt-1 );
+
+            Matrix<scalar_t> Z1d( Zk.m(), Zk.n(), Zk.tileMb(0), Zk.tileNb(0),
+                                  1, mpi_size, Zk.mpiComm() );
+            Z1d.insertLocalTiles( target );
+            // stein returns info on all ranks, so all ranks throw.
+            int64_t info = stein( D, E, Lambda, Z1d, opts );
+            if (info > 0) {
+                if (alpha != 1.0)
+                    blas::scal( m, Anorm/alpha, Lambda.data(), 1 );
+                slate_error( std::to_string( info )
+                             + " eigenvectors failed to converge" );
+            }
+            timers[ "heev::stev" ] = t_stev.stop();
+
+            // Back-transform: Z = Q1 * Q2 * Z.
+            Timer t_unmtr_hb2st;
+            unmtr_hb2st( Side::Left, Op::NoTrans, V, Z1d, opts );
+            timers[ "heev::unmtr_hb2st" ] = t_unmtr_hb2st.stop();
+
+            redistribute( Z1d, Zk, opts );
+            Timer t_unmtr_he2hb;
+            unmtr_he2hb( Side::Left, Op::NoTrans, A, T, Zk, opts );
+            timers[ "heev::unmtr_he2hb" ] = t_unmtr_he2hb.stop();
+        }
+        else {
+            timers[ "heev::stev" ] = t_stev.stop();
+        }
+    }
+    else if (wantz) {
         Timer t_stev;
         if (method == MethodEig::QR) {
             // QR iteration to get eigenvalues and eigenvectors of tridiagonal.
@@ -185,11 +316,6 @@ void heev(
         }
         timers[ "heev::stev" ] = t_stev.stop();
 
-        // Find the total number of processors.
-        int mpi_size;
-        slate_mpi_call(
-            MPI_Comm_size(A.mpiComm(), &mpi_size));
-
         Matrix<scalar_t> Z1d(Z.m(), Z.n(), Z.tileNb(0), 1, mpi_size, Z.mpiComm());
         Z1d.insertLocalTiles(target);
         redistribute(Z, Z1d, opts);
@@ -206,6 +332,7 @@ void heev(
     }
     else {
         Timer t_stev;
+        // Parallel bisection is opt-in, with MethodEig::Bisection above.
         if (A.mpiRank() == 0) {
             // QR iteration to get eigenvalues.
             sterf<real_t>( Lambda, E, opts );
@@ -219,11 +346,30 @@ void heev(
     if (alpha != 1.0) {
         // Scale by Anorm/sqrt_sml or Anorm/sqrt_big.
         // todo: deal with not all eigenvalues converging, cf. LAPACK.
-        blas::scal( n, Anorm/alpha, &Lambda[0], 1 );
+        blas::scal( Lambda.size(), Anorm/alpha, Lambda.data(), 1 );
     }
     timers[ "heev" ] = t_heev.stop();
 }
 
+//------------------------------------------------------------------------------
+/// Distributed parallel Hermitian matrix eigen decomposition,
+/// computing all eigenvalues and, optionally, eigenvectors.
+/// @see heev above, with range = All.
+///
+/// @ingroup heev
+///
+template <typename scalar_t>
+void heev(
+    HermitianMatrix<scalar_t>& A,
+    std::vector< blas::real_type<scalar_t> >& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts)
+{
+    using real_t = blas::real_type<scalar_t>;
+    heev( Range::All, real_t( 0 ), real_t( 0 ), 1, A.n(),
+          A, Lambda, Z, opts );
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -233,8 +379,24 @@ void heev<float>(
     Matrix<float>& Z,
     Options const& opts);
 
+template
+void heev<float>(
+    Range range, float vl, float vu, int64_t il, int64_t iu,
+    HermitianMatrix<float>& A,
+    std::vector<float>& Lambda,
+    Matrix<float>& Z,
+    Options const& opts);
+
+template
+void heev<double>(
+    HermitianMatrix<double>& A,
+    std::vector<double>& Lambda,
+    Matrix<double>& Z,
+    Options const& opts);
+
 template
 void heev<double>(
+    Range range, double vl, double vu, int64_t il, int64_t iu,
     HermitianMatrix<double>& A,
     std::vector<double>& Lambda,
     Matrix<double>& Z,
@@ -247,8 +409,24 @@ void heev< std::complex<float> >(
     Matrix< std::complex<float> >& Z,
     Options const& opts);
 
+template
+void heev< std::complex<float> >(
+    Range range, float vl, float vu, int64_t il, int64_t iu,
+    HermitianMatrix< std::complex<float> >& A,
+    std::vector<float>& Lambda,
+    Matrix< std::complex<float> >& Z,
+    Options const& opts);
+
+template
+void heev< std::complex<double> >(
+    HermitianMatrix< std::complex<double> >& A,
+    std::vector<double>& Lambda,
+    Matrix< std::complex<double> >& Z,
+    Options const& opts);
+
 template
 void heev< std::complex<double> >(
+    Range range, double vl, double vu, int64_t il, int64_t iu,
     HermitianMatrix< std::complex<double> >& A,
     std::vector<double>& Lambda,
     Matrix< std::complex<double> >& Z,
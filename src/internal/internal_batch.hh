@@ -10,12 +10,17 @@
 /// Provides simple precision-independent wrappers around MKL batch
 /// routines. Eventually to be replaced by BLAS++ batch routines.
 ///
+/// Provides a portable grouped-batch engine for host BLAS, used by
+/// Target::HostBatch with or without MKL.
+///
 /// Provides routines to build the batch regions for device batched kernels.
 #ifndef SLATE_INTERNAL_BATCH_HH
 #define SLATE_INTERNAL_BATCH_HH
 
 #include "slate/Exception.hh"
 #include "slate/BaseMatrix.hh"
+#include "slate/internal/openmp.hh"
+#include "slate/internal/Trace.hh"
 
 #include <blas.hh>
 
@@ -23,8 +28,11 @@
     #include <mkl_cblas.h>
 #endif
 
+#include <algorithm>
 #include <complex>
+#include <map>
 #include <set>
+#include <tuple>
 
 namespace slate {
 namespace internal {
@@ -152,6 +160,188 @@ inline void cblas_gemm_batch(
 #endif // BLAS_HAVE_MKL
 
 
+// Portable host batch engine
+
+//------------------------------------------------------------------------------
+/// Groups the entries of a batch that have equal keys, e.g., equal sizes
+/// and strides, so each group can be dispatched with the same blocking.
+/// Groups are ordered by decreasing size, then by first appearance.
+///
+/// @param[in] keys
+///     keys[ i ] is the key of batch entry i.
+///
+/// @return For each group, the indices of its entries, in batch order.
+///
+template <typename key_t>
+std::vector< std::vector<int64_t> > host_batch_groups(
+    std::vector<key_t> const& keys )
+{
+    std::vector< std::vector<int64_t> > groups;
+    std::map<key_t, size_t> group_index;
+    for (int64_t i = 0; i < int64_t( keys.size() ); ++i) {
+        auto iter = group_index.find( keys[ i ] );
+        if (iter == group_index.end()) {
+            iter = group_index.insert( { keys[ i ], groups.size() } ).first;
+            groups.push_back( {} );
+        }
+        groups[ iter->second ].push_back( i );
+    }
+    std::stable_sort(
+        groups.begin(), groups.end(),
+        []( std::vector<int64_t> const& a, std::vector<int64_t> const& b ) {
+            return a.size() > b.size();
+        } );
+    return groups;
+}
+
+//------------------------------------------------------------------------------
+/// Runs a grouped batch of independent host operations as OpenMP tasks.
+/// Each group is split into about one chunk per thread, so all threads
+/// work on every group, and one task runs the entries of a chunk back to
+/// back. This gives batched throughput with any BLAS library, unlike one
+/// task per tile. Must be called from within an OpenMP parallel region,
+/// as internal routines are; otherwise the batch runs serially.
+///
+/// @param[in] groups
+///     Groups of batch entry indices, from host_batch_groups.
+///
+/// @param[in] priority
+///     OpenMP task priority.
+///
+/// @param[in] func
+///     func( i ) computes batch entry i.
+///
+template <typename func_t>
+void host_batch_run(
+    std::vector< std::vector<int64_t> > const& groups,
+    int priority, func_t const& func )
+{
+    int64_t num_threads = omp_get_num_threads();
+    int err = 0;
+    std::string err_msg;
+
+    #pragma omp taskgroup
+    for (auto const& group : groups) {
+        int64_t group_size = group.size();
+        int64_t chunk = (group_size + num_threads - 1) / num_threads;
+        for (int64_t begin = 0; begin < group_size; begin += chunk) {
+            int64_t end = std::min( begin + chunk, group_size );
+            #pragma omp task slate_omp_default_none \
+                shared( group, func, err, err_msg ) \
+                firstprivate( begin, end ) priority( priority )
+            {
+                try {
+                    for (int64_t k = begin; k < end; ++k)
+                        func( group[ k ] );
+                }
+                catch (std::exception& e) {
+                    #pragma omp critical (slate_host_batch_run)
+                    {
+                        err = __LINE__;
+                        err_msg = std::string( e.what() );
+                    }
+                }
+            }
+        }
+    }
+
+    if (err)
+        slate_error( err_msg + ", line " + std::to_string( err ) );
+}
+
+//------------------------------------------------------------------------------
+/// Batch of general matrix multiplies on the host,
+///     $C_i = \alpha op(A_i) op(B_i) + \beta C_i$,
+/// where op, alpha, and beta are the same for all entries.
+/// Entries with equal sizes and strides are grouped. With MKL, the groups
+/// are passed to cblas_gemm_batch; otherwise, they are run by
+/// host_batch_run with single-threaded BLAS calls.
+///
+/// @param[in] priority
+///     OpenMP task priority, used without MKL.
+///
+template <typename scalar_t>
+void host_gemm_batch(
+    Layout layout, Op opA, Op opB,
+    std::vector<int> const& m_array,
+    std::vector<int> const& n_array,
+    std::vector<int> const& k_array,
+    scalar_t alpha,
+    std::vector<scalar_t const*> const& a_array,
+    std::vector<int> const& lda_array,
+    std::vector<scalar_t const*> const& b_array,
+    std::vector<int> const& ldb_array,
+    scalar_t beta,
+    std::vector<scalar_t*> const& c_array,
+    std::vector<int> const& ldc_array,
+    int priority = 0 )
+{
+    int64_t batch_count = c_array.size();
+    if (batch_count == 0)
+        return;
+
+    using key_t = std::tuple<int, int, int, int, int, int>;
+    std::vector<key_t> keys( batch_count );
+    for (int64_t i = 0; i < batch_count; ++i) {
+        keys[ i ] = { m_array[ i ], n_array[ i ], k_array[ i ],
+                      lda_array[ i ], ldb_array[ i ], ldc_array[ i ] };
+    }
+    auto groups = host_batch_groups( keys );
+
+#ifdef BLAS_HAVE_MKL
+    // One MKL group per set of equal sizes and strides,
+    // with entries ordered by group.
+    int group_count = groups.size();
+    std::vector<CBLAS_TRANSPOSE> opA_g( group_count, cblas_trans_const( opA ) );
+    std::vector<CBLAS_TRANSPOSE> opB_g( group_count, cblas_trans_const( opB ) );
+    std::vector<scalar_t> alpha_g( group_count, alpha );
+    std::vector<scalar_t>  beta_g( group_count, beta  );
+    std::vector<int> m_g( group_count ), n_g( group_count ), k_g( group_count );
+    std::vector<int> lda_g( group_count ), ldb_g( group_count ),
+                     ldc_g( group_count ), group_size( group_count );
+    std::vector<scalar_t const*> a_g, b_g;
+    std::vector<scalar_t*> c_g;
+    a_g.reserve( batch_count );
+    b_g.reserve( batch_count );
+    c_g.reserve( batch_count );
+    for (int g = 0; g < group_count; ++g) {
+        int64_t i = groups[ g ][ 0 ];
+        m_g[ g ] = m_array[ i ];
+        n_g[ g ] = n_array[ i ];
+        k_g[ g ] = k_array[ i ];
+        lda_g[ g ] = lda_array[ i ];
+        ldb_g[ g ] = ldb_array[ i ];
+        ldc_g[ g ] = ldc_array[ i ];
+        group_size[ g ] = groups[ g ].size();
+        for (int64_t index : groups[ g ]) {
+            a_g.push_back( a_array[ index ] );
+            b_g.push_back( b_array[ index ] );
+            c_g.push_back( c_array[ index ] );
+        }
+    }
+
+    trace::Block trace_block( "cblas_gemm_batch" );
+    cblas_gemm_batch(
+        layout == Layout::ColMajor ? CblasColMajor : CblasRowMajor,
+        opA_g.data(), opB_g.data(),
+        m_g.data(), n_g.data(), k_g.data(),
+        alpha_g.data(), a_g.data(), lda_g.data(),
+                        b_g.data(), ldb_g.data(),
+        beta_g.data(),  c_g.data(), ldc_g.data(),
+        group_count, group_size.data() );
+#else
+    trace::Block trace_block( "host_gemm_batch" );
+    host_batch_run( groups, priority, [&]( int64_t i ) {
+        blas::gemm( layout, opA, opB,
+                    m_array[ i ], n_array[ i ], k_array[ i ],
+                    alpha, a_array[ i ], lda_array[ i ],
+                           b_array[ i ], ldb_array[ i ],
+                    beta,  c_array[ i ], ldc_array[ i ] );
+    } );
+#endif
+}
+
+
 // Utilities for computing device batch regions
 
 //------------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #include "internal/internal_util.hh"
 #include "slate/internal/Trace.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -122,5 +123,120 @@ void cubeReducePattern(int size, int rank, int radix,
     cubeBcastPattern(size, rank, radix, send_to, recv_from);
 }
 
+//------------------------------------------------------------------------------
+/// [internal]
+/// Finds which ranks share a node, using MPI_Comm_split_type.
+/// Collective on mpi_comm.
+///
+/// @param[in] mpi_comm
+///     MPI communicator.
+///
+/// @return vector of size mpi_comm size, where entry r is the node id of
+///     rank r, which is the lowest rank in mpi_comm on the same node.
+///
+std::vector<int> commNodeIds(MPI_Comm mpi_comm)
+{
+    int mpi_rank, mpi_size;
+    slate_mpi_call(MPI_Comm_rank(mpi_comm, &mpi_rank));
+    slate_mpi_call(MPI_Comm_size(mpi_comm, &mpi_size));
+
+    MPI_Comm node_comm;
+    #pragma omp critical(slate_mpi)
+    slate_mpi_call(
+        MPI_Comm_split_type(mpi_comm, MPI_COMM_TYPE_SHARED, mpi_rank,
+                            MPI_INFO_NULL, &node_comm));
+
+    int node_id;
+    #pragma omp critical(slate_mpi)
+    slate_mpi_call(
+        MPI_Allreduce(&mpi_rank, &node_id, 1, MPI_INT, MPI_MIN, node_comm));
+
+    std::vector<int> node_ids(mpi_size);
+    #pragma omp critical(slate_mpi)
+    {
+        slate_mpi_call(
+            MPI_Allgather(&node_id, 1, MPI_INT, node_ids.data(), 1, MPI_INT,
+                          mpi_comm));
+        slate_mpi_call(MPI_Comm_free(&node_comm));
+    }
+
+    return node_ids;
+}
+
+//------------------------------------------------------------------------------
+/// [internal]
+/// Implements a two-level, node-aware broadcast pattern, so data crosses the
+/// network once per node instead of once per rank. The first rank on each
+/// node in ranks is the node's leader. Leaders broadcast among themselves
+/// using a hypercube, then each leader broadcasts within its node using a
+/// hypercube. Like cubeBcastPattern, uses indices into ranks, with ranks[0]
+/// as the root of the broadcast.
+///
+/// @param[in] ranks
+///     MPI ranks participating in the broadcast, with the root first.
+///
+/// @param[in] node_ids
+///     Node id of each MPI rank, from commNodeIds.
+///
+/// @param[in] rank
+///     Index of the local process in ranks.
+///
+/// @param[in] radix
+///     Dimension of the cubes.
+///
+/// @param[out] recv_from
+///     List containing the index in ranks to receive from.
+///     Empty list for index 0.
+///
+/// @param[out] send_to
+///     List of indices in ranks to forward to.
+///     Other nodes come before the local node.
+///
+void nodeBcastPattern(std::vector<int> const& ranks,
+                      std::vector<int> const& node_ids,
+                      int rank, int radix,
+                      std::list<int>& recv_from, std::list<int>& send_to)
+{
+    int my_node = node_ids[ ranks[ rank ] ];
+
+    // Find the leader of each node, and the ranks on the local node,
+    // both in order of ranks, so the root leads its node.
+    std::vector<int> leaders;
+    std::vector<int> node_ranks;
+    std::set<int> nodes;
+    for (int index = 0; index < int(ranks.size()); ++index) {
+        int node = node_ids[ ranks[ index ] ];
+        if (nodes.insert( node ).second)
+            leaders.push_back( index );
+        if (node == my_node)
+            node_ranks.push_back( index );
+    }
+
+    std::list<int> cube_recv;
+    std::list<int> cube_send;
+
+    // Across nodes.
+    if (node_ranks.front() == rank) {
+        int leader = std::find( leaders.begin(), leaders.end(), rank )
+                     - leaders.begin();
+        cubeBcastPattern(leaders.size(), leader, radix, cube_recv, cube_send);
+        for (int src : cube_recv)
+            recv_from.push_back( leaders[ src ] );
+        for (int dst : cube_send)
+            send_to.push_back( leaders[ dst ] );
+    }
+
+    // Within the local node.
+    int position = std::find( node_ranks.begin(), node_ranks.end(), rank )
+                   - node_ranks.begin();
+    cube_recv.clear();
+    cube_send.clear();
+    cubeBcastPattern(node_ranks.size(), position, radix, cube_recv, cube_send);
+    for (int src : cube_recv)
+        recv_from.push_back( node_ranks[ src ] );
+    for (int dst : cube_send)
+        send_to.push_back( node_ranks[ dst ] );
+}
+
 } // namespace internal
 } // namespace slate
@@ -49,6 +49,167 @@ void gemm(scalar_t alpha, Matrix<scalar_t>&& A,
          layout, priority, queue_index );
 }
 
+//------------------------------------------------------------------------------
+/// Copies op(T) into the column-major buffer, with leading dimension ldb.
+/// @ingroup gemm_internal
+///
+template <typename scalar_t>
+void gemm_pack( Tile<scalar_t> const& T, scalar_t* buffer, int64_t ldb )
+{
+    if (T.op() == Op::NoTrans && T.layout() == Layout::ColMajor) {
+        lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                       T.data(), T.stride(), buffer, ldb );
+    }
+    else {
+        for (int64_t j = 0; j < T.nb(); ++j)
+            for (int64_t i = 0; i < T.mb(); ++i)
+                buffer[ i + j*ldb ] = T( i, j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// General matrix multiply to update trailing matrix,
+/// where A is a single block column and B is a single block row,
+/// for C whose local tiles form one contiguous column-major array,
+/// as for matrices created by fromScaLAPACK.
+/// The local block rows of A and block cols of B are packed into
+/// contiguous arrays, then C is updated by a few large gemm calls,
+/// one per thread, instead of one gemm per tile.
+/// Host tiles of A and B must already be available. Contiguity is checked
+/// on the host instances of C, which are then fetched for writing.
+///
+/// @return true if C is contiguous and was updated;
+///         false if C is not contiguous, and nothing was done.
+///
+/// @ingroup gemm_internal
+///
+template <typename scalar_t>
+bool gemm_contiguous(
+    scalar_t alpha, Matrix<scalar_t>& A,
+                    Matrix<scalar_t>& B,
+    scalar_t beta,  Matrix<scalar_t>& C,
+    Layout layout, int priority )
+{
+    if (layout != Layout::ColMajor || C.op() != Op::NoTrans)
+        return false;
+
+    // Offsets of local block rows and cols within the local array.
+    std::vector<int64_t> rows, cols, row_offset, col_offset;
+    int64_t m_local = 0, n_local = 0;
+    for (int64_t i = 0; i < C.mt(); ++i) {
+        for (int64_t j = 0; j < C.nt(); ++j) {
+            if (C.tileIsLocal( i, j )) {
+                rows.push_back( i );
+                row_offset.push_back( m_local );
+                m_local += C.tileMb( i );
+                break;
+            }
+        }
+    }
+    for (int64_t j = 0; j < C.nt(); ++j) {
+        for (int64_t i = 0; i < C.mt(); ++i) {
+            if (C.tileIsLocal( i, j )) {
+                cols.push_back( j );
+                col_offset.push_back( n_local );
+                n_local += C.tileNb( j );
+                break;
+            }
+        }
+    }
+    if (rows.size() * cols.size() <= 1)
+        return false;
+
+    // Check that local tiles are the blocks of one column-major array.
+    if (! C.tileExists( rows[ 0 ], cols[ 0 ] ))
+        return false;
+    auto C00 = C( rows[ 0 ], cols[ 0 ] );
+    scalar_t* C_data = C00.data();
+    int64_t ldc = C00.stride();
+    if (ldc < m_local)
+        return false;
+    for (size_t jj = 0; jj < cols.size(); ++jj) {
+        for (size_t ii = 0; ii < rows.size(); ++ii) {
+            int64_t i = rows[ ii ];
+            int64_t j = cols[ jj ];
+            if (! C.tileIsLocal( i, j ) || ! C.tileExists( i, j ))
+                return false;
+            auto Cij = C( i, j );
+            if (Cij.op() != Op::NoTrans
+                || Cij.layout() != Layout::ColMajor
+                || Cij.stride() != ldc
+                || Cij.data() != C_data + row_offset[ ii ]
+                                        + col_offset[ jj ]*ldc)
+                return false;
+        }
+    }
+
+    // Tiles are already column-major on the host, so this doesn't move them.
+    std::set< std::tuple<int64_t, int64_t> > C_tiles_set;
+    for (int64_t i : rows)
+        for (int64_t j : cols)
+            C_tiles_set.insert( { i, j } );
+    C.tileGetForWriting( C_tiles_set, LayoutConvert( layout ) );
+
+    int64_t k = A.tileNb( 0 );
+    std::vector<scalar_t> A_pack( m_local * k ), B_pack( k * n_local );
+
+    #pragma omp taskgroup
+    {
+        #pragma omp task slate_omp_default_none \
+            shared( A, rows, row_offset, A_pack ) \
+            firstprivate( m_local ) priority( priority )
+        {
+            for (size_t ii = 0; ii < rows.size(); ++ii) {
+                gemm_pack( A( rows[ ii ], 0 ),
+                           &A_pack[ row_offset[ ii ] ], m_local );
+            }
+        }
+        #pragma omp task slate_omp_default_none \
+            shared( B, cols, col_offset, B_pack ) \
+            firstprivate( k ) priority( priority )
+        {
+            for (size_t jj = 0; jj < cols.size(); ++jj) {
+                gemm_pack( B( 0, cols[ jj ] ),
+                           &B_pack[ col_offset[ jj ]*k ], k );
+            }
+        }
+    }
+
+    // Split the local C into one block of rows or cols per thread,
+    // along its longer dimension.
+    int64_t num_threads = omp_get_num_threads();
+    bool split_cols = n_local >= m_local;
+    int64_t split = split_cols ? n_local : m_local;
+    int64_t chunk = ceildiv( split, std::min( num_threads, split ) );
+
+    #pragma omp taskgroup
+    for (int64_t begin = 0; begin < split; begin += chunk) {
+        #pragma omp task slate_omp_default_none \
+            shared( A_pack, B_pack ) \
+            firstprivate( begin, chunk, split, split_cols, m_local, n_local ) \
+            firstprivate( k, alpha, beta, C_data, ldc ) priority( priority )
+        {
+            int64_t size = std::min( chunk, split - begin );
+            if (split_cols) {
+                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                            m_local, size, k,
+                            alpha, A_pack.data(), m_local,
+                                   &B_pack[ begin*k ], k,
+                            beta,  &C_data[ begin*ldc ], ldc );
+            }
+            else {
+                blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                            size, n_local, k,
+                            alpha, &A_pack[ begin ], m_local,
+                                   B_pack.data(), k,
+                            beta,  &C_data[ begin ], ldc );
+            }
+        }
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------------
 /// General matrix multiply to update trailing matrix,
 /// where A is a single block column and B is a single block row.
@@ -86,6 +247,10 @@ void gemm(internal::TargetType<Target::HostTask>,
     A.tileGetForReading(A_tiles_set, LayoutConvert(layout));
     B.tileGetForReading(B_tiles_set, LayoutConvert(layout));
 
+    // Matrices from ScaLAPACK: one large gemm per thread.
+    if (gemm_contiguous( alpha, A, B, beta, C, layout, priority ))
+        return;
+
     #pragma omp taskgroup
     for (int64_t i = 0; i < C.mt(); ++i) {
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -128,8 +293,10 @@ void gemm(internal::TargetType<Target::HostNest>,
           Layout layout, int priority, int64_t queue_index )
 {
 #if defined(SLATE_HAVE_OMPTARGET) || defined(SLATE_SKIP_HOSTNEST)
-    // SYCL/OMP-target-offload can't process this section
-    slate_not_implemented("Target::HostNest isn't supported in this configuration.");
+    // SYCL/OMP-target-offload can't process nested parallel for;
+    // use the portable batch engine instead.
+    gemm( internal::TargetType<Target::HostBatch>(),
+          alpha, A, B, beta, C, layout, priority, queue_index );
 #else
     // check dimensions
     assert(A.nt() == 1);
@@ -183,7 +350,6 @@ void gemm(internal::TargetType<Target::HostBatch>,
           scalar_t beta,  Matrix<scalar_t>& C,
           Layout layout, int priority, int64_t queue_index )
 {
-#ifdef BLAS_HAVE_MKL
     using blas::conj;
     using std::swap;
     using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
@@ -261,24 +427,15 @@ void gemm(internal::TargetType<Target::HostBatch>,
             beta  = conj(beta);
         }
 
-        // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
-        // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
-        std::vector<scalar_t> alpha_array(batch_count, alpha);  // all same
-        std::vector<scalar_t>  beta_array(batch_count,  beta);  // all same
         std::vector<const scalar_t*> a_array(batch_count);
         std::vector<const scalar_t*> b_array(batch_count);
         std::vector<scalar_t*> c_array(batch_count);
         std::vector<int> lda_array(batch_count);
         std::vector<int> ldb_array(batch_count);
         std::vector<int> ldc_array(batch_count);
-        std::vector<int> group_size(batch_count, 1);  // all same
 
         int index = 0;
         for (int64_t i = 0; i < C.mt(); ++i) {
@@ -307,41 +464,29 @@ void gemm(internal::TargetType<Target::HostBatch>,
 
         if (C.op() != Op::NoTrans) {
             // swap A <=> B; swap m <=> n
-            swap(opA_array, opB_array);
+            swap(opA,       opB);
             swap(a_array,   b_array);
             swap(lda_array, ldb_array);
             swap(m_array,   n_array);
         }
 
-        {
-            trace::Block trace_block("cblas_gemm_batch");
-            // mkl_set_num_threads_local(...);
-            if (layout == Layout::ColMajor) {
-                cblas_gemm_batch(
-                    CblasColMajor,
-                    opA_array.data(), opB_array.data(),
-                    m_array.data(), n_array.data(), k_array.data(),
-                    alpha_array.data(), a_array.data(), lda_array.data(),
-                                        b_array.data(), ldb_array.data(),
-                    beta_array.data(),  c_array.data(), ldc_array.data(),
-                    batch_count, group_size.data());
-            }
-            else {
-                cblas_gemm_batch(
-                    CblasColMajor,
-                    opB_array.data(), opA_array.data(),
-                    n_array.data(), m_array.data(), k_array.data(),
-                    alpha_array.data(), b_array.data(), ldb_array.data(),
-                                        a_array.data(), lda_array.data(),
-                    beta_array.data(),  c_array.data(), ldc_array.data(),
-                    batch_count, group_size.data());
-            }
-            // mkl_set_num_threads_local(1);
+        if (layout == Layout::ColMajor) {
+            host_gemm_batch(
+                Layout::ColMajor, opA, opB,
+                m_array, n_array, k_array,
+                alpha, a_array, lda_array,
+                       b_array, ldb_array,
+                beta,  c_array, ldc_array, priority );
+        }
+        else {
+            host_gemm_batch(
+                Layout::ColMajor, opB, opA,
+                n_array, m_array, k_array,
+                alpha, b_array, ldb_array,
+                       a_array, lda_array,
+                beta,  c_array, ldc_array, priority );
         }
     }
-#else
-    slate_not_implemented( "HostBatch requires Intel MKL" );
-#endif
 }
 
 //------------------------------------------------------------------------------
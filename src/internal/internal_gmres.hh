@@ -0,0 +1,388 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+/// Block-GMRES helpers shared by gesv_mixed_gmres and posv_mixed_gmres.
+///
+#ifndef SLATE_INTERNAL_GMRES_HH
+#define SLATE_INTERNAL_GMRES_HH
+
+#include "slate/slate.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Allocates a matrix of mblocks-by-nblocks blocks, each nrhs-by-nrhs,
+/// where nrhs = B.n(). Rows and columns are tiled like the columns of B,
+/// so blocks conform with blocks of the Krylov basis from alloc_basis.
+/// All tiles are on rank 0, on the host.
+///
+template <typename scalar_t>
+Matrix<scalar_t> alloc_block_workspace(
+    Matrix<scalar_t>& B, int64_t mblocks, int64_t nblocks )
+{
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    int64_t nt = B.nt();
+    int device = B.num_devices() > 0 ? 0 : HostNum;
+    std::function<int64_t (int64_t j)> tileNbFunc
+        = [B, nt](int64_t j) { return B.tileNb( j % nt ); };
+    std::function<int (ij_tuple ij)> tileRankFunc
+        = [](ij_tuple ij) { return 0; };
+    std::function<int (ij_tuple ij)> tileDeviceFunc
+        = [device](ij_tuple ij) { return device; };
+    Matrix<scalar_t> M( mblocks*B.n(), nblocks*B.n(),
+                        tileNbFunc, tileNbFunc, tileRankFunc, tileDeviceFunc,
+                        B.mpiComm() );
+    M.insertLocalTiles( Target::Host );
+    return M;
+}
+
+//------------------------------------------------------------------------------
+/// Copies local tiles of M to the column-major array dense, with leading
+/// dimension ld, at their offsets within M.
+///
+template <typename scalar_t>
+void tiles_to_dense( Matrix<scalar_t>& M, scalar_t* dense, int64_t ld )
+{
+    int64_t joffset = 0;
+    for (int64_t j = 0; j < M.nt(); ++j) {
+        int64_t ioffset = 0;
+        for (int64_t i = 0; i < M.mt(); ++i) {
+            if (M.tileIsLocal( i, j )) {
+                M.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto T = M( i, j );
+                lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                               T.data(), T.stride(),
+                               &dense[ ioffset + joffset*ld ], ld );
+            }
+            ioffset += M.tileMb( i );
+        }
+        joffset += M.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the column-major array dense, with leading dimension ld,
+/// to local tiles of M at their offsets within M.
+///
+template <typename scalar_t>
+void dense_to_tiles( scalar_t const* dense, int64_t ld, Matrix<scalar_t>& M )
+{
+    int64_t joffset = 0;
+    for (int64_t j = 0; j < M.nt(); ++j) {
+        int64_t ioffset = 0;
+        for (int64_t i = 0; i < M.mt(); ++i) {
+            if (M.tileIsLocal( i, j )) {
+                M.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto T = M( i, j );
+                lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                               &dense[ ioffset + joffset*ld ], ld,
+                               T.data(), T.stride() );
+            }
+            ioffset += M.tileMb( i );
+        }
+        joffset += M.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Orthonormalizes the columns of the n-by-s block V in place by Cholesky QR,
+/// done twice for stability. On exit, V_in = V_out R.
+///
+/// @param[in,out] V
+///     On entry, the n-by-s block. On exit, its orthonormal basis,
+///     if successful.
+///
+/// @param[out] G
+///     s-by-s workspace, from alloc_block_workspace.
+///
+/// @param[out] R
+///     The s-by-s upper triangular factor R, from alloc_block_workspace.
+///     Its lower triangle is set to zero.
+///
+/// @param[in] opts
+///     Options passed to the gemm, potrf, trmm, and trsm calls.
+///
+/// @return true if successful; false if V is numerically rank deficient,
+///     in which case V is overwritten.
+///
+template <typename scalar_t>
+bool block_orthonormalize(
+    Matrix<scalar_t>& V, Matrix<scalar_t>& G, Matrix<scalar_t>& R,
+    Options const& opts )
+{
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    auto VT = conj_transpose( V );
+    auto G_herm = HermitianMatrix<scalar_t>( Uplo::Upper, G );
+    auto G_tri = TriangularMatrix<scalar_t>( Uplo::Upper, Diag::NonUnit, G );
+
+    set( zero, one, R, opts );
+    for (int pass = 0; pass < 2; ++pass) {
+        // G = V^H V = R_pass^H R_pass
+        gemm<scalar_t>(
+            one,  VT,
+                  V,
+            zero, G,
+            opts );
+        if (potrf( G_herm, opts ) != 0)
+            return false;
+
+        // R = R_pass R, and V = V R_pass^{-1}
+        trmm( Side::Left, one, G_tri, R, opts );
+        trsm( Side::Right, one, G_tri, V, opts );
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the columns of M flagged in cols to zero, or to random values in
+/// (-1, 1) if seed >= 0. Random values depend only on the seed and the
+/// indices, not on the distribution of M.
+///
+template <typename scalar_t>
+void set_columns( Matrix<scalar_t>& M, std::vector<int> const& cols,
+                  int64_t seed )
+{
+    const int64_t idist = 2;  // uniform (-1, 1)
+
+    int64_t joffset = 0;
+    for (int64_t j = 0; j < M.nt(); ++j) {
+        for (int64_t i = 0; i < M.mt(); ++i) {
+            if (M.tileIsLocal( i, j )) {
+                M.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                auto T = M( i, j );
+                for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                    int64_t c = joffset + jj;
+                    if (! cols[ c ])
+                        continue;
+                    if (seed >= 0) {
+                        int64_t iseed[4] = { seed % 4096, c % 4096, i % 4096,
+                                             2*((i / 4096) % 2048) + 1 };
+                        lapack::larnv( idist, iseed, T.mb(), &T.at( 0, jj ) );
+                    }
+                    else {
+                        std::fill_n( &T.at( 0, jj ), T.mb(), scalar_t( 0 ) );
+                    }
+                }
+            }
+        }
+        joffset += M.tileNb( j );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Finds an orthonormal basis for the initial residual block of block GMRES,
+/// deflating columns that would make the block rank deficient.
+///
+/// Columns of R that have already converged are set to zero, so they get no
+/// correction. Columns that are zero, or numerically dependent on the other
+/// columns (e.g., duplicates), are found by pivoted Cholesky of the Gram
+/// matrix of R with its columns scaled to unit norm. In V, they are replaced
+/// by random vectors, so the block keeps its width. Then V is
+/// orthonormalized and C = V^H R. Since the deflated columns of R are in the
+/// span of V, or nearly so, R = V C.
+///
+/// @param[in,out] R
+///     The n-by-s residual block. On exit, its converged columns are zero.
+///
+/// @param[out] V
+///     The n-by-s orthonormal basis, distributed like R.
+///
+/// @param[out] G
+///     s-by-s workspace, from alloc_block_workspace.
+///
+/// @param[out] C
+///     The s-by-s coefficients, from alloc_block_workspace.
+///
+/// @param[in] colnorms_R
+///     Max norms of the columns of R.
+///
+/// @param[in] colnorms_X
+///     Max norms of the columns of the solution.
+///
+/// @param[in] cte
+///     Column c is converged if colnorms_R[ c ] <= cte colnorms_X[ c ].
+///
+/// @param[in] seed
+///     Seed for the random vectors, e.g., the iteration count.
+///
+/// @param[in] opts
+///     Options passed to the copy, gemm, and block_orthonormalize calls.
+///
+/// @return true if successful; false if all columns are deflated or V
+///     could not be orthonormalized.
+///
+template <typename scalar_t>
+bool block_deflated_basis(
+    Matrix<scalar_t>& R, Matrix<scalar_t>& V,
+    Matrix<scalar_t>& G, Matrix<scalar_t>& C,
+    std::vector< blas::real_type<scalar_t> > const& colnorms_R,
+    std::vector< blas::real_type<scalar_t> > const& colnorms_X,
+    blas::real_type<scalar_t> cte, int64_t seed,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+    const int64_t s = R.n();
+
+    std::vector<int> converged( s ), deflated( s );
+    for (int64_t c = 0; c < s; ++c) {
+        converged[ c ] = colnorms_R[ c ] <= cte * colnorms_X[ c ];
+    }
+    set_columns( R, converged, -1 );
+
+    // G = R^H R
+    auto RT = conj_transpose( R );
+    gemm<scalar_t>(
+        one,  RT,
+              R,
+        zero, G,
+        opts );
+
+    // Pivoted Cholesky of the scaled Gram matrix; columns after its rank
+    // are deflated. Its pivots are the squared relative norms of the
+    // columns' components orthogonal to earlier pivots.
+    int root = G.tileRank( 0, 0 );
+    if (R.mpiRank() == root) {
+        std::vector<scalar_t> G_dense( s*s );
+        tiles_to_dense( G, G_dense.data(), s );
+        std::vector<real_t> scale( s );
+        for (int64_t c = 0; c < s; ++c) {
+            real_t d = std::sqrt( std::real( G_dense[ c + c*s ] ) );
+            scale[ c ] = d > 0 ? 1 / d : 0;
+        }
+        for (int64_t j = 0; j < s; ++j) {
+            for (int64_t i = 0; i < s; ++i) {
+                G_dense[ i + j*s ] *= scale[ i ] * scale[ j ];
+            }
+        }
+        std::vector<int64_t> piv( s );
+        int64_t rank;
+        lapack::pstrf( Uplo::Upper, s, G_dense.data(), s,
+                       piv.data(), &rank, s * std::sqrt( eps ) );
+        for (int64_t k = rank; k < s; ++k) {
+            deflated[ piv[ k ] - 1 ] = 1;
+        }
+    }
+    slate_mpi_call(
+        MPI_Bcast( deflated.data(), s, MPI_INT, root, R.mpiComm() ) );
+    if (std::find( deflated.begin(), deflated.end(), 0 ) == deflated.end())
+        return false;
+
+    slate::copy( R, V, opts );
+    set_columns( V, deflated, seed );
+    if (! block_orthonormalize( V, G, C, opts ))
+        return false;
+
+    // C = V^H R
+    auto VT = conj_transpose( V );
+    gemm<scalar_t>(
+        one,  VT,
+              R,
+        zero, C,
+        opts );
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Reduces block column j of the block upper Hessenberg matrix H to upper
+/// triangular form with Givens rotations, and applies them to the
+/// least squares right-hand side S.
+///
+/// Block column j, columns [j*s, (j+1)*s), has nonzeros in rows up to
+/// (j+2)*s, its subdiagonal block being upper triangular. Each column c
+/// first has the rotations of all previous columns applied, then s
+/// rotations zero rows c+s down to c+1, bottom up. Rotation t of column c
+/// acts on rows (c+s-t-1, c+s-t) and is stored in alpha[ c*s + t ],
+/// beta[ c*s + t ].
+///
+/// With s = 1, this is the usual GMRES update.
+///
+/// @param[in] j
+///     Block column to reduce. Block columns 0, ..., j-1 were reduced by
+///     previous calls.
+///
+/// @param[in] s
+///     Block size, the number of right-hand sides.
+///
+/// @param[in,out] H
+///     The block Hessenberg matrix, column-major, with leading dimension ldh.
+///
+/// @param[in,out] S
+///     The s-column least squares right-hand side, column-major, with
+///     leading dimension lds.
+///
+/// @param[in,out] alpha
+///     Rotation cosines.
+///
+/// @param[in,out] beta
+///     Rotation sines.
+///
+/// @param[out] residual
+///     Vector of length s. The least squares residual norm of each
+///     right-hand side, which is the GMRES residual estimate.
+///
+template <typename scalar_t>
+void block_givens(
+    int64_t j, int64_t s,
+    scalar_t* H, int64_t ldh,
+    scalar_t* S, int64_t lds,
+    blas::real_type<scalar_t>* alpha, scalar_t* beta,
+    blas::real_type<scalar_t>* residual )
+{
+    // Apply rotations of previous block columns to all of block column j,
+    // a row of s entries at a time.
+    scalar_t* Hj = &H[ j*s*ldh ];
+    for (int64_t p = 0; p < j*s; ++p) {
+        for (int64_t t = 0; t < s; ++t) {
+            int64_t r = p + s - t;
+            blas::rot( s, &Hj[ r-1 ], ldh, &Hj[ r ], ldh,
+                       alpha[ p*s + t ], beta[ p*s + t ] );
+        }
+    }
+
+    for (int64_t c = j*s; c < (j+1)*s; ++c) {
+        scalar_t* Hc = &H[ c*ldh ];
+
+        // Apply rotations of previous columns in block column j.
+        for (int64_t p = j*s; p < c; ++p) {
+            for (int64_t t = 0; t < s; ++t) {
+                int64_t r = p + s - t;
+                blas::rot( 1, &Hc[ r-1 ], 1, &Hc[ r ], 1,
+                           alpha[ p*s + t ], beta[ p*s + t ] );
+            }
+        }
+
+        // Zero the subdiagonal of column c, bottom up.
+        for (int64_t t = 0; t < s; ++t) {
+            int64_t r = c + s - t;
+            scalar_t a = Hc[ r-1 ], b = Hc[ r ];
+            blas::rotg( &a, &b, &alpha[ c*s + t ], &beta[ c*s + t ] );
+            blas::rot( 1, &Hc[ r-1 ], 1, &Hc[ r ], 1,
+                       alpha[ c*s + t ], beta[ c*s + t ] );
+            blas::rot( s, &S[ r-1 ], lds, &S[ r ], lds,
+                       alpha[ c*s + t ], beta[ c*s + t ] );
+        }
+    }
+
+    // Residual of each right-hand side is the norm of rows
+    // [(j+1)*s, (j+2)*s) of its column of S.
+    for (int64_t k = 0; k < s; ++k) {
+        residual[ k ] = blas::nrm2( s, &S[ (j+1)*s + k*lds ], 1 );
+    }
+}
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_GMRES_HH
@@ -142,8 +142,10 @@ void her2k(internal::TargetType<Target::HostNest>,
     using blas::conj;
 
 #if defined(SLATE_HAVE_OMPTARGET) || defined(SLATE_SKIP_HOSTNEST)
-    // SYCL/OMP-target-offload can't process this section
-    slate_not_implemented("Target::HostNest isn't supported in this configuration.");
+    // SYCL/OMP-target-offload can't process nested parallel for;
+    // use the portable batch engine instead.
+    her2k( internal::TargetType<Target::HostBatch>(),
+           alpha, A, B, beta, C, priority, queue_index, layout );
 #else
     // CPU assumes column major
     // todo: relax this assumption, by allowing Tile_blas.hh::her2k()
@@ -227,8 +229,8 @@ void her2k(internal::TargetType<Target::HostBatch>,
            blas::real_type<scalar_t> beta, HermitianMatrix<scalar_t>& C,
            int priority, int queue_index, Layout layout )
 {
-#ifdef BLAS_HAVE_MKL
     using blas::conj;
+    using std::swap;
 
     // CPU assumes column major
     // todo: relax this assumption, by allowing Tile_blas.hh::her2k() to
@@ -292,17 +294,9 @@ void her2k(internal::TargetType<Target::HostBatch>,
 
         Op opB = (opA == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
 
-        // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
-        // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
-        std::vector<scalar_t> alpha_array(batch_count, alpha);  // all same
-        std::vector<scalar_t>  beta_array(batch_count,  beta);  // all same
         std::vector<const scalar_t*> ai_array(batch_count);
         std::vector<const scalar_t*> aj_array(batch_count);
         std::vector<const scalar_t*> bi_array(batch_count);
@@ -313,7 +307,6 @@ void her2k(internal::TargetType<Target::HostBatch>,
         std::vector<int> ldbi_array(batch_count);
         std::vector<int> ldbj_array(batch_count);
         std::vector<int> ldc_array(batch_count);
-        std::vector<int> group_size(batch_count, 1);  // all same
 
         int index = 0;
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -347,7 +340,7 @@ void her2k(internal::TargetType<Target::HostBatch>,
         if (C.op() != Op::NoTrans) {
             // swap A <=> B; swap m <=> n
             // alpha conjugated above
-            swap(opA_array,  opB_array );
+            swap(opA,        opB       );
             swap(ai_array,   bj_array  );
             swap(aj_array,   bi_array  );
             swap(ldai_array, ldbj_array);
@@ -355,48 +348,28 @@ void her2k(internal::TargetType<Target::HostBatch>,
             swap(m_array,    n_array   );
         }
 
-        {
-            trace::Block trace_block("cblas_gemm_batch");
-            const scalar_t one = 1.0;
-
-            // mkl_set_num_threads_local(...);
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             ai_array.data(), ldai_array.data(),
-                             bj_array.data(), ldbj_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-
-            // ai => bi, bj => aj, conjugate alpha, set beta = 1
-            if (is_complex<scalar_t>::value) {
-                std::fill(alpha_array.begin(),
-                          alpha_array.end(), conj(alpha));
-            }
-            std::fill( beta_array.begin(), beta_array.end(), one );
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             bi_array.data(), ldbi_array.data(),
-                             aj_array.data(), ldaj_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-            // mkl_set_num_threads_local(1);
-        }
+        const scalar_t one = 1.0;
+
+        host_gemm_batch(
+            Layout::ColMajor, opA, opB,
+            m_array, n_array, k_array,
+            alpha,          ai_array, ldai_array,
+                            bj_array, ldbj_array,
+            scalar_t(beta), c_array,  ldc_array, priority );
+
+        // ai => bi, bj => aj, conjugate alpha, set beta = 1
+        host_gemm_batch(
+            Layout::ColMajor, opA, opB,
+            m_array, n_array, k_array,
+            conj(alpha), bi_array, ldbi_array,
+                         aj_array, ldaj_array,
+            one,         c_array,  ldc_array, priority );
     }
 
     #pragma omp taskwait
 
     if (err)
         throw std::exception();
-#else
-    slate_not_implemented(
-        "slate::Target::HostBatch needs Intel MKL.");
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -122,8 +122,10 @@ void herk(internal::TargetType<Target::HostNest>,
           int priority, int queue_index, Layout layout )
 {
 #if defined(SLATE_HAVE_OMPTARGET) || defined(SLATE_SKIP_HOSTNEST)
-    // SYCL/OMP-target-offload can't process this section
-    slate_not_implemented("Target::HostNest isn't supported in this configuration.");
+    // SYCL/OMP-target-offload can't process nested parallel for;
+    // use the portable batch engine instead.
+    herk( internal::TargetType<Target::HostBatch>(),
+          alpha, A, beta, C, priority, queue_index, layout );
 #else
     scalar_t alpha_ = scalar_t(alpha);
     scalar_t beta_  = scalar_t(beta);
@@ -202,7 +204,8 @@ void herk(internal::TargetType<Target::HostBatch>,
           blas::real_type<scalar_t> beta,  HermitianMatrix<scalar_t>& C,
           int priority, int queue_index, Layout layout )
 {
-#ifdef BLAS_HAVE_MKL
+    using std::swap;
+
     // CPU assumes column major
     // todo: relax this assumption, by allowing Tile_blas.hh::herk()
     //       to take layout param
@@ -265,24 +268,15 @@ void herk(internal::TargetType<Target::HostBatch>,
 
         Op opB = (opA == Op::NoTrans ? Op::ConjTrans : Op::NoTrans);
 
-        // all same
-        std::vector<CBLAS_TRANSPOSE> opA_array(batch_count,
-                                               cblas_trans_const(opA));
-        // all same
-        std::vector<CBLAS_TRANSPOSE> opB_array(batch_count,
-                                               cblas_trans_const(opB));
         std::vector<int> m_array(batch_count);
         std::vector<int> n_array(batch_count);
         std::vector<int> k_array(batch_count);
-        std::vector<scalar_t> alpha_array(batch_count, alpha);  // all same
-        std::vector<scalar_t>  beta_array(batch_count,  beta);  // all same
         std::vector<const scalar_t*> a_array(batch_count);
         std::vector<const scalar_t*> b_array(batch_count);
         std::vector<scalar_t*> c_array(batch_count);
         std::vector<int> lda_array(batch_count);
         std::vector<int> ldb_array(batch_count);
         std::vector<int> ldc_array(batch_count);
-        std::vector<int> group_size(batch_count, 1);  // all same
 
         int index = 0;
         for (int64_t j = 0; j < C.nt(); ++j) {
@@ -311,34 +305,22 @@ void herk(internal::TargetType<Target::HostBatch>,
 
         if (C.op() != Op::NoTrans) {
             // swap A <=> B; swap m <=> n
-            swap(opA_array, opB_array);
+            swap(opA,       opB      );
             swap(a_array,   b_array  );
             swap(lda_array, ldb_array);
             swap(m_array,   n_array  );
         }
 
-        {
-            trace::Block trace_block("cblas_gemm_batch");
-            // mkl_set_num_threads_local(...);
-            cblas_gemm_batch(CblasColMajor,
-                             opA_array.data(), opB_array.data(),
-                             m_array.data(), n_array.data(), k_array.data(),
-                             alpha_array.data(),
-                             a_array.data(), lda_array.data(),
-                             b_array.data(), ldb_array.data(),
-                             beta_array.data(),
-                             c_array.data(), ldc_array.data(),
-                             batch_count, group_size.data());
-            // mkl_set_num_threads_local(1);
-        }
+        host_gemm_batch(
+            Layout::ColMajor, opA, opB,
+            m_array, n_array, k_array,
+            scalar_t(alpha), a_array, lda_array,
+                             b_array, ldb_array,
+            scalar_t(beta),  c_array, ldc_array, priority );
     }
 
     if (err)
         throw std::exception();
-#else
-    slate_not_implemented(
-        "slate::Target::HostBatch needs Intel MKL.");
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -138,7 +138,9 @@ void hettmqr(
     // (*) shows where conj-transposed tiles come from.
 
     std::vector<MPI_Request> requests;
+    std::vector< std::pair<int64_t, int64_t> > conj_transpose_tiles;
     for (int level = 0; level < nlevels; ++level) {
+        requests.clear();
         // index is first node of each pair.
         for (int index = 0; index + step < nranks; index += 2*step) {
             int64_t i1 = rank_indices[ index ].second;
@@ -158,7 +160,13 @@ void hettmqr(
                     int dst = C.tileRank(i2, i1);
                     int tag = tag_base + i + i*C.mt();
                     C.tileSend(i, i, dst, tag);
-                    C.tileRecv(i, i, dst, layout, tag);
+                    // Receive back after the taskwait below, since dst may
+                    // defer its task while it is blocked on this rank.
+                    if (dst != C.mpiRank()) {
+                        MPI_Request req;
+                        C.tileIrecv(i, i, dst, layout, tag, &req);
+                        requests.push_back( req );
+                    }
                 }
             }
             if (C.tileIsLocal(i2, i1)) {
@@ -239,6 +247,12 @@ void hettmqr(
                     if (i1 >= j) {
                         C.tileSend(i1, j, dst, tag);
                     }
+                    else if (dst == C.mpiRank()) {
+                        // On a p-by-q grid, dst can be this node;
+                        // use workspace C(i1, j) = C(j, i1)^H.
+                        C.tileInsert(i1, j);
+                        tile::deepConjTranspose( C(j, i1), C(i1, j) );
+                    }
                     else {
                         // Send transposed tile.
                         tile::deepConjTranspose( C(j, i1) );
@@ -278,8 +292,14 @@ void hettmqr(
                                   ? C.tileRank(i1, j)
                                   : C.tileRank(j, i1));
                         int tag = tag_base + i1 + j*C.mt();
-                        // Send updated tile back.
-                        C.tileSend(i1, j, src, tag);
+                        if (src == C.mpiRank() && i1 < j) {
+                            tile::deepConjTranspose( C(i1, j), C(j, i1) );
+                            C.tileErase(i1, j);
+                        }
+                        else {
+                            // Send updated tile back.
+                            C.tileSend(i1, j, src, tag);
+                        }
                     }
                 }
             } // for j
@@ -290,20 +310,30 @@ void hettmqr(
 
                 if ((i1 >= j && C.tileIsLocal(i1, j)) ||
                     (i1 <  j && C.tileIsLocal(j, i1))) {
-                    // Receives updated tile back ().
+                    // Receives updated tile back, after the taskwait below.
                     int tag = tag_base + i1 + j*C.mt();
                     int dst = C.tileRank(i2, j);
+                    if (dst == C.mpiRank())
+                        continue;
+                    MPI_Request req;
                     if (i1 >= j) {
-                        C.tileRecv(i1, j, dst, layout, tag);
+                        C.tileIrecv(i1, j, dst, layout, tag, &req);
                     }
                     else {
-                        C.tileRecv(j, i1, dst, layout, tag);
-                        tile::deepConjTranspose(C(j, i1));
+                        C.tileIrecv(j, i1, dst, layout, tag, &req);
+                        conj_transpose_tiles.push_back( { j, i1 } );
                     }
+                    requests.push_back( req );
                 }
             } // for j
         }
         #pragma omp taskwait
+        slate_mpi_call(
+            MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE ) );
+        for (auto ij : conj_transpose_tiles) {
+            tile::deepConjTranspose( C( ij.first, ij.second ) );
+        }
+        conj_transpose_tiles.clear();
 
         requests.clear();
         for (int index = 0; index + step < nranks; index += 2*step) {
@@ -314,7 +344,23 @@ void hettmqr(
             // 3: Multiply [ C(i, j1)  C(i, j2) ] * Q for i = j2+1, ..., mt-1.
             for (int64_t i = j2+1; i < C.mt(); ++i) {
                 int tag = tag_base + i + j1*C.mt();
-                if (C.tileIsLocal(i, j1)) {
+                if (C.tileIsLocal(i, j1) && C.tileIsLocal(i, j2)) {
+                    // On a p-by-q grid with q < p, one node can have both.
+                    #pragma omp task shared( V, T, C ) firstprivate( i, j1, j2 )
+                    {
+                        V.tileGetForReading(j2, 0, LayoutConvert(layout));
+                        T.tileGetForReading(j2, 0, LayoutConvert(layout));
+                        C.tileGetForWriting(i, j1, LayoutConvert(layout));
+                        C.tileGetForWriting(i, j2, LayoutConvert(layout));
+
+                        // Multiply [ C(i, j1) C(i, j2) ] * opR(Q).
+                        tile::tpmqrt( Side::Right, opR,
+                                      std::min( V.tileMb( j2 ), V.tileNb( 0 ) ),
+                                      V( j2, 0 ), T( j2, 0 ),
+                                      C( i, j1 ), C( i, j2 ) );
+                    }
+                }
+                else if (C.tileIsLocal(i, j1)) {
                     // First node of each pair sends tile to dst.
                     int dst = C.tileRank(i, j2);
                     MPI_Request req;
@@ -345,7 +391,7 @@ void hettmqr(
 
             for (int64_t i = j2+1; i < C.mt(); ++i) {
                 int tag = tag_base + i + j1*C.mt();
-                if (C.tileIsLocal(i, j1)) {
+                if (C.tileIsLocal(i, j1) && ! C.tileIsLocal(i, j2)) {
                     // Receives updated tile back.
                     int dst = C.tileRank(i, j2);
                     MPI_Request req;
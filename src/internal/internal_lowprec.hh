@@ -0,0 +1,763 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+//------------------------------------------------------------------------------
+/// @file
+/// Provides 16-bit (fp16, bf16) storage of the single-precision factor used
+/// by the mixed-precision solvers, with software conversion, and
+/// triangular solves that expand the factor back to single precision one
+/// tile at a time.
+///
+#ifndef SLATE_INTERNAL_LOWPREC_HH
+#define SLATE_INTERNAL_LOWPREC_HH
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <map>
+#include <set>
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return x rounded to IEEE half precision (fp16), round to nearest even.
+/// Values beyond the fp16 range become inf.
+///
+inline uint16_t float_to_fp16( float x )
+{
+    uint32_t f;
+    std::memcpy( &f, &x, sizeof( f ) );
+    uint32_t sign = (f >> 16) & 0x8000;
+    uint32_t abs_f = f & 0x7FFFFFFF;
+
+    if (abs_f >= 0x7F800000) {
+        // inf or nan; keep nan quiet
+        return sign | 0x7C00 | (abs_f > 0x7F800000 ? 0x0200 : 0);
+    }
+    if (abs_f >= 0x477FF000) {
+        // >= 65520 rounds to inf
+        return sign | 0x7C00;
+    }
+    if (abs_f < 0x38800000) {
+        // below 2^-14, the smallest fp16 normal: subnormal or zero,
+        // in units of 2^-24
+        if (abs_f < 0x33000000)
+            return sign;  // below 2^-25 rounds to zero
+        uint32_t exp = abs_f >> 23;
+        uint32_t mant = (abs_f & 0x007FFFFF) | 0x00800000;
+        uint32_t shift = 126 - exp;
+        uint32_t h = mant >> shift;
+        uint32_t rem = mant & ((1u << shift) - 1);
+        uint32_t half = 1u << (shift - 1);
+        if (rem > half || (rem == half && (h & 1)))
+            ++h;
+        return sign | h;
+    }
+    // normal: rebias exponent from 127 to 15, drop 13 mantissa bits
+    uint32_t h = (abs_f >> 13) - ((127 - 15) << 10);
+    uint32_t rem = abs_f & 0x1FFF;
+    if (rem > 0x1000 || (rem == 0x1000 && (h & 1)))
+        ++h;
+    return sign | h;
+}
+
+//------------------------------------------------------------------------------
+/// @return fp16 value h converted to float, which is exact.
+///
+inline float fp16_to_float( uint16_t h )
+{
+    uint32_t sign = uint32_t( h & 0x8000 ) << 16;
+    uint32_t exp  = (h >> 10) & 0x1F;
+    uint32_t mant = h & 0x03FF;
+    uint32_t f;
+    if (exp == 0x1F) {
+        f = sign | 0x7F800000 | (mant << 13);  // inf or nan
+    }
+    else if (exp != 0) {
+        f = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+    else if (mant == 0) {
+        f = sign;
+    }
+    else {
+        // subnormal, mant * 2^-24
+        float x = std::ldexp( float( mant ), -24 );
+        return sign ? -x : x;
+    }
+    float x;
+    std::memcpy( &x, &f, sizeof( x ) );
+    return x;
+}
+
+//------------------------------------------------------------------------------
+/// @return x rounded to bfloat16, round to nearest even.
+///
+inline uint16_t float_to_bf16( float x )
+{
+    uint32_t f;
+    std::memcpy( &f, &x, sizeof( f ) );
+    if ((f & 0x7FFFFFFF) > 0x7F800000)
+        return (f >> 16) | 0x0040;  // nan; keep quiet
+    f += 0x7FFF + ((f >> 16) & 1);
+    return f >> 16;
+}
+
+//------------------------------------------------------------------------------
+/// @return bfloat16 value h converted to float, which is exact.
+///
+inline float bf16_to_float( uint16_t h )
+{
+    uint32_t f = uint32_t( h ) << 16;
+    float x;
+    std::memcpy( &x, &f, sizeof( x ) );
+    return x;
+}
+
+//------------------------------------------------------------------------------
+/// Low-precision factor of a mixed-precision solver, in single precision
+/// or stored in 16 bits.
+///
+/// With FactorPrecision::Single, this holds nothing and solves forward to
+/// getrs and potrs with the single-precision factor.
+///
+/// With FactorPrecision::Half or BFloat16, compress stores the local tiles
+/// of the factor as 16-bit values, after which the caller releases the
+/// single-precision factor, so memory is saved only during refinement,
+/// not in the factorization. For fp16, each tile is scaled by a power of 2
+/// so its largest entry is near 2^15, avoiding overflow and most
+/// underflow; bf16 has the range of float and is not scaled.
+///
+/// The 16-bit solves run on the host. Block row k of the right-hand sides
+/// is kept on the owner of diagonal tile (k, k). For each block row, the
+/// partial sums of updates are reduced onto the diagonal tile's owner
+/// from the ranks owning tiles in that block row, which solves with the
+/// diagonal tile and broadcasts the result to the ranks owning tiles in
+/// that block column; each of those then updates its partial sums with
+/// its own tiles. Both use a hypercube over just those ranks, which for
+/// a 2D block cyclic distribution is one process row or column. Only
+/// blocks of the right-hand sides are communicated, never the factor,
+/// and each rank stores only the block rows it owns tiles in. Each tile
+/// is expanded to single precision in a per-thread workspace for the
+/// update, so BLAS accumulates in single precision.
+///
+/// @tparam scalar_t
+///     One of float, std::complex<float>.
+///
+template <typename scalar_t>
+class LowPrecisionFactor {
+public:
+    using real_t = blas::real_type<scalar_t>;
+    static_assert( std::is_same< real_t, float >::value,
+                   "LowPrecisionFactor requires float or complex<float>" );
+
+    explicit LowPrecisionFactor( FactorPrecision precision )
+        : precision_( precision )
+    {}
+
+    /// @return true if the factor is stored in 16 bits.
+    bool compressed() const
+    {
+        return precision_ != FactorPrecision::Single;
+    }
+
+    template <typename matrix_t>
+    void compress( matrix_t& A );
+
+    void getrs( Matrix<scalar_t>& A, Pivots& pivots, Matrix<scalar_t>& B,
+                Options const& opts );
+
+    void potrs( HermitianMatrix<scalar_t>& A, Matrix<scalar_t>& B,
+                Options const& opts );
+
+private:
+    /// One tile in 16 bits, column-major, with real and imaginary parts
+    /// interleaved for complex. The tile is scale times the stored values.
+    struct Block {
+        int64_t mb, nb;
+        real_t scale;
+        std::vector<uint16_t> data;
+    };
+
+    /// Ranks owning tiles of block row k left and right of the diagonal
+    /// tile, and of block col k above and below it, in increasing order.
+    struct BlockRanks {
+        std::vector<int> row_left, row_right, col_above, col_below;
+    };
+
+    /// Block rows of the right-hand sides, each column-major with
+    /// ld = block size; empty for block rows not held locally.
+    using BlockRows = std::vector< std::vector<scalar_t> >;
+
+    static constexpr int parts = is_complex<scalar_t>::value ? 2 : 1;
+
+    static constexpr int tag_rhs    = 0;
+    static constexpr int tag_reduce = 1;
+    static constexpr int tag_bcast  = 2;
+    static constexpr int radix = 4;
+
+    void compressTile( Tile<scalar_t> const& T, Block& block ) const;
+    void expandTile( Block const& block, scalar_t* work ) const;
+
+    int64_t blockSize( int64_t k ) const
+    {
+        return row_offset_[ k+1 ] - row_offset_[ k ];
+    }
+
+    static int mpiCount( int64_t count )
+    {
+        slate_assert( count <= std::numeric_limits<int>::max() );
+        return int( count );
+    }
+
+    int rankSet( std::vector<int> const& ranks, int root,
+                 std::vector<int>& set ) const;
+    void reduce( std::vector<int> const& ranks, int root,
+                 std::vector<scalar_t>& data ) const;
+    void bcast( std::vector<int> const& ranks, int root,
+                std::vector<scalar_t>& data ) const;
+
+    void gatherRhs( Matrix<scalar_t>& B, BlockRows& Y ) const;
+    void scatterRhs( BlockRows const& Y, Matrix<scalar_t>& B ) const;
+    void trsm( Uplo uplo, Op op, Diag diag,
+               BlockRows& Y, int64_t nrhs ) const;
+
+    FactorPrecision precision_;
+    int64_t mt_ = 0;
+    std::vector<int64_t> row_offset_;  ///< global offset of block rows
+    std::vector<int> diag_rank_;       ///< owner of diagonal tile (k, k)
+    std::vector<BlockRanks> ranks_;    ///< owners of tiles around (k, k)
+    std::map< std::pair<int64_t, int64_t>, Block > blocks_;
+    MPI_Comm mpi_comm_ = MPI_COMM_NULL;
+    int mpi_rank_ = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Stores the local tiles of the factor A in 16 bits. For a Hermitian A,
+/// only tiles in its uplo triangle are stored. Does nothing for
+/// FactorPrecision::Single.
+///
+/// @param[in] A
+///     The single-precision factor, from getrf or potrf.
+///
+template <typename scalar_t>
+template <typename matrix_t>
+void LowPrecisionFactor<scalar_t>::compress( matrix_t& A )
+{
+    if (! compressed())
+        return;
+
+    slate_assert( A.op() == Op::NoTrans );
+    slate_assert( A.mt() == A.nt() );
+
+    mt_ = A.mt();
+    mpi_comm_ = A.mpiComm();
+    mpi_rank_ = A.mpiRank();
+    row_offset_.assign( mt_ + 1, 0 );
+    diag_rank_.resize( mt_ );
+    ranks_.resize( mt_ );
+    for (int64_t k = 0; k < mt_; ++k) {
+        slate_assert( A.tileMb( k ) == A.tileNb( k ) );
+        row_offset_[ k+1 ] = row_offset_[ k ] + A.tileMb( k );
+        diag_rank_[ k ] = A.tileRank( k, k );
+
+        std::set<int> row_left, row_right, col_above, col_below;
+        for (int64_t j = 0; j < k; ++j) {
+            row_left.insert( A.tileRank( k, j ) );
+            col_above.insert( A.tileRank( j, k ) );
+        }
+        for (int64_t j = k+1; j < mt_; ++j) {
+            row_right.insert( A.tileRank( k, j ) );
+            col_below.insert( A.tileRank( j, k ) );
+        }
+        ranks_[ k ].row_left.assign(  row_left.begin(),  row_left.end()  );
+        ranks_[ k ].row_right.assign( row_right.begin(), row_right.end() );
+        ranks_[ k ].col_above.assign( col_above.begin(), col_above.end() );
+        ranks_[ k ].col_below.assign( col_below.begin(), col_below.end() );
+    }
+
+    // Insert blocks serially, then fill them in parallel.
+    Uplo uplo = A.uplo();
+    std::vector<Block*> block_list;
+    std::vector< std::pair<int64_t, int64_t> > ij_list;
+    for (int64_t j = 0; j < mt_; ++j) {
+        for (int64_t i = 0; i < mt_; ++i) {
+            if (A.tileIsLocal( i, j )
+                && (uplo == Uplo::General
+                    || (uplo == Uplo::Lower && i >= j)
+                    || (uplo == Uplo::Upper && i <= j))) {
+                block_list.push_back( &blocks_[ { i, j } ] );
+                ij_list.push_back( { i, j } );
+                A.tileGetForReading( i, j, LayoutConvert::ColMajor );
+            }
+        }
+    }
+
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for (size_t k = 0; k < block_list.size(); ++k) {
+        auto T = A( ij_list[ k ].first, ij_list[ k ].second );
+        compressTile( T, *block_list[ k ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::compressTile(
+    Tile<scalar_t> const& T, Block& block ) const
+{
+    int64_t mb = T.mb();
+    int64_t nb = T.nb();
+    block.mb = mb;
+    block.nb = nb;
+    block.data.resize( parts * mb * nb );
+
+    // View the tile as real, with parts real values per entry.
+    auto real_col = [&T]( int64_t j ) {
+        return reinterpret_cast<real_t const*>( &T.at( 0, j ) );
+    };
+
+    block.scale = 1;
+    if (precision_ == FactorPrecision::Half) {
+        // Scale by a power of 2 to put the largest entry in [2^14, 2^15).
+        real_t max_abs = 0;
+        for (int64_t j = 0; j < nb; ++j) {
+            real_t const* Tj = real_col( j );
+            for (int64_t i = 0; i < parts * mb; ++i)
+                max_abs = std::max( max_abs, std::abs( Tj[ i ] ) );
+        }
+        if (max_abs > 0 && std::isfinite( max_abs )) {
+            int exp;
+            std::frexp( max_abs, &exp );
+            block.scale = std::ldexp( real_t( 1 ), exp - 15 );
+        }
+    }
+    real_t inv_scale = 1 / block.scale;
+
+    for (int64_t j = 0; j < nb; ++j) {
+        real_t const* Tj = real_col( j );
+        uint16_t* data_j = &block.data[ parts * mb * j ];
+        if (precision_ == FactorPrecision::Half) {
+            for (int64_t i = 0; i < parts * mb; ++i)
+                data_j[ i ] = float_to_fp16( Tj[ i ] * inv_scale );
+        }
+        else {
+            for (int64_t i = 0; i < parts * mb; ++i)
+                data_j[ i ] = float_to_bf16( Tj[ i ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Expands a 16-bit block into the column-major work array, ld = mb.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::expandTile(
+    Block const& block, scalar_t* work ) const
+{
+    int64_t count = parts * block.mb * block.nb;
+    real_t* work_real = reinterpret_cast<real_t*>( work );
+    if (precision_ == FactorPrecision::Half) {
+        for (int64_t i = 0; i < count; ++i)
+            work_real[ i ] = fp16_to_float( block.data[ i ] ) * block.scale;
+    }
+    else {
+        for (int64_t i = 0; i < count; ++i)
+            work_real[ i ] = bf16_to_float( block.data[ i ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Puts root first in set, followed by the other ranks.
+///
+/// @return index of the local process in set, or -1 if not in it.
+///
+template <typename scalar_t>
+int LowPrecisionFactor<scalar_t>::rankSet(
+    std::vector<int> const& ranks, int root, std::vector<int>& set ) const
+{
+    set.assign( 1, root );
+    for (int rank : ranks) {
+        if (rank != root)
+            set.push_back( rank );
+    }
+    auto iter = std::find( set.begin(), set.end(), mpi_rank_ );
+    return iter == set.end() ? -1 : int( iter - set.begin() );
+}
+
+//------------------------------------------------------------------------------
+/// Sums data over root and ranks onto root, using a hypercube.
+/// Does nothing on other ranks. data must have the same size on all
+/// participating ranks.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::reduce(
+    std::vector<int> const& ranks, int root,
+    std::vector<scalar_t>& data ) const
+{
+    const scalar_t one = 1.0;
+
+    std::vector<int> set;
+    int index = rankSet( ranks, root, set );
+    if (index < 0 || set.size() == 1)
+        return;
+
+    std::list<int> recv_from, send_to;
+    cubeReducePattern( set.size(), index, radix, recv_from, send_to );
+
+    int count = mpiCount( data.size() );
+    std::vector<scalar_t> buffer;
+    if (! recv_from.empty())
+        buffer.resize( count );
+    for (int src : recv_from) {
+        slate_mpi_call(
+            MPI_Recv( buffer.data(), count, mpi_type<scalar_t>::value,
+                      set[ src ], tag_reduce, mpi_comm_, MPI_STATUS_IGNORE ) );
+        blas::axpy( count, one, buffer.data(), 1, data.data(), 1 );
+    }
+    for (int dst : send_to) {
+        slate_mpi_call(
+            MPI_Send( data.data(), count, mpi_type<scalar_t>::value,
+                      set[ dst ], tag_reduce, mpi_comm_ ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Broadcasts data from root to ranks, using a hypercube.
+/// Does nothing on other ranks. data must have the same size on all
+/// participating ranks.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::bcast(
+    std::vector<int> const& ranks, int root,
+    std::vector<scalar_t>& data ) const
+{
+    std::vector<int> set;
+    int index = rankSet( ranks, root, set );
+    if (index < 0 || set.size() == 1)
+        return;
+
+    std::list<int> recv_from, send_to;
+    cubeBcastPattern( set.size(), index, radix, recv_from, send_to );
+
+    int count = mpiCount( data.size() );
+    for (int src : recv_from) {
+        slate_mpi_call(
+            MPI_Recv( data.data(), count, mpi_type<scalar_t>::value,
+                      set[ src ], tag_bcast, mpi_comm_, MPI_STATUS_IGNORE ) );
+    }
+    for (int dst : send_to) {
+        slate_mpi_call(
+            MPI_Send( data.data(), count, mpi_type<scalar_t>::value,
+                      set[ dst ], tag_bcast, mpi_comm_ ) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the tiles of B into Y, each block row to the owner of the
+/// corresponding diagonal tile of the factor.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::gatherRhs(
+    Matrix<scalar_t>& B, BlockRows& Y ) const
+{
+    int64_t nrhs = B.n();
+    slate_assert( B.mt() == mt_ && B.m() == row_offset_[ mt_ ] );
+
+    Y.assign( mt_, {} );
+    for (int64_t i = 0; i < mt_; ++i) {
+        if (diag_rank_[ i ] == mpi_rank_)
+            Y[ i ].resize( blockSize( i ) * nrhs );
+    }
+
+    // Columns jj : jj + nb - 1 of block row i are contiguous in Y[ i ],
+    // so tiles are received in place.
+    std::list< std::vector<scalar_t> > send_buffers;
+    std::vector<MPI_Request> requests;
+    int64_t jj = 0;
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        int64_t jb = B.tileNb( j );
+        for (int64_t i = 0; i < mt_; ++i) {
+            int64_t ib = blockSize( i );
+            int src = B.tileRank( i, j );
+            int dst = diag_rank_[ i ];
+            if (src == mpi_rank_) {
+                B.tileGetForReading( i, j, LayoutConvert::ColMajor );
+                auto T = B( i, j );
+                slate_assert( T.mb() == ib );
+                scalar_t* buffer;
+                if (dst == mpi_rank_) {
+                    buffer = &Y[ i ][ jj*ib ];
+                }
+                else {
+                    send_buffers.emplace_back( ib * jb );
+                    buffer = send_buffers.back().data();
+                }
+                lapack::lacpy( lapack::MatrixType::General, ib, jb,
+                               T.data(), T.stride(), buffer, ib );
+                if (dst != mpi_rank_) {
+                    requests.emplace_back();
+                    slate_mpi_call(
+                        MPI_Isend( buffer, mpiCount( ib * jb ),
+                                   mpi_type<scalar_t>::value, dst, tag_rhs,
+                                   mpi_comm_, &requests.back() ) );
+                }
+            }
+            else if (dst == mpi_rank_) {
+                requests.emplace_back();
+                slate_mpi_call(
+                    MPI_Irecv( &Y[ i ][ jj*ib ], mpiCount( ib * jb ),
+                               mpi_type<scalar_t>::value, src, tag_rhs,
+                               mpi_comm_, &requests.back() ) );
+            }
+        }
+        jj += jb;
+    }
+    slate_mpi_call(
+        MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE ) );
+}
+
+//------------------------------------------------------------------------------
+/// Copies Y, each block row held by the owner of the corresponding diagonal
+/// tile of the factor, into the tiles of B.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::scatterRhs(
+    BlockRows const& Y, Matrix<scalar_t>& B ) const
+{
+    // Received tiles are unpacked once all have arrived.
+    std::list< std::vector<scalar_t> > recv_buffers;
+    std::vector< std::tuple<int64_t, int64_t, scalar_t*> > recv_tiles;
+    std::vector<MPI_Request> requests;
+    int64_t jj = 0;
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        int64_t jb = B.tileNb( j );
+        for (int64_t i = 0; i < mt_; ++i) {
+            int64_t ib = blockSize( i );
+            int src = diag_rank_[ i ];
+            int dst = B.tileRank( i, j );
+            if (dst == mpi_rank_) {
+                B.tileGetForWriting( i, j, LayoutConvert::ColMajor );
+                if (src == mpi_rank_) {
+                    auto T = B( i, j );
+                    lapack::lacpy( lapack::MatrixType::General, ib, jb,
+                                   &Y[ i ][ jj*ib ], ib,
+                                   T.data(), T.stride() );
+                }
+                else {
+                    recv_buffers.emplace_back( ib * jb );
+                    scalar_t* buffer = recv_buffers.back().data();
+                    recv_tiles.push_back( { i, j, buffer } );
+                    requests.emplace_back();
+                    slate_mpi_call(
+                        MPI_Irecv( buffer, mpiCount( ib * jb ),
+                                   mpi_type<scalar_t>::value, src, tag_rhs,
+                                   mpi_comm_, &requests.back() ) );
+                }
+            }
+            else if (src == mpi_rank_) {
+                requests.emplace_back();
+                slate_mpi_call(
+                    MPI_Isend( &Y[ i ][ jj*ib ], mpiCount( ib * jb ),
+                               mpi_type<scalar_t>::value, dst, tag_rhs,
+                               mpi_comm_, &requests.back() ) );
+            }
+        }
+        jj += jb;
+    }
+    slate_mpi_call(
+        MPI_Waitall( requests.size(), requests.data(), MPI_STATUSES_IGNORE ) );
+
+    for (auto& tile : recv_tiles) {
+        auto T = B( std::get<0>( tile ), std::get<1>( tile ) );
+        lapack::lacpy( lapack::MatrixType::General, T.mb(), T.nb(),
+                       std::get<2>( tile ), T.mb(), T.data(), T.stride() );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves op(S) X = Y, where S is the stored factor, using its uplo
+/// triangle and diag. Y is n-by-nrhs, with block row k on the owner of
+/// diagonal tile (k, k), and is overwritten by X.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::trsm(
+    Uplo uplo, Op op, Diag diag,
+    BlockRows& Y, int64_t nrhs ) const
+{
+    const scalar_t one = 1.0;
+
+    // Whether op(S) is lower triangular, solved top down.
+    bool lower = (uplo == Uplo::Lower) == (op == Op::NoTrans);
+
+    // Local partial sums of updates, sum_j op(S)(i, j) X(j), for block
+    // rows i with local tiles.
+    BlockRows W( mt_ );
+
+    for (int64_t kk = 0; kk < mt_; ++kk) {
+        int64_t k = lower ? kk : mt_ - 1 - kk;
+        int64_t kb = blockSize( k );
+        int root = diag_rank_[ k ];
+
+        // Owners of the solved tiles of block row k of op(S), and of the
+        // unsolved tiles of block col k. Tile (i, j) of op(S) is tile
+        // (j, i) of S if transposed.
+        BlockRanks const& ranks = ranks_[ k ];
+        std::vector<int> const* row_ranks;
+        std::vector<int> const* col_ranks;
+        if (op == Op::NoTrans) {
+            row_ranks = lower ? &ranks.row_left  : &ranks.row_right;
+            col_ranks = lower ? &ranks.col_below : &ranks.col_above;
+        }
+        else {
+            row_ranks = lower ? &ranks.col_above : &ranks.col_below;
+            col_ranks = lower ? &ranks.row_right : &ranks.row_left;
+        }
+
+        // Sum the updates of block row k on the diagonal tile's owner.
+        std::vector<scalar_t>& Wk = W[ k ];
+        if (Wk.empty()
+            && (mpi_rank_ == root
+                || std::binary_search( row_ranks->begin(), row_ranks->end(),
+                                       mpi_rank_ ))) {
+            Wk.assign( kb * nrhs, 0 );
+        }
+        reduce( *row_ranks, root, Wk );
+
+        // Solve with the diagonal tile.
+        std::vector<scalar_t> Yk;
+        if (mpi_rank_ == root) {
+            Yk.swap( Y[ k ] );
+            blas::axpy( Yk.size(), -one, Wk.data(), 1, Yk.data(), 1 );
+            std::vector<scalar_t> work( kb * kb );
+            expandTile( blocks_.at( { k, k } ), work.data() );
+            blas::trsm( Layout::ColMajor, Side::Left, uplo, op, diag,
+                        kb, nrhs, one, work.data(), kb, Yk.data(), kb );
+        }
+        else if (std::binary_search( col_ranks->begin(), col_ranks->end(),
+                                     mpi_rank_ )) {
+            Yk.resize( kb * nrhs );
+        }
+        std::vector<scalar_t>().swap( Wk );
+        bcast( *col_ranks, root, Yk );
+
+        // Update partial sums of the remaining block rows with local tiles
+        // of block col k of op(S), which are tiles (i, k) or (k, i) of S.
+        std::vector< std::pair<int64_t, Block const*> > updates;
+        int64_t i_begin = lower ? k+1 : 0;
+        int64_t i_end   = lower ? mt_ : k;
+        for (int64_t i = i_begin; i < i_end; ++i) {
+            auto ij = (op == Op::NoTrans ? std::make_pair( i, k )
+                                         : std::make_pair( k, i ));
+            auto iter = blocks_.find( ij );
+            if (iter != blocks_.end()) {
+                updates.push_back( { i, &iter->second } );
+                if (W[ i ].empty())
+                    W[ i ].assign( blockSize( i ) * nrhs, 0 );
+            }
+        }
+
+        #pragma omp parallel
+        {
+            std::vector<scalar_t> work;
+            #pragma omp for schedule( dynamic, 1 )
+            for (size_t u = 0; u < updates.size(); ++u) {
+                int64_t i = updates[ u ].first;
+                Block const& block = *updates[ u ].second;
+                int64_t ib = blockSize( i );
+                work.resize( block.mb * block.nb );
+                expandTile( block, work.data() );
+                blas::gemm( Layout::ColMajor, op, Op::NoTrans,
+                            ib, nrhs, kb,
+                            one, work.data(), block.mb,
+                                 Yk.data(), kb,
+                            one, W[ i ].data(), ib );
+            }
+        }
+
+        // The diagonal tile's owner keeps the solution.
+        if (mpi_rank_ == root)
+            Y[ k ].swap( Yk );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B using the LU factor, either A in single precision or
+/// the 16-bit copy.
+///
+/// @param[in] A
+///     The LU factor from getrf. Not referenced if compressed.
+///
+/// @param[in] pivots
+///     The pivot indices from getrf.
+///
+/// @param[in,out] B
+///     On entry, the right-hand sides; on exit, the solution.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::getrs(
+    Matrix<scalar_t>& A, Pivots& pivots, Matrix<scalar_t>& B,
+    Options const& opts )
+{
+    if (! compressed()) {
+        slate::getrs( A, pivots, B, opts );
+        return;
+    }
+
+    // Pivot the right hand side matrix.
+    for (int64_t k = 0; k < B.mt(); ++k) {
+        // swap rows in B(k:mt-1, 0:nt-1)
+        internal::permuteRows<Target::HostTask>(
+            Direction::Forward, B.sub( k, B.mt()-1, 0, B.nt()-1 ),
+            pivots.at( k ), Layout::ColMajor );
+    }
+
+    BlockRows Y;
+    gatherRhs( B, Y );
+    trsm( Uplo::Lower, Op::NoTrans, Diag::Unit,    Y, B.n() );
+    trsm( Uplo::Upper, Op::NoTrans, Diag::NonUnit, Y, B.n() );
+    scatterRhs( Y, B );
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B using the Cholesky factor, either A in single precision
+/// or the 16-bit copy.
+///
+/// @param[in] A
+///     The Cholesky factor from potrf. Only A.uplo() is referenced
+///     if compressed.
+///
+/// @param[in,out] B
+///     On entry, the right-hand sides; on exit, the solution.
+///
+template <typename scalar_t>
+void LowPrecisionFactor<scalar_t>::potrs(
+    HermitianMatrix<scalar_t>& A, Matrix<scalar_t>& B,
+    Options const& opts )
+{
+    if (! compressed()) {
+        slate::potrs( A, B, opts );
+        return;
+    }
+
+    Uplo uplo = A.uplo();
+    Op op1 = (uplo == Uplo::Lower ? Op::NoTrans : Op::ConjTrans);
+    Op op2 = (uplo == Uplo::Lower ? Op::ConjTrans : Op::NoTrans);
+
+    BlockRows Y;
+    gatherRhs( B, Y );
+    trsm( uplo, op1, Diag::NonUnit, Y, B.n() );
+    trsm( uplo, op2, Diag::NonUnit, Y, B.n() );
+    scatterRhs( Y, B );
+}
+
+} // namespace internal
+} // namespace slate
+
+#endif // SLATE_INTERNAL_LOWPREC_HH
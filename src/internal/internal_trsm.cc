@@ -110,6 +110,8 @@ void trsm(internal::TargetType<Target::HostNest>,
 //------------------------------------------------------------------------------
 /// Triangular solve matrix (multiple right-hand sides).
 /// Host batched implementation.
+/// Tiles of B with the same size are grouped and solved in chunks,
+/// one chunk per thread, by the portable host batch engine.
 /// @ingroup trsm_internal
 ///
 template <typename scalar_t>
@@ -119,8 +121,38 @@ void trsm(internal::TargetType<Target::HostBatch>,
                                     Matrix<scalar_t>& B,
           int priority, Layout layout, int64_t queue_index )
 {
-    trsm( internal::TargetType<Target::HostTask>(),
-            side, alpha, A, B, priority, layout, queue_index );
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    // CPU assumes column major
+    assert(layout == Layout::ColMajor);
+    assert(A.mt() == 1);
+    assert(side == Side::Right ? B.nt() == 1 : B.mt() == 1);
+
+    std::vector<ij_tuple> B_tiles;
+    std::set<ij_tuple> B_tiles_set;
+    std::vector< std::tuple<int64_t, int64_t> > keys;
+    int64_t B_kt = (side == Side::Right ? B.mt() : B.nt());
+    for (int64_t k = 0; k < B_kt; ++k) {
+        int64_t i = (side == Side::Right ? k : 0);
+        int64_t j = (side == Side::Right ? 0 : k);
+        if (B.tileIsLocal(i, j)) {
+            B_tiles.push_back({i, j});
+            B_tiles_set.insert({i, j});
+            keys.push_back({B.tileMb(i), B.tileNb(j)});
+        }
+    }
+    if (B_tiles.empty())
+        return;
+
+    A.tileGetForReading(0, 0, LayoutConvert(layout));
+    B.tileGetForWriting(B_tiles_set, LayoutConvert(layout));
+
+    Diag diag = A.diag();
+    host_batch_run( host_batch_groups( keys ), priority, [&]( int64_t index ) {
+        int64_t i = std::get<0>( B_tiles[ index ] );
+        int64_t j = std::get<1>( B_tiles[ index ] );
+        tile::trsm( side, diag, alpha, A(0, 0), B(i, j) );
+    } );
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,420 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Multiplies the general m-by-n matrix C by Q from tb2bd, stored in V,
+/// as follows:
+///
+/// op              |  side = Left  |  side = Right
+/// --------------- | ------------- | --------------
+/// op = NoTrans    |  $Q C  $      |  $C Q  $
+/// op = ConjTrans  |  $Q^H C$      |  $C Q^H$
+///
+/// Dispatches to target implementations.
+/// @ingroup heev_internal
+///
+template <Target target, typename scalar_t>
+void unmbr_tb2bd(
+    Side side, Op op,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& C )
+{
+    unmbr_tb2bd(internal::TargetType<target>(), side, op, V, C);
+}
+
+//------------------------------------------------------------------------------
+/// Multiplies C by Q from tb2bd.
+/// Host OpenMP task implementation for any 2D distribution of C.
+///
+/// Each block of reflectors V(0, r) updates a pair of block rows
+/// (side = Left) or block columns (side = Right) of C, using the same
+/// storage and order of blocks as unmtr_hb2st. Blocks are applied in
+/// wavefronts that update disjoint pairs. In each wavefront, V tiles are
+/// broadcast to ranks owning tiles of their pair; for each tile in a pair,
+/// its rank computes the partial product V^H C (or C V), and if the tiles
+/// in a pair are on different ranks, they exchange the partial products,
+/// so C need not be redistributed to a 1D grid first.
+///
+template <typename scalar_t>
+void unmbr_tb2bd(
+    internal::TargetType<Target::HostTask>,
+    Side side, Op op,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& C )
+{
+    const scalar_t zero = 0, one = 1;
+    const int tag_partial = 0;
+
+    bool left = side == Side::Left;
+    int mpi_rank = C.mpiRank();
+    MPI_Comm comm = C.mpiComm();
+    auto mpi_scalar = mpi_type<scalar_t>::value;
+
+    int64_t vm = V.tileMb(0); // == 2 nb
+    int64_t nb = V.tileNb(0);
+    assert( vm == 2*nb );
+
+    // Blocks of reflectors update pairs of tiles along dimension mt;
+    // nt tiles along the other dimension.
+    int64_t mt = left ? C.mt() : C.nt();
+    int64_t nt = left ? C.nt() : C.mt();
+    slate_assert( mt*(mt + 1)/2 == V.nt() );
+
+    // Q = H_0 H_1 ..., where each H_r = I - V_r T_r V_r^H.
+    // Q C and C Q^H apply the last block first, as in unmtr_hb2st;
+    // Q^H C and C Q apply the first block first.
+    // Left  multiplies by I - V op(T) V^H;
+    // Right multiplies by I - V op(T)^H V^H.
+    bool first_block_first = (left == (op != Op::NoTrans));
+    Op opT = (left == (op == Op::NoTrans)) ? Op::NoTrans : Op::ConjTrans;
+
+    // Slice off 1st row of V.
+    auto V_ = V.slice( 1, vm-1, 0, V.n()-1 );
+
+    // Tile of C in block k of pair member i.
+    auto tile_i = [left]( int64_t i, int64_t k ) { return left ? i : k; };
+    auto tile_j = [left]( int64_t i, int64_t k ) { return left ? k : i; };
+    // Rows (left) or cols (right) of tile i of the pair dimension.
+    auto tile_size = [left, &C]( int64_t i ) {
+        return left ? C.tileMb( i ) : C.tileNb( i );
+    };
+    // Cols (left) or rows (right) of tile k of the other dimension.
+    auto tile_size_k = [left, &C]( int64_t k ) {
+        return left ? C.tileNb( k ) : C.tileMb( k );
+    };
+
+    C.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+
+    for (int64_t wave = 0; wave < 2*mt - 1; ++wave) {
+        int64_t j2 = first_block_first ? wave - (mt - 1) : (mt - 1) - wave;
+
+        //--------------------
+        // Blocks in this wavefront update disjoint pairs (i, i+1),
+        // using V(0, r). See SWAN13 for storage layout of V.
+        std::vector<int64_t> block_i, block_r;
+        for (int64_t j = 0; j < mt; ++j) {
+            int64_t i = 2*j - j2;
+            if (j <= i && i < mt) {
+                int64_t mb1 = i+1 < mt ? tile_size( i+1 ) : 0;
+                if (tile_size( i ) - 1 + mb1 > 0) {
+                    block_i.push_back( i );
+                    block_r.push_back( i - j + j*mt - j*(j-1)/2 );
+                }
+            }
+        }
+        int64_t nblocks = block_i.size();
+
+        // Send V(0, r) across ranks owning tiles of its pair.
+        typename Matrix<scalar_t>::BcastList bcast_list_V;
+        for (int64_t b = 0; b < nblocks; ++b) {
+            int64_t i  = block_i[ b ];
+            int64_t i1 = std::min( i+1, mt-1 );
+            if (left)
+                bcast_list_V.push_back(
+                    { 0, block_r[ b ], { C.sub( i, i1, 0, nt-1 ) } } );
+            else
+                bcast_list_V.push_back(
+                    { 0, block_r[ b ], { C.sub( 0, nt-1, i, i1 ) } } );
+        }
+        V.template listBcast<Target::Host>( bcast_list_V, Layout::ColMajor );
+
+        //--------------------
+        // Local work items: tile k of the other dimension for each block,
+        // and the rank owning the other tile of the pair, if different.
+        struct Item {
+            int64_t b, k;
+            bool has0, has1;
+            int other;
+            int64_t offset;     // of partial product in W
+        };
+        std::vector<Item> items;
+        std::vector<bool> block_local( nblocks, false );
+        int64_t w_size = 0;
+        for (int64_t b = 0; b < nblocks; ++b) {
+            int64_t i = block_i[ b ];
+            for (int64_t k = 0; k < nt; ++k) {
+                int rank0 = C.tileRank( tile_i( i, k ), tile_j( i, k ) );
+                int rank1 = i+1 < mt
+                          ? C.tileRank( tile_i( i+1, k ), tile_j( i+1, k ) )
+                          : -1;
+                bool has0 = rank0 == mpi_rank;
+                bool has1 = rank1 == mpi_rank;
+                if (has0 || has1) {
+                    int other = -1;
+                    if (has0 && rank1 >= 0 && ! has1)
+                        other = rank1;
+                    else if (has1 && ! has0)
+                        other = rank0;
+                    items.push_back( { b, k, has0, has1, other, w_size } );
+                    w_size += nb * tile_size_k( k );
+                    block_local[ b ] = true;
+                }
+            }
+        }
+        if (items.empty())
+            continue;
+
+        // Workspaces: copy of each V tile with unit diagonal,
+        // tau is diag of each V tile, T, VS = V op(T).
+        // V tiles are not modified in place, since received tiles may be
+        // shared by ranks on the same node.
+        std::vector<scalar_t> Vw( nblocks*vm*nb ), VS( nblocks*vm*nb );
+        std::vector<scalar_t> tau( nblocks*nb ), T( nblocks*nb*nb );
+        std::vector<scalar_t> W( w_size ), W_other( w_size );
+
+        //--------------------
+        // Form T and VS for each local block.
+        #pragma omp taskgroup
+        for (int64_t b = 0; b < nblocks; ++b) {
+            if (! block_local[ b ])
+                continue;
+            #pragma omp task slate_omp_default_none \
+                shared( V_, Vw, tau, T, VS, block_i, block_r ) \
+                firstprivate( b, mt, nb, vm, zero, one, opT, tile_size )
+            {
+                int64_t i = block_i[ b ];
+                int64_t mb0 = tile_size( i ) - 1;
+                int64_t mb1 = i+1 < mt ? tile_size( i+1 ) : 0;
+                int64_t vm_ = mb0 + mb1;
+                int64_t vnb = std::min( nb, vm_ );
+
+                auto Vr = V_(0, block_r[ b ]);
+                scalar_t* Vr_data = &Vw[ b*vm*nb ];
+                int64_t ldv = vm;
+                lapack::lacpy( lapack::MatrixType::General, vm_, vnb,
+                               Vr.data(), Vr.stride(), Vr_data, ldv );
+
+                // Copy tau, which is stored on diag(Vr), and set diag(Vr) = 1.
+                scalar_t* tau_b = &tau[ b*nb ];
+                for (int64_t ii = 0; ii < vnb; ++ii) {
+                    tau_b[ ii ] = Vr_data[ ii + ii*ldv ];
+                    Vr_data[ ii + ii*ldv ] = 1;
+                }
+
+                scalar_t* T_b = &T[ b*nb*nb ];
+                lapack::laset( lapack::MatrixType::General, vnb, vnb,
+                               zero, zero, T_b, nb );
+                lapack::larft( Direction::Forward, lapack::StoreV::Columnwise,
+                               vm_, vnb, Vr_data, ldv, tau_b, T_b, nb );
+
+                // VS = V op(T). Assumes 0's stored in lower T.
+                blas::gemm( Layout::ColMajor, Op::NoTrans, opT,
+                            vm_, vnb, vnb,
+                            one,  Vr_data, ldv,
+                                  T_b, nb,
+                            zero, &VS[ b*vm*nb ], vm );
+            }
+        }
+
+        //--------------------
+        // Partial products of local tiles:
+        // left,  W = V0^H C0 + V1^H C1 is vnb-by-cnb;
+        // right, W = C0 V0 + C1 V1 is cnb-by-vnb.
+        // C0 excludes 1st row (left) or col (right) of tile i.
+        #pragma omp taskgroup
+        for (size_t it = 0; it < items.size(); ++it) {
+            #pragma omp task slate_omp_default_none \
+                shared( C, Vw, W, items, block_i ) \
+                firstprivate( it, left, mt, nb, vm, zero, one, \
+                              tile_i, tile_j, tile_size, tile_size_k )
+            {
+                Item& item = items[ it ];
+                int64_t i = block_i[ item.b ];
+                int64_t k = item.k;
+                int64_t mb0 = tile_size( i ) - 1;
+                int64_t mb1 = i+1 < mt ? tile_size( i+1 ) : 0;
+                int64_t vnb = std::min( nb, mb0 + mb1 );
+                int64_t cnb = tile_size_k( k );
+
+                scalar_t* Vr_data = &Vw[ item.b*vm*nb ];
+                int64_t ldv = vm;
+                scalar_t* W_data = &W[ item.offset ];
+                int64_t ldw = left ? nb : std::max( cnb, int64_t( 1 ) );
+
+                scalar_t beta = zero;
+                if (item.has0) {
+                    auto C0 = C( tile_i( i, k ), tile_j( i, k ) );
+                    int64_t ldc = C0.stride();
+                    if (left) {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::ConjTrans, Op::NoTrans,
+                                    vnb, cnb, mb0,
+                                    one,  Vr_data, ldv,
+                                          &C0.data()[ 1 ], ldc,
+                                    zero, W_data, ldw );
+                    }
+                    else {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::NoTrans, Op::NoTrans,
+                                    cnb, vnb, mb0,
+                                    one,  &C0.data()[ ldc ], ldc,
+                                          Vr_data, ldv,
+                                    zero, W_data, ldw );
+                    }
+                    beta = one;
+                }
+                if (item.has1) {
+                    auto C1 = C( tile_i( i+1, k ), tile_j( i+1, k ) );
+                    if (left) {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::ConjTrans, Op::NoTrans,
+                                    vnb, cnb, mb1,
+                                    one,  &Vr_data[ mb0 ], ldv,
+                                          C1.data(), C1.stride(),
+                                    beta, W_data, ldw );
+                    }
+                    else {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::NoTrans, Op::NoTrans,
+                                    cnb, vnb, mb1,
+                                    one,  C1.data(), C1.stride(),
+                                          &Vr_data[ mb0 ], ldv,
+                                    beta, W_data, ldw );
+                    }
+                }
+            }
+        }
+
+        //--------------------
+        // Exchange partial products between ranks owning the two tiles of
+        // a pair. Both ranks post messages in the same order, so they match.
+        std::vector<MPI_Request> requests;
+        for (auto& item : items) {
+            if (item.other >= 0) {
+                int64_t count = nb * tile_size_k( item.k );
+                requests.push_back( MPI_REQUEST_NULL );
+                slate_mpi_call(
+                    MPI_Irecv( &W_other[ item.offset ], count, mpi_scalar,
+                               item.other, tag_partial, comm,
+                               &requests.back() ) );
+                requests.push_back( MPI_REQUEST_NULL );
+                slate_mpi_call(
+                    MPI_Isend( &W[ item.offset ], count, mpi_scalar,
+                               item.other, tag_partial, comm,
+                               &requests.back() ) );
+            }
+        }
+        slate_mpi_call(
+            MPI_Waitall( requests.size(), requests.data(),
+                         MPI_STATUSES_IGNORE ) );
+
+        //--------------------
+        // Update local tiles:
+        // left,  C0 -= VS0 W,    C1 -= VS1 W;
+        // right, C0 -= W VS0^H,  C1 -= W VS1^H.
+        #pragma omp taskgroup
+        for (size_t it = 0; it < items.size(); ++it) {
+            #pragma omp task slate_omp_default_none \
+                shared( C, VS, W, W_other, items, block_i ) \
+                firstprivate( it, left, mt, nb, vm, one, \
+                              tile_i, tile_j, tile_size, tile_size_k )
+            {
+                Item& item = items[ it ];
+                int64_t i = block_i[ item.b ];
+                int64_t k = item.k;
+                int64_t mb0 = tile_size( i ) - 1;
+                int64_t mb1 = i+1 < mt ? tile_size( i+1 ) : 0;
+                int64_t vnb = std::min( nb, mb0 + mb1 );
+                int64_t cnb = tile_size_k( k );
+
+                scalar_t* VS_data = &VS[ item.b*vm*nb ];
+                scalar_t* W_data = &W[ item.offset ];
+                int64_t ldw = left ? nb : std::max( cnb, int64_t( 1 ) );
+                if (item.other >= 0) {
+                    // W += partial product from the other rank.
+                    scalar_t* W_other_data = &W_other[ item.offset ];
+                    int64_t m_ = left ? vnb : cnb;
+                    int64_t n_ = left ? cnb : vnb;
+                    for (int64_t jj = 0; jj < n_; ++jj)
+                        for (int64_t ii = 0; ii < m_; ++ii)
+                            W_data[ ii + jj*ldw ] += W_other_data[ ii + jj*ldw ];
+                }
+
+                if (item.has0) {
+                    auto C0 = C( tile_i( i, k ), tile_j( i, k ) );
+                    int64_t ldc = C0.stride();
+                    if (left) {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::NoTrans, Op::NoTrans,
+                                    mb0, cnb, vnb,
+                                    -one, VS_data, vm,
+                                          W_data, ldw,
+                                    one,  &C0.data()[ 1 ], ldc );
+                    }
+                    else {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::NoTrans, Op::ConjTrans,
+                                    cnb, mb0, vnb,
+                                    -one, W_data, ldw,
+                                          VS_data, vm,
+                                    one,  &C0.data()[ ldc ], ldc );
+                    }
+                }
+                if (item.has1) {
+                    auto C1 = C( tile_i( i+1, k ), tile_j( i+1, k ) );
+                    if (left) {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::NoTrans, Op::NoTrans,
+                                    mb1, cnb, vnb,
+                                    -one, &VS_data[ mb0 ], vm,
+                                          W_data, ldw,
+                                    one,  C1.data(), C1.stride() );
+                    }
+                    else {
+                        blas::gemm( Layout::ColMajor,
+                                    Op::NoTrans, Op::ConjTrans,
+                                    cnb, mb1, vnb,
+                                    -one, W_data, ldw,
+                                          &VS_data[ mb0 ], vm,
+                                    one,  C1.data(), C1.stride() );
+                    }
+                }
+            }
+        }
+
+        // Release V tiles.
+        for (int64_t b = 0; b < nblocks; ++b) {
+            V.releaseLocalWorkspaceTile( 0, block_r[ b ] );
+            V.releaseRemoteWorkspaceTile( 0, block_r[ b ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmbr_tb2bd<Target::HostTask, float>(
+    Side side, Op op,
+    Matrix<float>& V,
+    Matrix<float>& C );
+
+template
+void unmbr_tb2bd<Target::HostTask, double>(
+    Side side, Op op,
+    Matrix<double>& V,
+    Matrix<double>& C );
+
+template
+void unmbr_tb2bd<Target::HostTask, std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >& V,
+    Matrix< std::complex<float> >& C );
+
+template
+void unmbr_tb2bd<Target::HostTask, std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >& V,
+    Matrix< std::complex<double> >& C );
+
+} // namespace internal
+} // namespace slate
@@ -99,12 +99,25 @@ void unmtr_hb2st( internal::TargetType<target>,
 
     // Early exit if this rank has no data in C.
     // This lets later code assume every rank gets tiles in V, etc.
+    // If V is distributed, as from heev, this rank may still own tiles
+    // of V, so first send those, in the same order as the tasks below.
     std::set<int> ranks;
     auto Crow = C.sub(0, 0, 0, nt-1);
     Crow.getRanks(&ranks);
 
-    if (ranks.find( C.mpiRank() ) == ranks.end())
+    if (ranks.find( C.mpiRank() ) == ranks.end()) {
+        for (int j2 = mt-1; j2 > -mt; --j2) {
+            for (int j = 0; j < mt; ++j) {
+                int i = 2*j - j2;
+                int64_t r = i - j + j*mt - j*(j-1)/2;
+                if (j <= i && i < mt && V.tileIsLocal(0, r)) {
+                    V.tileBcast(0, r, C.sub(i, i, 0, nt-1),
+                                Layout::ColMajor, j);
+                }
+            }
+        }
         return;
+    }
 
     // OpenMP needs pointer types, but vectors are exception safe.
     // Add one phantom row at bottom to ease specifying dependencies.
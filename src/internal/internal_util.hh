@@ -11,6 +11,7 @@
 
 #include "slate/internal/mpi.hh"
 #include "slate/Matrix.hh"
+#include "slate/HermitianMatrix.hh"
 
 #include <cmath>
 #include <complex>
@@ -138,17 +139,29 @@ bool iterRefConverged(std::vector<scalar_t>& colnorms_R,
 }
 
 //------------------------------------------------------------------------------
-/// Helper function to allocate a krylov basis
+/// Helper function to allocate a krylov basis of nblocks blocks of vectors.
+/// Each block is tiled and distributed like B, so blocks conform with B.
 template<typename scalar_t>
-slate::Matrix<scalar_t> alloc_basis(slate::BaseMatrix<scalar_t>& A, int64_t n,
+slate::Matrix<scalar_t> alloc_basis(slate::Matrix<scalar_t>& B, int64_t nblocks,
                                     Target target)
 {
-    auto mpiComm = A.mpiComm();
-    auto tileMbFunc = A.tileMbFunc();
-    auto tileNbFunc = A.tileNbFunc();
-    auto tileRankFunc = A.tileRankFunc();
-    auto tileDeviceFunc = A.tileDeviceFunc();
-    Matrix<scalar_t> V(A.m(), n, tileMbFunc, tileNbFunc,
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    auto mpiComm = B.mpiComm();
+    int64_t nt = B.nt();
+    std::function<int64_t (int64_t i)> tileMbFunc
+        = [B](int64_t i) { return B.tileMb(i); };
+    std::function<int64_t (int64_t j)> tileNbFunc
+        = [B, nt](int64_t j) { return B.tileNb(j % nt); };
+    std::function<int (ij_tuple ij)> tileRankFunc
+        = [B, nt](ij_tuple ij) {
+            return B.tileRank(std::get<0>(ij), std::get<1>(ij) % nt);
+        };
+    std::function<int (ij_tuple ij)> tileDeviceFunc
+        = [B, nt](ij_tuple ij) {
+            return B.tileDevice(std::get<0>(ij), std::get<1>(ij) % nt);
+        };
+    Matrix<scalar_t> V(B.m(), nblocks*B.n(), tileMbFunc, tileNbFunc,
                        tileRankFunc, tileDeviceFunc, mpiComm);
     V.insertLocalTiles(target);
     return V;
@@ -182,6 +195,83 @@ std::vector<int64_t> tile_offsets( RowCol dim, slate::BaseMatrix<scalar_t>& A )
     return offset_list;
 }
 
+//------------------------------------------------------------------------------
+/// Copies an upper Hermitian matrix A to a lower Hermitian matrix L,
+/// with L(i, j) = A(j, i)^H. Tile L(i, j) is on the same rank and device
+/// as A(j, i), i.e., L has the transposed distribution, so the copy is local.
+/// Used by the Hermitian reductions (he2hb, unmtr_he2hb, heev) that operate
+/// on the lower triangle.
+///
+/// @param[in] A
+///     The n-by-n upper Hermitian matrix A.
+///
+/// @return L, the n-by-n lower Hermitian matrix, with local tiles on host.
+///
+/// @see hermitian_upper_from_lower
+///
+template <typename scalar_t>
+slate::HermitianMatrix<scalar_t> hermitian_lower_from_upper(
+    slate::HermitianMatrix<scalar_t>& A)
+{
+    using ij_tuple = typename BaseMatrix<scalar_t>::ij_tuple;
+
+    assert( A.uplo() == Uplo::Upper );
+
+    std::function<int64_t (int64_t j)>
+        tileNb = [A]( int64_t j ) {
+            return A.tileNb( j );
+        };
+    std::function<int (ij_tuple ij)>
+        tileRank = [A]( ij_tuple ij ) {
+            return A.tileRank( std::get<1>( ij ), std::get<0>( ij ) );
+        };
+    std::function<int (ij_tuple ij)>
+        tileDevice = [A]( ij_tuple ij ) {
+            return A.tileDevice( std::get<1>( ij ), std::get<0>( ij ) );
+        };
+    slate::HermitianMatrix<scalar_t> L(
+        Uplo::Lower, A.n(), tileNb, tileRank, tileDevice, A.mpiComm() );
+
+    int64_t nt = A.nt();
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = j; i < nt; ++i) {
+            if (L.tileIsLocal( i, j )) {
+                A.tileGetForReading( j, i, HostNum, LayoutConvert::ColMajor );
+                L.tileInsert( i, j );
+                tile::gecopy( conj_transpose( A( j, i ) ), L( i, j ) );
+            }
+        }
+    }
+    return L;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the lower Hermitian matrix L back to the upper Hermitian matrix A,
+/// with A(j, i) = L(i, j)^H. L must come from hermitian_lower_from_upper( A ).
+///
+/// @see hermitian_lower_from_upper
+///
+template <typename scalar_t>
+void hermitian_upper_from_lower(
+    slate::HermitianMatrix<scalar_t>& L,
+    slate::HermitianMatrix<scalar_t>& A)
+{
+    assert( L.uplo() == Uplo::Lower );
+    assert( A.uplo() == Uplo::Upper );
+
+    int64_t nt = A.nt();
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = j; i < nt; ++i) {
+            if (L.tileIsLocal( i, j )) {
+                L.tileGetForReading( i, j, HostNum, LayoutConvert::ColMajor );
+                A.tileGetForWriting( j, i, HostNum, LayoutConvert::ColMajor );
+                auto Aji = A( j, i );
+                tile::gecopy( conj_transpose( L( i, j ) ), Aji );
+            }
+        }
+    }
+}
+
 
 } // namespace internal
 } // namespace slate
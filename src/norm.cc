@@ -15,6 +15,252 @@ namespace slate {
 
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// @internal
+/// MPI reduction for the fused norms buffer,
+///     [ max, scale, sumsq, col sums, row sums ],
+/// passed as a single element of a contiguous datatype, so MPI never splits
+/// it. Combines max with max_nan, (scale, sumsq) as in LAPACK lassq,
+/// and adds the sums.
+/// @ingroup norm_impl
+///
+template <typename real_t>
+void mpi_norms_op(
+    void* invec, void* inoutvec, int* len, MPI_Datatype* datatype )
+{
+    int size;
+    MPI_Type_size( *datatype, &size );
+    int64_t count = size / sizeof( real_t );
+    real_t* x = (real_t*) invec;
+    real_t* y = (real_t*) inoutvec;
+    for (int k = 0; k < *len; ++k) {
+        y[ 0 ] = max_nan( x[ 0 ], y[ 0 ] );
+        combine_sumsq( y[ 1 ], y[ 2 ], x[ 1 ], x[ 2 ] );
+        for (int64_t i = 3; i < count; ++i)
+            y[ i ] += x[ i ];
+        x += count;
+        y += count;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @internal
+/// Distributed parallel general matrix norms, computing several norms
+/// in one pass over the local tiles and one nonblocking reduction.
+/// Host implementation.
+/// @ingroup norm_impl
+///
+template <typename scalar_t>
+void norms(
+    std::vector<Norm> in_norms, Matrix<scalar_t> A,
+    blas::real_type<scalar_t>* values,
+    Options const& opts )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Undo any transpose, which switches one <=> inf norms.
+    if (A.op() == Op::ConjTrans || A.op() == Op::Trans) {
+        for (auto& in_norm : in_norms) {
+            if (in_norm == Norm::One)
+                in_norm = Norm::Inf;
+            else if (in_norm == Norm::Inf)
+                in_norm = Norm::One;
+        }
+    }
+    if (A.op() == Op::ConjTrans)
+        A = conj_transpose( A );
+    else if (A.op() == Op::Trans)
+        A = transpose( A );
+
+    bool want_col_sums = false, want_row_sums = false, want_fro = false;
+    for (auto in_norm : in_norms) {
+        slate_error_if( in_norm != Norm::Max && in_norm != Norm::One
+                        && in_norm != Norm::Inf && in_norm != Norm::Fro );
+        want_col_sums |= in_norm == Norm::One;
+        want_row_sums |= in_norm == Norm::Inf;
+        want_fro      |= in_norm == Norm::Fro;
+    }
+
+    int64_t mt = A.mt();
+    int64_t nt = A.nt();
+
+    // Local tiles, and offsets of local block rows and cols
+    // in the compressed local sums.
+    std::vector< std::tuple<int64_t, int64_t> > tiles;
+    std::vector<int64_t> row_local( mt, -1 ), col_local( nt, -1 );
+    int64_t m_local = 0, n_local = 0;
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = 0; i < mt; ++i) {
+            if (A.tileIsLocal( i, j )) {
+                tiles.push_back( { i, j } );
+                if (row_local[ i ] < 0) {
+                    row_local[ i ] = m_local;
+                    m_local += A.tileMb( i );
+                }
+                if (col_local[ j ] < 0) {
+                    col_local[ j ] = n_local;
+                    n_local += A.tileNb( j );
+                }
+            }
+        }
+    }
+    A.tileGetAllForReading( HostNum, LayoutConvert::None );
+
+    real_t max = 0, scale = 0, sumsq = 1;
+    std::vector<real_t> col_sums( want_col_sums ? n_local : 0, 0 ),
+                        row_sums( want_row_sums ? m_local : 0, 0 );
+
+    // Sweeps the local tiles with one task per chunk of tiles. Each task
+    // accumulates its own max, (scale, sumsq), and sums, then adds them in.
+    auto sweep = [&]() {
+        int64_t ntiles = tiles.size();
+        int64_t nchunks = std::min( ntiles, int64_t( omp_get_num_threads() ) );
+        for (int64_t c = 0; c < nchunks; ++c) {
+            #pragma omp task slate_omp_default_none \
+                shared( A, tiles, row_local, col_local, max, scale, sumsq, \
+                        col_sums, row_sums ) \
+                firstprivate( c, nchunks, ntiles, want_row_sums, \
+                              want_col_sums, want_fro )
+            {
+                real_t max_task = 0, scale_task = 0, sumsq_task = 1;
+                std::vector<real_t> col_sums_task( col_sums.size(), 0 ),
+                                    row_sums_task( row_sums.size(), 0 );
+
+                for (int64_t k = c; k < ntiles; k += nchunks) {
+                    int64_t i = std::get<0>( tiles[ k ] );
+                    int64_t j = std::get<1>( tiles[ k ] );
+                    auto T = A( i, j );
+                    // Strides between consecutive rows and cols of T.
+                    bool col_major = T.layout() == Layout::ColMajor;
+                    int64_t inc_i = col_major ? 1 : T.stride();
+                    int64_t inc_j = col_major ? T.stride() : 1;
+                    real_t* row_sums_i = want_row_sums
+                                       ? &row_sums_task[ row_local[ i ] ]
+                                       : nullptr;
+                    for (int64_t jj = 0; jj < T.nb(); ++jj) {
+                        scalar_t const* Tj = T.data() + jj*inc_j;
+                        real_t sum = 0;
+                        for (int64_t ii = 0; ii < T.mb(); ++ii) {
+                            real_t a = std::abs( Tj[ ii*inc_i ] );
+                            max_task = max_nan( a, max_task );
+                            sum += a;
+                            if (want_row_sums)
+                                row_sums_i[ ii ] += a;
+                        }
+                        if (want_col_sums)
+                            col_sums_task[ col_local[ j ] + jj ] += sum;
+                        if (want_fro)
+                            lapack::lassq( T.mb(), Tj, inc_i,
+                                           &scale_task, &sumsq_task );
+                    }
+                }
+
+                #pragma omp critical (slate_norms)
+                {
+                    max = max_nan( max_task, max );
+                    combine_sumsq( scale, sumsq, scale_task, sumsq_task );
+                    for (size_t jj = 0; jj < col_sums.size(); ++jj)
+                        col_sums[ jj ] += col_sums_task[ jj ];
+                    for (size_t ii = 0; ii < row_sums.size(); ++ii)
+                        row_sums[ ii ] += row_sums_task[ ii ];
+                }
+            }
+        }
+        #pragma omp taskwait
+    };
+
+    // Inside a parallel region, e.g., a solver's, the tasks run on its
+    // threads; only a call outside any region opens one.
+    if (omp_in_parallel()) {
+        sweep();
+    }
+    else {
+        #pragma omp parallel
+        #pragma omp master
+        sweep();
+    }
+
+    // Scatter local sums into the global reduction buffer.
+    int64_t m = want_row_sums ? A.m() : 0;
+    int64_t n = want_col_sums ? A.n() : 0;
+    std::vector<real_t> buffer( 3 + n + m, 0 );
+    buffer[ 0 ] = max;
+    buffer[ 1 ] = scale;
+    buffer[ 2 ] = sumsq;
+    if (want_col_sums) {
+        int64_t jj = 0;  // global col index
+        for (int64_t j = 0; j < nt; ++j) {
+            if (col_local[ j ] >= 0) {
+                std::copy_n( &col_sums[ col_local[ j ] ], A.tileNb( j ),
+                             &buffer[ 3 + jj ] );
+            }
+            jj += A.tileNb( j );
+        }
+    }
+    if (want_row_sums) {
+        int64_t ii = 0;  // global row index
+        for (int64_t i = 0; i < mt; ++i) {
+            if (row_local[ i ] >= 0) {
+                std::copy_n( &row_sums[ row_local[ i ] ], A.tileMb( i ),
+                             &buffer[ 3 + n + ii ] );
+            }
+            ii += A.tileMb( i );
+        }
+    }
+
+    // One reduction for all norms, created once per precision.
+    static MPI_Op op_norms = [] {
+        MPI_Op op;
+        slate_mpi_call(
+            MPI_Op_create( mpi_norms_op<real_t>, true, &op ) );
+        return op;
+    }();
+    MPI_Datatype buffer_type;
+    slate_mpi_call(
+        MPI_Type_contiguous( buffer.size(), mpi_type<real_t>::value,
+                             &buffer_type ) );
+    slate_mpi_call(
+        MPI_Type_commit( &buffer_type ) );
+    MPI_Request request;
+    {
+        trace::Block trace_block( "MPI_Iallreduce" );
+        slate_mpi_call(
+            MPI_Iallreduce( MPI_IN_PLACE, buffer.data(), 1, buffer_type,
+                            op_norms, A.mpiComm(), &request ) );
+    }
+
+    // Release host copies of device tiles while the reduction proceeds.
+    A.releaseWorkspace();
+
+    slate_mpi_call(
+        MPI_Wait( &request, MPI_STATUS_IGNORE ) );
+    slate_mpi_call(
+        MPI_Type_free( &buffer_type ) );
+
+    for (size_t k = 0; k < in_norms.size(); ++k) {
+        real_t value = 0;
+        switch (in_norms[ k ]) {
+            case Norm::Max:
+                value = buffer[ 0 ];
+                break;
+            case Norm::Fro:
+                value = buffer[ 1 ] * sqrt( buffer[ 2 ] );
+                break;
+            case Norm::One:
+                for (int64_t jj = 0; jj < n; ++jj)
+                    value = max_nan( buffer[ 3 + jj ], value );
+                break;
+            case Norm::Inf:
+                for (int64_t ii = 0; ii < m; ++ii)
+                    value = max_nan( buffer[ 3 + n + ii ], value );
+                break;
+            default:
+                break;
+        }
+        values[ k ] = value;
+    }
+}
+
 //------------------------------------------------------------------------------
 /// @internal
 /// Distributed parallel general matrix norm.
@@ -31,6 +277,15 @@ norm(
     using real_t = blas::real_type<scalar_t>;
     using internal::mpi_max_nan;
 
+    // General matrices on the host use the fused engine.
+    if constexpr (std::is_same< matrix_type, Matrix<scalar_t> >::value) {
+        if (target != Target::Devices) {
+            real_t value;
+            impl::norms( { in_norm }, A, &value, opts );
+            return value;
+        }
+    }
+
     // Undo any transpose, which switches one <=> inf norms.
     if (A.op() == Op::ConjTrans || A.op() == Op::Trans) {
         if (in_norm == Norm::One)
@@ -238,6 +493,57 @@ norm(
     return -1.0;  // unreachable; silence error
 }
 
+//------------------------------------------------------------------------------
+/// Distributed parallel general matrix norms, computing several norms of A
+/// in a single pass over its local tiles and a single nonblocking reduction.
+/// This is cheaper than separate calls to norm, e.g., when both the one and
+/// inf norms are needed.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] in_norms
+///     Norms to compute, in any order and combination of
+///     Norm::Max, Norm::One, Norm::Inf, and Norm::Fro; see norm.
+///
+/// @param[in] A
+///     The matrix A.
+///
+/// @param[out] values
+///     Array of length in_norms.size().
+///     On exit, values[ k ] is the norm in_norms[ k ] of A.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Possible options:
+///     - Option::Target:
+///       Implementation to target. Possible values:
+///       - HostTask:  OpenMP tasks on CPU host [default].
+///       - HostNest:  nested OpenMP parallel for loop on CPU host.
+///       - Devices:   batched BLAS on GPU device;
+///                    computes each norm separately.
+///
+/// @ingroup norm
+///
+template <typename scalar_t>
+void norms(
+    std::vector<Norm> const& in_norms,
+    Matrix<scalar_t>& A,
+    blas::real_type<scalar_t>* values,
+    Options const& opts )
+{
+    Target target = get_option( opts, Option::Target, Target::HostTask );
+
+    if (target == Target::Devices) {
+        // Device kernels compute one norm at a time.
+        for (size_t k = 0; k < in_norms.size(); ++k)
+            values[ k ] = impl::norm<Target::Devices>( in_norms[ k ], A, opts );
+    }
+    else {
+        impl::norms( in_norms, A, values, opts );
+    }
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -365,4 +671,33 @@ double norm(
     Norm in_norm, HermitianBandMatrix< std::complex<double> >& A,
     Options const& opts);
 
+//--------------------
+template
+void norms(
+    std::vector<Norm> const& in_norms,
+    Matrix<float>& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms,
+    Matrix<double>& A,
+    double* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms,
+    Matrix< std::complex<float> >& A,
+    float* values,
+    Options const& opts);
+
+template
+void norms(
+    std::vector<Norm> const& in_norms,
+    Matrix< std::complex<double> >& A,
+    double* values,
+    Options const& opts);
+
 } // namespace slate
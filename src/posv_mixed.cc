@@ -9,6 +9,7 @@
 #include "slate/HermitianMatrix.hh"
 #include "internal/internal.hh"
 #include "internal/internal_util.hh"
+#include "internal/internal_lowprec.hh"
 
 namespace slate {
 
@@ -94,6 +95,17 @@ namespace slate {
 ///     - Option::UseFallbackSolver:
 ///       If true and iterative refinement fails to converge, the problem is
 ///       resolved with partial-pivoted LU. Default true
+///     - Option::FactorPrecision:
+///       Storage precision of the low-precision Cholesky factor. Possible values:
+///       - Single:   keep the single precision factor [default].
+///       - Half:     store the factor in fp16 after potrf.
+///       - BFloat16: store the factor in bfloat16 after potrf.
+///       The factorization is done in single precision either way, so
+///       its peak memory and communication are unchanged. Storing the
+///       factor in 16 bits saves memory only during refinement, after the
+///       single precision factor is freed. The 16-bit factor is applied
+///       in single precision on the host, and refinement recovers the
+///       accuracy.
 ///
 /// @return 0: successful exit
 /// @return i > 0: the leading minor of order $i$ of $A$ is not
@@ -127,6 +139,8 @@ int64_t posv_mixed(
     int64_t itermax = get_option<int64_t>( opts, Option::MaxIterations, 30 );
     double tol = get_option<double>( opts, Option::Tolerance, eps*std::sqrt(A.m()) );
     bool use_fallback = get_option<int64_t>( opts, Option::UseFallbackSolver, true );
+    FactorPrecision factor_precision = get_option(
+        opts, Option::FactorPrecision, FactorPrecision::Single );
     bool converged = false;
     iter = 0;
 
@@ -135,6 +149,7 @@ int64_t posv_mixed(
     // workspace
     auto R    = B.emptyLike();
     auto A_lo = A.template emptyLike<scalar_lo>();
+    internal::LowPrecisionFactor<scalar_lo> A_factor( factor_precision );
     auto X_lo = X.template emptyLike<scalar_lo>();
 
     std::vector<real_hi> colnorms_X( X.n() );
@@ -187,9 +202,17 @@ int64_t posv_mixed(
         iter = -3;
     }
     else {
+        if (A_factor.compressed()) {
+            // Store the factor in 16 bits and free the single precision copy.
+            Timer t_compress_lo;
+            A_factor.compress( A_lo );
+            A_lo.clear();
+            timers[ "posv_mixed::compress_lo" ] = t_compress_lo.stop();
+        }
+
         // Solve the system A_lo * X_lo = B_lo.
         Timer t_potrs_lo;
-        potrs( A_lo, X_lo, opts );
+        A_factor.potrs( A_lo, X_lo, opts );
         timers[ "posv_mixed::potrs_lo" ] = t_potrs_lo.stop();
 
         // Convert X_lo to high precision.
@@ -223,7 +246,7 @@ int64_t posv_mixed(
 
             // Solve the system A_lo * X_lo = R_lo.
             t_potrs_lo.start();
-            potrs( A_lo, X_lo, opts );
+            A_factor.potrs( A_lo, X_lo, opts );
             timers[ "posv_mixed::potrs_lo" ] += t_potrs_lo.stop();
 
             // Convert X_lo back to double precision and update the current iterate.
@@ -40,6 +40,12 @@ int64_t potrf(
     // Options
     int64_t lookahead = get_option<Option::Lookahead>( opts, 1 );
     bool hold_local_workspace = get_option<Option::HoldLocalWorkspace>( opts, false );
+    int64_t saved_segment_size = A.bcastSegmentSize();
+    A.setBcastSegmentSize(
+        get_option<Option::BcastSegmentSize>( opts, saved_segment_size ) );
+    int64_t saved_shared = A.bcastSharedMemory();
+    A.setBcastSharedMemory(
+        get_option<Option::BcastSharedMemory>( opts, saved_shared ) );
 
     // if upper, change to lower
     if (A.uplo() == Uplo::Upper) {
@@ -205,6 +211,9 @@ int64_t potrf(
         }
     }
 
+    A.setBcastSegmentSize( saved_segment_size );
+    A.setBcastSharedMemory( saved_shared );
+
     internal::reduce_info( &info, A.mpiComm() );
     return info;
 }
@@ -244,6 +253,14 @@ int64_t potrf(
 ///     - Option::Lookahead:
 ///       Number of panels to overlap with matrix updates.
 ///       lookahead >= 0. Default 1.
+///     - Option::BcastSegmentSize:
+///       Segment size in bytes for pipelined broadcast of tiles larger
+///       than it, useful for large nb. 0 disables segmenting.
+///       Default A.bcastSegmentSize().
+///     - Option::BcastSharedMemory:
+///       Number of tiles per rank in a node-shared window, through which
+///       ranks on the same node as a tile's owner read broadcast tiles
+///       without copying them. 0 disables it. Default A.bcastSharedMemory().
 ///     - Option::Target:
 ///       Implementation to target. Possible values:
 ///       - HostTask:  OpenMP tasks on CPU host [default].
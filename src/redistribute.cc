@@ -11,9 +11,104 @@
 
 namespace slate {
 
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Row (or column) interval that lies within a single block row (column)
+/// of both A and B.
+///
+struct RedistributeSpan {
+    int64_t size;
+    int64_t a_index, a_offset;  ///< block row (col) and offset in A
+    int64_t b_index, b_offset;  ///< block row (col) and offset in B
+};
+
+//------------------------------------------------------------------------------
+/// Merges the tile boundaries of A and B along one dimension,
+/// so each span lies within one tile of A and one tile of B.
+///
+/// @param[in] n
+///     Length of the dimension.
+///
+/// @param[in] a_size
+///     Function returning the size of block a_index of A.
+///
+/// @param[in] b_size
+///     Function returning the size of block b_index of B.
+///
+template <typename a_size_t, typename b_size_t>
+std::vector<RedistributeSpan> redistribute_spans(
+    int64_t n, a_size_t&& a_size, b_size_t&& b_size )
+{
+    std::vector<RedistributeSpan> spans;
+    int64_t ia = 0, ia_offset = 0, ib = 0, ib_offset = 0;
+    for (int64_t i = 0; i < n; ) {
+        int64_t a_rem = a_size( ia ) - ia_offset;
+        int64_t b_rem = b_size( ib ) - ib_offset;
+        int64_t size = std::min( a_rem, b_rem );
+        spans.push_back( { size, ia, ia_offset, ib, ib_offset } );
+        i += size;
+        ia_offset += size;
+        ib_offset += size;
+        if (ia_offset == a_size( ia )) {
+            ++ia;
+            ia_offset = 0;
+        }
+        if (ib_offset == b_size( ib )) {
+            ++ib;
+            ib_offset = 0;
+        }
+    }
+    return spans;
+}
+
+//------------------------------------------------------------------------------
+/// Copies the mb-by-nb block of op(T) starting at (ioffset, joffset)
+/// to or from the column-major buffer, conjugating if requested.
+///
+/// @param[in] pack
+///     If true, copy from T to buffer; otherwise from buffer to T.
+///
+template <typename scalar_t>
+void redistribute_copy(
+    bool pack, bool is_conj,
+    Tile<scalar_t>& T, int64_t ioffset, int64_t joffset,
+    int64_t mb, int64_t nb, scalar_t* buffer, int64_t ldb )
+{
+    using blas::conj;
+
+    // Strides between consecutive rows and cols of op(T).
+    bool col_major = (T.op() == Op::NoTrans) == (T.layout() == Layout::ColMajor);
+    int64_t inc_i = col_major ? 1 : T.stride();
+    int64_t inc_j = col_major ? T.stride() : 1;
+    scalar_t* T00 = &T.at( ioffset, joffset );
+    for (int64_t j = 0; j < nb; ++j) {
+        scalar_t* Tj = T00 + j*inc_j;
+        scalar_t* bj = buffer + j*ldb;
+        if (pack) {
+            for (int64_t i = 0; i < mb; ++i)
+                bj[ i ] = is_conj ? conj( Tj[ i*inc_i ] ) : Tj[ i*inc_i ];
+        }
+        else {
+            for (int64_t i = 0; i < mb; ++i)
+                Tj[ i*inc_i ] = is_conj ? conj( bj[ i ] ) : bj[ i ];
+        }
+    }
+}
+
+} // namespace impl
+
 //------------------------------------------------------------------------------
 /// Redistribute a matrix A from one distribution into matrix B with another
 /// distribution.
+///
+/// A and B must have the same dimensions and MPI communicator, but may have
+/// different tile sizes, process grids, and transpose ops. The matrices are
+/// split into pieces that lie within a single tile of both A and B. The
+/// pieces each pair of ranks exchange are packed into one message, and all
+/// messages are in flight at once, while pieces that stay on the same rank
+/// are copied directly.
+///
 /// @ingroup copy_internal
 ///
 template <typename scalar_t>
@@ -24,104 +119,170 @@ void redistribute(
 {
     trace::Block trace_block("slate::redistribute");
 
-    int64_t mt = B.mt();
-    int64_t nt = B.nt();
-
-    bool is_conj = false;
-    if (A.op() != B.op()) {
-        if (A.op() == Op::ConjTrans || B.op() == Op::ConjTrans)
-            is_conj = true;
-
-        auto BT = A.emptyLike();
-        for (int64_t j = 0; j < nt; ++j) {
-            for (int64_t i = 0; i < mt; ++i) {
-                if (B.tileIsLocal(i, j)) {
-                    B.tileGetForWriting( i, j, LayoutConvert::None );
-                    if (! A.tileIsLocal(i, j)) {
-                        auto Bij = B(i, j);
-                        if (Bij.mb() == Bij.nb()) {
-                            Bij.recv(A.tileRank(i, j), A.mpiComm(),  A.layout());
-                            B.tileGetForWriting( i, j, LayoutConvert::None );
-                            if (is_conj)
-                                tile::deepConjTranspose( std::move(Bij) );
-                            else
-                                tile::deepTranspose( std::move(Bij) );
-                        }
-                        else {
-                            BT.tileInsert(i, j);
-                            auto BTij = BT(i, j);
-                            BT.tileGetForWriting( i, j, LayoutConvert::None );
-                            BTij.recv(A.tileRank(i, j), A.mpiComm(),  A.layout());
-                            if (is_conj) {
-                                auto AijT = conj_transpose(BTij);
-                                tile::deepConjTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                            else {
-                                auto AijT = transpose(BTij);
-                                tile::deepTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                        }
-                    }
-                    else {
-                        A.tileGetForReading(i, j, LayoutConvert::None);
-                        // copy local tiles if needed.
-                        auto Aij = A(i, j);
-                        auto Bij = B(i, j);
-                        if (Bij.mb() == Bij.nb()) {
-                            if (is_conj)
-                                tile::deepConjTranspose( std::move(Aij), std::move(Bij) );
-                            else
-                                tile::deepTranspose( std::move(Aij), std::move(Bij) );
-                        }
-                        else {
-                            if (is_conj) {
-                                auto AijT = conj_transpose(Aij);
-                                tile::deepConjTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                            else {
-                                auto AijT = transpose(Aij);
-                                tile::deepTranspose( std::move(AijT), std::move(Bij) );
-                            }
-                        }
-                    }
-                }
-                else if (A.tileIsLocal(i, j)) {
-                    A.tileGetForReading(i, j, LayoutConvert::None);
-                    auto Aij = A(i, j);
-                    Aij.send(B.tileRank(i, j), B.mpiComm());
-                }
+    using impl::RedistributeSpan;
+
+    slate_assert( A.m() == B.m() );
+    slate_assert( A.n() == B.n() );
+
+    const int tag = 0;
+    const MPI_Datatype mpi_scalar_t = mpi_type<scalar_t>::value;
+
+    MPI_Comm comm = B.mpiComm();
+    int mpi_rank = B.mpiRank();
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( comm, &mpi_size ) );
+
+    // If exactly one of A and B is conjugate-transposed, conjugate data.
+    bool is_conj = (A.op() == Op::ConjTrans) != (B.op() == Op::ConjTrans);
+
+    std::vector<RedistributeSpan> rows = impl::redistribute_spans(
+        B.m(),
+        [&A]( int64_t i ) { return A.tileMb( i ); },
+        [&B]( int64_t i ) { return B.tileMb( i ); } );
+    std::vector<RedistributeSpan> cols = impl::redistribute_spans(
+        B.n(),
+        [&A]( int64_t j ) { return A.tileNb( j ); },
+        [&B]( int64_t j ) { return B.tileNb( j ); } );
+
+    // Pieces, as (row span, col span) pairs, to send to or receive from
+    // each rank, in column-major order of pieces, matching on both sides.
+    using Piece = std::pair<int64_t, int64_t>;
+    std::vector< std::vector<Piece> > send_pieces( mpi_size ),
+                                      recv_pieces( mpi_size );
+    std::vector<int64_t> send_counts( mpi_size, 0 ),
+                         recv_counts( mpi_size, 0 );
+    std::vector<Piece> local_pieces;
+    for (int64_t c = 0; c < int64_t( cols.size() ); ++c) {
+        for (int64_t r = 0; r < int64_t( rows.size() ); ++r) {
+            int src = A.tileRank( rows[ r ].a_index, cols[ c ].a_index );
+            int dst = B.tileRank( rows[ r ].b_index, cols[ c ].b_index );
+            int64_t count = rows[ r ].size * cols[ c ].size;
+            if (src == mpi_rank && dst == mpi_rank) {
+                local_pieces.push_back( { r, c } );
             }
+            else if (src == mpi_rank) {
+                send_pieces[ dst ].push_back( { r, c } );
+                send_counts[ dst ] += count;
+            }
+            else if (dst == mpi_rank) {
+                recv_pieces[ src ].push_back( { r, c } );
+                recv_counts[ src ] += count;
+            }
+        }
+    }
+
+    // Bring local tiles to the host.
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j ))
+                A.tileGetForReading( i, j, LayoutConvert::None );
+        }
+    }
+    for (int64_t j = 0; j < B.nt(); ++j) {
+        for (int64_t i = 0; i < B.mt(); ++i) {
+            if (B.tileIsLocal( i, j ))
+                B.tileGetForWriting( i, j, LayoutConvert::None );
         }
     }
-    else {
-        for (int64_t j = 0; j < nt; ++j) {
-            for (int64_t i = 0; i < mt; ++i) {
-                if (B.tileIsLocal(i, j)) {
-                    B.tileGetForWriting( i, j, LayoutConvert::None );
-                    if (! A.tileIsLocal(i, j)) {
-                        auto Bij = B(i, j);
-                        Bij.recv(A.tileRank(i, j), A.mpiComm(),  A.layout());
-                    }
-                    else {
-                        A.tileGetForReading(i, j, LayoutConvert::None);
-                        // copy local tiles if needed.
-                        auto Aij = A(i, j);
-                        auto Bij = B(i, j);
-                        if (Aij.data() != Bij.data() ) {
-                            tile::gecopy( Aij, Bij );
-                            // deep conj tile after receive if it is square
-                            // if rectangular, recv in a tmp tile then transpose it
-                        }
-                    }
-                }
-                else if (A.tileIsLocal(i, j)) {
-                    A.tileGetForReading(i, j, LayoutConvert::None);
-                    auto Aij = A(i, j);
-                    Aij.send(B.tileRank(i, j), B.mpiComm());
-                }
+
+    // Packs (or unpacks) the pieces exchanged with one rank.
+    auto copy_pieces = [&]( bool pack, std::vector<Piece>& pieces,
+                            scalar_t* buffer ) {
+        for (auto& piece : pieces) {
+            auto& row = rows[ piece.first ];
+            auto& col = cols[ piece.second ];
+            if (pack) {
+                auto Aij = A( row.a_index, col.a_index );
+                impl::redistribute_copy(
+                    true, false, Aij, row.a_offset, col.a_offset,
+                    row.size, col.size, buffer, row.size );
+            }
+            else {
+                auto Bij = B( row.b_index, col.b_index );
+                impl::redistribute_copy(
+                    false, is_conj, Bij, row.b_offset, col.b_offset,
+                    row.size, col.size, buffer, row.size );
             }
+            buffer += row.size * col.size;
+        }
+    };
+
+    // Post all receives first.
+    std::vector< std::vector<scalar_t> > recv_buffers( mpi_size );
+    std::vector<MPI_Request> recv_requests;
+    std::vector<int> recv_ranks;
+    for (int src = 0; src < mpi_size; ++src) {
+        if (recv_counts[ src ] > 0) {
+            slate_assert( recv_counts[ src ] <= std::numeric_limits<int>::max() );
+            recv_buffers[ src ].resize( recv_counts[ src ] );
+            recv_requests.push_back( MPI_REQUEST_NULL );
+            recv_ranks.push_back( src );
+            slate_mpi_call(
+                MPI_Irecv( recv_buffers[ src ].data(), recv_counts[ src ],
+                           mpi_scalar_t, src, tag, comm,
+                           &recv_requests.back() ) );
+        }
+    }
+
+    // Pack for each destination in parallel, then send.
+    // Check counts first, since exceptions can't leave the parallel region.
+    for (int dst = 0; dst < mpi_size; ++dst) {
+        slate_assert( send_counts[ dst ] <= std::numeric_limits<int>::max() );
+    }
+    std::vector< std::vector<scalar_t> > send_buffers( mpi_size );
+    std::vector<MPI_Request> send_requests( mpi_size, MPI_REQUEST_NULL );
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for (int dst = 0; dst < mpi_size; ++dst) {
+        if (send_counts[ dst ] > 0) {
+            send_buffers[ dst ].resize( send_counts[ dst ] );
+            copy_pieces( true, send_pieces[ dst ], send_buffers[ dst ].data() );
+            slate_mpi_call(
+                MPI_Isend( send_buffers[ dst ].data(), send_counts[ dst ],
+                           mpi_scalar_t, dst, tag, comm,
+                           &send_requests[ dst ] ) );
+        }
+    }
+
+    // Copy local pieces while messages are in flight.
+    #pragma omp parallel for schedule( dynamic, 1 )
+    for (size_t k = 0; k < local_pieces.size(); ++k) {
+        auto& row = rows[ local_pieces[ k ].first ];
+        auto& col = cols[ local_pieces[ k ].second ];
+        auto Aij = A( row.a_index, col.a_index );
+        auto Bij = B( row.b_index, col.b_index );
+        scalar_t* Aij_00 = &Aij.at( row.a_offset, col.a_offset );
+        scalar_t* Bij_00 = &Bij.at( row.b_offset, col.b_offset );
+        if (Aij_00 == Bij_00 && Aij.op() == Bij.op()
+            && Aij.layout() == Bij.layout()) {
+            continue;  // A and B share this piece.
         }
+        // Copy via a column-major workspace, which handles any combination
+        // of op and layout.
+        std::vector<scalar_t> work( row.size * col.size );
+        impl::redistribute_copy(
+            true, false, Aij, row.a_offset, col.a_offset,
+            row.size, col.size, work.data(), row.size );
+        impl::redistribute_copy(
+            false, is_conj, Bij, row.b_offset, col.b_offset,
+            row.size, col.size, work.data(), row.size );
     }
+
+    // Unpack messages in the order they arrive.
+    for (size_t k = 0; k < recv_requests.size(); ++k) {
+        int index;
+        slate_mpi_call(
+            MPI_Waitany( recv_requests.size(), recv_requests.data(), &index,
+                         MPI_STATUS_IGNORE ) );
+        int src = recv_ranks[ index ];
+        copy_pieces( false, recv_pieces[ src ], recv_buffers[ src ].data() );
+        recv_buffers[ src ].clear();
+        recv_buffers[ src ].shrink_to_fit();
+    }
+
+    slate_mpi_call(
+        MPI_Waitall( send_requests.size(), send_requests.data(),
+                     MPI_STATUSES_IGNORE ) );
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,310 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Sturm count: returns the number of eigenvalues less than x of the
+/// symmetric tridiagonal matrix with diagonal D and squared off-diagonal E2.
+///
+/// @ingroup heev_impl
+///
+template <typename real_t>
+int64_t stebz_count(
+    int64_t n, real_t const* D, real_t const* E2, real_t pivmin, real_t x )
+{
+    int64_t count = 0;
+    real_t q = D[ 0 ] - x;
+    if (q <= pivmin) {
+        ++count;
+        q = std::min( q, -pivmin );
+    }
+    for (int64_t i = 1; i < n; ++i) {
+        q = D[ i ] - E2[ i-1 ] / q - x;
+        if (q <= pivmin) {
+            ++count;
+            q = std::min( q, -pivmin );
+        }
+    }
+    return count;
+}
+
+//------------------------------------------------------------------------------
+/// Finds the k-th smallest eigenvalue (0-based) by bisection in [lower, upper],
+/// which must contain it.
+///
+/// @ingroup heev_impl
+///
+template <typename real_t>
+real_t stebz_bisect(
+    int64_t n, real_t const* D, real_t const* E2, real_t pivmin,
+    int64_t k, real_t lower, real_t upper )
+{
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t atol = 2 * pivmin;
+    const int max_iter = 4 * std::numeric_limits<real_t>::digits;
+
+    for (int iter = 0; iter < max_iter; ++iter) {
+        real_t tol = std::max( atol, 2*eps*std::max( std::abs( lower ),
+                                                     std::abs( upper ) ) );
+        if (upper - lower <= tol)
+            break;
+        real_t mid = 0.5*(lower + upper);
+        if (stebz_count( n, D, E2, pivmin, mid ) > k)
+            upper = mid;
+        else
+            lower = mid;
+    }
+    return 0.5*(lower + upper);
+}
+
+//------------------------------------------------------------------------------
+/// Finds the eigenvalues with 0-based indices [ k_begin, k_end ) by
+/// bisection in [lower, upper], where count_lower and count_upper are the
+/// Sturm counts at lower and upper, and
+/// count_lower <= k_begin < k_end <= count_upper.
+/// Splitting the interval at its midpoint divides the eigenvalues, so
+/// one Sturm count narrows the interval for all of them, until each
+/// interval has one eigenvalue to find, by stebz_bisect.
+/// Eigenvalue k is stored in Lambda[ k - k_begin ].
+///
+/// @ingroup heev_impl
+///
+template <typename real_t>
+void stebz_slice(
+    int64_t n, real_t const* D, real_t const* E2, real_t pivmin,
+    int64_t k_begin, int64_t k_end,
+    real_t lower, real_t upper, int64_t count_lower, int64_t count_upper,
+    real_t* Lambda )
+{
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t atol = 2 * pivmin;
+
+    if (k_begin >= k_end)
+        return;
+
+    if (k_end - k_begin == 1) {
+        Lambda[ 0 ] = stebz_bisect( n, D, E2, pivmin, k_begin, lower, upper );
+        return;
+    }
+
+    real_t tol = std::max( atol, 2*eps*std::max( std::abs( lower ),
+                                                 std::abs( upper ) ) );
+    if (upper - lower <= tol) {
+        // Cluster of eigenvalues that are equal to working precision.
+        for (int64_t k = k_begin; k < k_end; ++k)
+            Lambda[ k - k_begin ] = 0.5*(lower + upper);
+        return;
+    }
+
+    real_t mid = 0.5*(lower + upper);
+    int64_t count_mid = stebz_count( n, D, E2, pivmin, mid );
+    count_mid = std::min( std::max( count_mid, count_lower ), count_upper );
+    int64_t k_mid = std::min( std::max( count_mid, k_begin ), k_end );
+    stebz_slice( n, D, E2, pivmin, k_begin, k_mid,
+                 lower, mid, count_lower, count_mid, Lambda );
+    stebz_slice( n, D, E2, pivmin, k_mid, k_end,
+                 mid, upper, count_mid, count_upper,
+                 &Lambda[ k_mid - k_begin ] );
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Computes selected eigenvalues of a symmetric tridiagonal matrix
+/// by bisection, as in LAPACK's `stebz`.
+/// The selected eigenvalues are divided among the MPI ranks, and each rank
+/// splits its eigenvalues into slices of consecutive eigenvalues, which
+/// OpenMP threads bisect in parallel, sharing Sturm counts within a slice;
+/// then all ranks gather all selected eigenvalues.
+/// This is also a parallel alternative to sterf to find all eigenvalues.
+///
+/// ATTENTION: only host computation supported for now
+///
+//------------------------------------------------------------------------------
+/// @tparam real_t
+///     One of float, double.
+//------------------------------------------------------------------------------
+/// @param[in] range
+///     - Range::All:   all eigenvalues are found;
+///     - Range::Value: eigenvalues in the half-open interval (vl, vu]
+///                     are found;
+///     - Range::Index: the il-th through iu-th eigenvalues are found.
+///
+/// @param[in] vl
+///     If range = Value, lower bound of the interval. Otherwise, not used.
+///
+/// @param[in] vu
+///     If range = Value, upper bound of the interval, vl < vu.
+///     Otherwise, not used.
+///
+/// @param[in] il
+///     If range = Index, 1-based index of the smallest eigenvalue to find.
+///     Otherwise, not used.
+///
+/// @param[in] iu
+///     If range = Index, 1-based index of the largest eigenvalue to find,
+///     1 <= il <= iu <= n, or il = 1 and iu = 0 if n = 0.
+///     Otherwise, not used.
+///
+/// @param[in] D
+///     The n diagonal elements of the tridiagonal matrix.
+///
+/// @param[in] E
+///     The n-1 off-diagonal elements of the tridiagonal matrix.
+///
+/// @param[out] Lambda
+///     On exit, resized to the number of eigenvalues found, m,
+///     and contains them in ascending order.
+///     Identical on all ranks.
+///
+/// @param[in] mpi_comm
+///     MPI communicator to divide the eigenvalues among.
+///     All ranks must pass the same D, E, and selection.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup heev_computational
+///
+template <typename real_t>
+void stebz(
+    Range range, real_t vl, real_t vu, int64_t il, int64_t iu,
+    std::vector<real_t> const& D,
+    std::vector<real_t> const& E,
+    std::vector<real_t>& Lambda,
+    MPI_Comm mpi_comm,
+    Options const& opts )
+{
+    trace::Block trace_block( "slate::stebz" );
+
+    const real_t safe_min = std::numeric_limits<real_t>::min();
+    const real_t eps      = std::numeric_limits<real_t>::epsilon();
+    const real_t fudge    = 2.1;
+
+    int64_t n = D.size();
+    slate_assert( n == 0 || int64_t( E.size() ) >= n-1 );
+    if (range == Range::Value)
+        slate_assert( vl < vu );
+    if (range == Range::Index) {
+        slate_assert( 1 <= il || n == 0 );
+        slate_assert( il <= iu + 1 && iu <= n );
+    }
+
+    Lambda.clear();
+    if (n == 0)
+        return;
+
+    // Squared off-diagonal, pivmin, and Gershgorin interval.
+    std::vector<real_t> E2( std::max( n-1, int64_t( 1 ) ) );
+    real_t E2_max = 1;
+    for (int64_t i = 0; i < n-1; ++i) {
+        E2[ i ] = E[ i ] * E[ i ];
+        E2_max = std::max( E2_max, E2[ i ] );
+    }
+    real_t pivmin = safe_min * E2_max;
+
+    real_t lower = D[ 0 ], upper = D[ 0 ];
+    for (int64_t i = 0; i < n; ++i) {
+        real_t r = (i > 0   ? std::abs( E[ i-1 ] ) : 0)
+                 + (i < n-1 ? std::abs( E[ i   ] ) : 0);
+        lower = std::min( lower, D[ i ] - r );
+        upper = std::max( upper, D[ i ] + r );
+    }
+    real_t tnorm = std::max( std::abs( lower ), std::abs( upper ) );
+    lower -= fudge*tnorm*eps*n + 2*fudge*pivmin;
+    upper += fudge*tnorm*eps*n + 2*fudge*pivmin;
+
+    // 0-based indices [ i_begin, i_end ) of eigenvalues to find.
+    int64_t i_begin = 0, i_end = n;
+    if (range == Range::Index) {
+        i_begin = il - 1;
+        i_end   = iu;
+    }
+    else if (range == Range::Value) {
+        i_begin = impl::stebz_count( n, &D[0], &E2[0], pivmin, vl );
+        i_end   = impl::stebz_count( n, &D[0], &E2[0], pivmin, vu );
+        lower = std::max( lower, vl );
+        upper = std::min( upper, vu );
+    }
+    int64_t m = std::max( i_end - i_begin, int64_t( 0 ) );
+    Lambda.resize( m );
+    if (m == 0)
+        return;
+
+    // Divide eigenvalues among ranks in contiguous chunks.
+    int mpi_rank, mpi_size;
+    slate_mpi_call(
+        MPI_Comm_rank( mpi_comm, &mpi_rank ) );
+    slate_mpi_call(
+        MPI_Comm_size( mpi_comm, &mpi_size ) );
+
+    std::vector<int> counts( mpi_size ), displs( mpi_size );
+    for (int r = 0; r < mpi_size; ++r) {
+        int64_t begin = (m * r) / mpi_size;
+        int64_t end   = (m * (r + 1)) / mpi_size;
+        displs[ r ] = int( begin );
+        counts[ r ] = int( end - begin );
+    }
+
+    int64_t my_begin = displs[ mpi_rank ];
+    int64_t my_count = counts[ mpi_rank ];
+    std::vector<real_t> my_Lambda( std::max( my_count, int64_t( 1 ) ) );
+
+    // Slices of eigenvalues, several per thread to balance the load,
+    // since clusters are cheaper to find.
+    int64_t nthreads = omp_get_max_threads();
+    int64_t slice = std::max( int64_t( 1 ), ceildiv( my_count, 4*nthreads ) );
+    int64_t nslices = ceildiv( my_count, slice );
+    int64_t count_lower = impl::stebz_count( n, &D[0], &E2[0], pivmin, lower );
+    int64_t count_upper = impl::stebz_count( n, &D[0], &E2[0], pivmin, upper );
+
+    #pragma omp parallel for schedule( dynamic, 1 ) slate_omp_default_none \
+        shared( D, E2, my_Lambda ) \
+        firstprivate( n, pivmin, lower, upper, count_lower, count_upper, \
+                      i_begin, my_begin, my_count, slice, nslices )
+    for (int64_t s = 0; s < nslices; ++s) {
+        int64_t k_begin = i_begin + my_begin + s*slice;
+        int64_t k_end   = std::min( k_begin + slice,
+                                    i_begin + my_begin + my_count );
+        impl::stebz_slice( n, &D[0], &E2[0], pivmin, k_begin, k_end,
+                           lower, upper, count_lower, count_upper,
+                           &my_Lambda[ s*slice ] );
+    }
+
+    const auto mpi_real_type = mpi_type<real_t>::value;
+    slate_mpi_call(
+        MPI_Allgatherv( &my_Lambda[0], int( my_count ), mpi_real_type,
+                        &Lambda[0], &counts[0], &displs[0], mpi_real_type,
+                        mpi_comm ) );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void stebz<float>(
+    Range range, float vl, float vu, int64_t il, int64_t iu,
+    std::vector<float> const& D,
+    std::vector<float> const& E,
+    std::vector<float>& Lambda,
+    MPI_Comm mpi_comm,
+    Options const& opts );
+
+template
+void stebz<double>(
+    Range range, double vl, double vu, int64_t il, int64_t iu,
+    std::vector<double> const& D,
+    std::vector<double> const& E,
+    std::vector<double>& Lambda,
+    MPI_Comm mpi_comm,
+    Options const& opts );
+
+} // namespace slate
@@ -85,7 +85,7 @@ void stedc_secular(
     slate_mpi_call(
         MPI_Comm_size( U.mpiComm(), &mpi_size ) );
 
-    int64_t info = 0, iinfo;
+    int64_t info = 0;
 
     // Assumes matrix is 2D block cyclic.
     GridOrder grid_order;
@@ -106,48 +106,66 @@ void stedc_secular(
     int64_t end     = begin + mycnt;
 
     // ztilde_partial = 1.
+    // Roots are independent, so threads split this rank's roots, each
+    // accumulating its own partial product, which are then multiplied.
     std::vector<real_t> ztilde( nsecular, 1.0 ),
-                        deltaJ( nsecular ),
                         Lambda_local( nsecular );
-    for (int64_t j = begin; j < end; ++j) {
-        iinfo = lapack::laed4( nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
-                               rho, &Lambda_local[ j ] );
-        if (iinfo != 0)
-            info = j;
+    #pragma omp parallel reduction( max: info )
+    {
+        std::vector<real_t> ztilde_thread( nsecular, 1.0 ),
+                            deltaJ( nsecular );
+        #pragma omp for schedule( dynamic, 16 ) nowait
+        for (int64_t j = begin; j < end; ++j) {
+            int64_t iinfo = lapack::laed4(
+                nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
+                rho, &Lambda_local[ j ] );
+            if (iinfo != 0)
+                info = std::max( info, j );
 
-        // Update local partial product ztilde_partial
-        // ztilde_partial *= deltaJ / (d_i - d_j)
-        for (int64_t i = 0; i < j; ++i) {
-            ztilde[ i ] *= deltaJ[ i ] / (D[ i ] - D[ j ]);
+            // Update thread's partial product ztilde_thread
+            // ztilde_thread *= deltaJ / (d_i - d_j)
+            for (int64_t i = 0; i < j; ++i) {
+                ztilde_thread[ i ] *= deltaJ[ i ] / (D[ i ] - D[ j ]);
+            }
+            // for i = j, exclude (d_i - d_j) term in denominator.
+            ztilde_thread[ j ] *= deltaJ[ j ];
+            for (int64_t i = j+1; i < nsecular; ++i) {
+                ztilde_thread[ i ] *= deltaJ[ i ] / (D[ i ] - D[ j ]);
+            }
         }
-        // for i = j, exclude (d_i - d_j) term in denominator.
-        ztilde[ j ] *= deltaJ[ j ];
-        for (int64_t i = j+1; i < nsecular; ++i) {
-            ztilde[ i ] *= deltaJ[ i ] / (D[ i ] - D[ j ]);
+        #pragma omp critical (slate_stedc_secular_ztilde)
+        {
+            for (int64_t i = 0; i < nsecular; ++i) {
+                ztilde[ i ] *= ztilde_thread[ i ];
+            }
         }
     }
 
     // ztilde = +- sqrt( prod_{all ranks} ztilde_partial )
-    slate_mpi_call(
-        MPI_Allreduce( MPI_IN_PLACE, &ztilde[ 0 ], nsecular, mpi_real_t,
-                       MPI_PROD, U.mpiComm() ) );
+    if (mpi_size > 1) {
+        slate_mpi_call(
+            MPI_Allreduce( MPI_IN_PLACE, &ztilde[ 0 ], nsecular, mpi_real_t,
+                           MPI_PROD, U.mpiComm() ) );
+    }
     // Compute final ztilde, with sign from original z (redundantly).
     for (int64_t i = 0; i < nsecular; ++i) {
         ztilde[ i ] = copysign( sqrt( -ztilde[ i ] ), z[ i ] );
     }
 
-    // recv_cnts = [ min_cnt+1, .., min_cnt+1, min_cnt, .., min_cnt ]
-    // recv_offsets[ j ] = sum_{i=0, .., j-1} recv_cnts[ i ]
-    std::vector<int> recv_cnts( mpi_size ),
-                     recv_offsets( mpi_size+1 );
-    std::fill( &recv_cnts[ 0 ], &recv_cnts[ rem ], min_cnt + 1 );
-    std::fill( &recv_cnts[ rem ], &recv_cnts[ mpi_size ], min_cnt );
-    std::partial_sum( &recv_cnts[ 0 ], &recv_cnts[ mpi_size ],
-                      &recv_offsets[ 1 ] );
-    slate_mpi_call(
-        MPI_Allgatherv( MPI_IN_PLACE, mycnt, mpi_real_t,
-                        &Lambda_local[ 0 ], &recv_cnts[ 0 ], &recv_offsets[ 0 ],
-                        mpi_real_t, U.mpiComm() ) );
+    if (mpi_size > 1) {
+        // recv_cnts = [ min_cnt+1, .., min_cnt+1, min_cnt, .., min_cnt ]
+        // recv_offsets[ j ] = sum_{i=0, .., j-1} recv_cnts[ i ]
+        std::vector<int> recv_cnts( mpi_size ),
+                         recv_offsets( mpi_size+1 );
+        std::fill( &recv_cnts[ 0 ], &recv_cnts[ rem ], min_cnt + 1 );
+        std::fill( &recv_cnts[ rem ], &recv_cnts[ mpi_size ], min_cnt );
+        std::partial_sum( &recv_cnts[ 0 ], &recv_cnts[ mpi_size ],
+                          &recv_offsets[ 1 ] );
+        slate_mpi_call(
+            MPI_Allgatherv( MPI_IN_PLACE, mycnt, mpi_real_t,
+                            &Lambda_local[ 0 ], &recv_cnts[ 0 ],
+                            &recv_offsets[ 0 ], mpi_real_t, U.mpiComm() ) );
+    }
 
     if (info != 0)
         slate_error( "info " + std::to_string( info ) );
@@ -197,48 +215,66 @@ void stedc_secular(
     int64_t col_cnt = icol.size();
     int64_t row_cnt = irow.size();
 
+    // Gather local tiles of U, to avoid looking up tiles per element.
+    int64_t mt = U.mt();
+    int64_t nt = U.nt();
+    std::vector< Tile<real_t> > U_tiles( mt*nt );
+    for (int64_t j = 0; j < nt; ++j) {
+        for (int64_t i = 0; i < mt; ++i) {
+            if (U.tileIsLocal( i, j )) {
+                U_tiles[ i + j*mt ] = U( i, j );
+            }
+        }
+    }
+
     // Compute u vectors.
     // Each rank in processor column computes redundantly in order to get norm.
+    // Columns are independent, so threads split the local columns.
     // todo: cache delta_jj terms and compute other deltas from D[i] - Lambda[j],
     // rather than redundantly calling laed4.
-    for (int64_t jj = 0; jj < col_cnt; ++jj) {
-        int64_t j  = icol[ jj ];
-        int64_t jq = itype[ j ];
-        int64_t jq_tile   = jq / nb;
-        int64_t jq_offset = jq % nb;
+    #pragma omp parallel
+    {
+        std::vector<real_t> deltaJ( nsecular );
+        #pragma omp for schedule( dynamic, 4 )
+        for (int64_t jj = 0; jj < col_cnt; ++jj) {
+            int64_t j  = icol[ jj ];
+            int64_t jq = itype[ j ];
+            int64_t jq_tile   = jq / nb;
+            int64_t jq_offset = jq % nb;
 
-        assert( 0 <= j  && j  < n );
-        assert( 0 <= jq && jq < n );
-        assert( 0 <= jq_tile   && jq_tile < U.nt() );
-        assert( 0 <= jq_offset && jq_offset < nb );
+            assert( 0 <= j  && j  < n );
+            assert( 0 <= jq && jq < n );
+            assert( 0 <= jq_tile   && jq_tile < U.nt() );
+            assert( 0 <= jq_offset && jq_offset < nb );
 
-        real_t dummy;
-        iinfo = lapack::laed4( nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
-                               rho, &dummy );
+            real_t dummy;
+            lapack::laed4( nsecular, j, &D[ 0 ], &z[ 0 ], &deltaJ[ 0 ],
+                           rho, &dummy );
 
-        real_t nrm;
-        if (nsecular <= 2) {
-            nrm = 1.0;
-        }
-        else {
-            for (int64_t i = 0; i < nsecular; ++i) {
-                deltaJ[ i ] = ztilde[ i ] / deltaJ[ i ];
+            real_t nrm;
+            if (nsecular <= 2) {
+                nrm = 1.0;
             }
-            nrm = blas::nrm2( nsecular, &deltaJ[ 0 ], 1 );
-        }
-        for (int64_t ii = 0; ii < row_cnt; ++ii) {
-            int64_t i  = irow[ ii ];
-            int64_t iq = itype[ i ];
-            int64_t iq_tile   = iq / nb;
-            int64_t iq_offset = iq % nb;
+            else {
+                for (int64_t i = 0; i < nsecular; ++i) {
+                    deltaJ[ i ] = ztilde[ i ] / deltaJ[ i ];
+                }
+                nrm = blas::nrm2( nsecular, &deltaJ[ 0 ], 1 );
+            }
+            for (int64_t ii = 0; ii < row_cnt; ++ii) {
+                int64_t i  = irow[ ii ];
+                int64_t iq = itype[ i ];
+                int64_t iq_tile   = iq / nb;
+                int64_t iq_offset = iq % nb;
 
-            assert( 0 <= i  && i  < n );
-            assert( 0 <= iq && iq < n );
-            assert( 0 <= iq_tile   && iq_tile < U.mt() );
-            assert( 0 <= iq_offset && iq_offset < nb );
+                assert( 0 <= i  && i  < n );
+                assert( 0 <= iq && iq < n );
+                assert( 0 <= iq_tile   && iq_tile < U.mt() );
+                assert( 0 <= iq_offset && iq_offset < nb );
 
-            auto Uij = U( iq_tile, jq_tile );
-            Uij.at( iq_offset, jq_offset ) = deltaJ[ i ] / nrm;
+                auto& Uij = U_tiles[ iq_tile + jq_tile*mt ];
+                Uij.at( iq_offset, jq_offset ) = deltaJ[ i ] / nrm;
+            }
         }
     }
 }
@@ -210,6 +210,11 @@ void stedc_solve(
     // end =  4; subs = [ (        3           6) (        9              13) ]
     // end =  2; subs = [ (                    6                          13) ]
     // end =  1; done
+    //
+    // Merges run one after another: each one's collectives and tile
+    // broadcasts span the whole communicator, and each is threaded
+    // internally, by gemm and the secular solver, so running merges as
+    // concurrent tasks would nest those parallel regions.
     int64_t nblock, nblock1, nmerge1, nmerge, j, j2, jj;
     while (end > 1) {
         for (int64_t i = 0; i <= end-2; i += 2) {
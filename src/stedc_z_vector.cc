@@ -91,7 +91,8 @@ void stedc_z_vector(
     }
 
     // Broadcast complete z to all ranks.
-    MPI_Bcast( &z[ 0 ], jj, mpi_type<real_t>::value, root, Q.mpiComm() );
+    slate_mpi_call(
+        MPI_Bcast( &z[ 0 ], jj, mpi_type<real_t>::value, root, Q.mpiComm() ) );
 }
 
 //------------------------------------------------------------------------------
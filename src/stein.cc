@@ -0,0 +1,387 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+#include "internal/internal_util.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// LU factorization with partial pivoting of T - lambda I, where T is the
+/// symmetric tridiagonal matrix with diagonal D and off-diagonal E,
+/// as in LAPACK's `gttrf`. U has diagonal d and superdiagonals du, du2;
+/// L has subdiagonal dl. piv[ i ] is true if rows i and i+1 were swapped.
+/// Zero pivots of U are replaced by tiny, to allow the solve.
+///
+/// @ingroup heev_impl
+///
+template <typename real_t>
+void stein_factor(
+    int64_t n, real_t const* D, real_t const* E, real_t lambda, real_t tiny,
+    real_t* dl, real_t* d, real_t* du, real_t* du2, bool* piv )
+{
+    for (int64_t i = 0; i < n; ++i)
+        d[ i ] = D[ i ] - lambda;
+    for (int64_t i = 0; i < n-1; ++i) {
+        dl[ i ] = E[ i ];
+        du[ i ] = E[ i ];
+        du2[ i ] = 0;
+    }
+
+    for (int64_t i = 0; i < n-1; ++i) {
+        if (std::abs( d[ i ] ) >= std::abs( dl[ i ] )) {
+            // No row interchange.
+            real_t fact = d[ i ] != 0 ? dl[ i ] / d[ i ] : 0;
+            dl[ i ] = fact;
+            d[ i+1 ] -= fact * du[ i ];
+            piv[ i ] = false;
+        }
+        else {
+            // Interchange rows i and i+1.
+            real_t fact = d[ i ] / dl[ i ];
+            d[ i ] = dl[ i ];
+            dl[ i ] = fact;
+            real_t temp = du[ i ];
+            du[ i ] = d[ i+1 ];
+            d[ i+1 ] = temp - fact * d[ i+1 ];
+            if (i < n-2) {
+                du2[ i ] = du[ i+1 ];
+                du[ i+1 ] = -fact * du[ i+1 ];
+            }
+            piv[ i ] = true;
+        }
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        if (std::abs( d[ i ] ) < tiny)
+            d[ i ] = d[ i ] < 0 ? -tiny : tiny;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves (T - lambda I) x = b using the factorization from stein_factor.
+/// On exit, b is overwritten by x.
+///
+/// @ingroup heev_impl
+///
+template <typename real_t>
+void stein_solve(
+    int64_t n, real_t const* dl, real_t const* d, real_t const* du,
+    real_t const* du2, bool const* piv, real_t* b )
+{
+    // Solve L y = P b.
+    for (int64_t i = 0; i < n-1; ++i) {
+        if (piv[ i ])
+            std::swap( b[ i ], b[ i+1 ] );
+        b[ i+1 ] -= dl[ i ] * b[ i ];
+    }
+    // Solve U x = y.
+    b[ n-1 ] /= d[ n-1 ];
+    if (n > 1)
+        b[ n-2 ] = (b[ n-2 ] - du[ n-2 ] * b[ n-1 ]) / d[ n-2 ];
+    for (int64_t i = n-3; i >= 0; --i)
+        b[ i ] = (b[ i ] - du[ i ] * b[ i+1 ] - du2[ i ] * b[ i+2 ]) / d[ i ];
+}
+
+//------------------------------------------------------------------------------
+/// Computes eigenvectors for the cluster of eigenvalues
+/// Lambda[ begin : end-1 ] by inverse iteration, as in LAPACK's `stein`,
+/// orthogonalizing each vector against the previous ones in the cluster.
+/// Vectors are stored in X( :, 0 : end-begin-1 ), which is n-by-(end-begin)
+/// with leading dimension n.
+/// The starting vectors depend only on the eigenvalue index, so ranks
+/// computing the same cluster get the same vectors.
+///
+/// @return number of eigenvectors that failed to converge.
+///
+/// @ingroup heev_impl
+///
+template <typename real_t>
+int64_t stein_cluster(
+    int64_t n, real_t const* D, real_t const* E, real_t onenrm,
+    real_t const* Lambda, int64_t begin, int64_t end,
+    real_t* X )
+{
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const int max_iter = 5;
+    const int extra = 2;
+
+    // If the vector is at least this large after the solve,
+    // it has converged.
+    const real_t dtpcrt = std::sqrt( real_t( 0.1 ) / n );
+    const real_t tiny = eps * onenrm;
+
+    std::vector<real_t> dl( n ), d( n ), du( n ), du2( n );
+    std::unique_ptr<bool[]> piv( new bool[ n ] );
+
+    int64_t info = 0;
+    real_t lambda_prev = 0;
+    for (int64_t j = begin; j < end; ++j) {
+        real_t* x = &X[ (j - begin)*n ];
+
+        // Perturb eigenvalues that are too close, so the vectors differ.
+        real_t lambda = Lambda[ j ];
+        if (j > begin) {
+            real_t pertol = 10 * std::abs( eps * lambda );
+            if (lambda - lambda_prev < pertol)
+                lambda = lambda_prev + pertol;
+        }
+        lambda_prev = lambda;
+
+        // Pseudo-random starting vector in (-1, 1), seeded by j.
+        uint64_t seed = 2*uint64_t( j ) + 1;
+        for (int64_t i = 0; i < n; ++i) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            x[ i ] = real_t( int64_t( seed >> 11 ) ) / real_t( 1ull << 52 ) - 1;
+        }
+
+        stein_factor( n, D, E, lambda, tiny,
+                      &dl[0], &d[0], &du[0], &du2[0], piv.get() );
+
+        int nrmchk = 0;
+        int64_t jmax = 0;
+        for (int iter = 0; ; ++iter) {
+            if (iter == max_iter) {
+                ++info;
+                break;
+            }
+
+            // Scale so the solve doesn't overflow.
+            real_t scl = n * onenrm * std::max( eps, std::abs( d[ n-1 ] ) )
+                       / blas::asum( n, x, 1 );
+            blas::scal( n, scl, x, 1 );
+
+            stein_solve( n, &dl[0], &d[0], &du[0], &du2[0], piv.get(), x );
+
+            // Orthogonalize against previous vectors in the cluster.
+            // Solving amplifies their components by up to 1/eps, so
+            // orthogonalize twice to avoid losing orthogonality.
+            for (int pass = 0; pass < 2 && j > begin; ++pass) {
+                for (int64_t i = begin; i < j; ++i) {
+                    real_t* xi = &X[ (i - begin)*n ];
+                    real_t dot = blas::dot( n, xi, 1, x, 1 );
+                    blas::axpy( n, -dot, xi, 1, x, 1 );
+                }
+            }
+
+            jmax = blas::iamax( n, x, 1 );
+            if (std::abs( x[ jmax ] ) < dtpcrt)
+                continue;
+
+            // Converged; do extra iterations for accuracy.
+            ++nrmchk;
+            if (nrmchk > extra)
+                break;
+        }
+
+        // Normalize, with largest element positive.
+        real_t scl = 1 / blas::nrm2( n, x, 1 );
+        jmax = blas::iamax( n, x, 1 );
+        if (x[ jmax ] < 0)
+            scl = -scl;
+        blas::scal( n, scl, x, 1 );
+    }
+    return info;
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Computes eigenvectors of a symmetric tridiagonal matrix corresponding
+/// to given eigenvalues, using inverse iteration, as in LAPACK's `stein`.
+/// Eigenvalues closer than 1e-3 ||T||_1 form a cluster, whose vectors are
+/// orthogonalized against each other. Each rank computes, in parallel with
+/// OpenMP tasks, the clusters that contain columns of its tiles of Z, and
+/// writes them directly into its tiles, so no communication is needed.
+/// For a 1-by-p grid, as heev uses, each column is computed by one rank.
+///
+/// ATTENTION: only host computation supported for now
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] D
+///     The n diagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] E
+///     The n-1 off-diagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] Lambda
+///     The m eigenvalues of T, in ascending order, e.g., from stebz.
+///
+/// @param[out] Z
+///     The n-by-k matrix Z, k >= m. On exit, the first m columns of Z are
+///     the orthonormal eigenvectors of T; the remaining columns are zero.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @return number of eigenvectors that failed to converge, on all ranks.
+///
+/// @ingroup heev_computational
+///
+template <typename scalar_t>
+int64_t stein(
+    std::vector< blas::real_type<scalar_t> > const& D,
+    std::vector< blas::real_type<scalar_t> > const& E,
+    std::vector< blas::real_type<scalar_t> > const& Lambda,
+    Matrix<scalar_t>& Z,
+    Options const& opts )
+{
+    trace::Block trace_block( "slate::stein" );
+
+    using real_t = blas::real_type<scalar_t>;
+
+    const scalar_t zero = 0.0;
+
+    int64_t n = D.size();
+    int64_t m = Lambda.size();
+    slate_assert( Z.m() == n );
+    slate_assert( Z.n() >= m );
+
+    int mpi_rank;
+    slate_mpi_call(
+        MPI_Comm_rank( Z.mpiComm(), &mpi_rank ) );
+
+    // Vectors are written directly into the local tiles of Z.
+    set( zero, Z );
+    Z.tileGetAllForWriting( HostNum, LayoutConvert::ColMajor );
+
+    int64_t info = 0;
+    if (n > 0 && m > 0) {
+        real_t onenrm = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            onenrm = std::max( onenrm, std::abs( D[ i ] )
+                              + (i > 0   ? std::abs( E[ i-1 ] ) : 0)
+                              + (i < n-1 ? std::abs( E[ i   ] ) : 0) );
+        }
+        real_t ortol = real_t( 1e-3 ) * onenrm;
+
+        // Row offsets of block rows, and block column of each vector.
+        int64_t mt = Z.mt();
+        std::vector<int64_t> row_offset( mt + 1, 0 );
+        for (int64_t i = 0; i < mt; ++i)
+            row_offset[ i+1 ] = row_offset[ i ] + Z.tileMb( i );
+
+        std::vector<int64_t> col_tile( m ), col_offset( m );
+        for (int64_t j = 0, jt = 0, j0 = 0; j < m; ++j) {
+            if (j - j0 == Z.tileNb( jt )) {
+                j0 = j;
+                ++jt;
+            }
+            col_tile[ j ] = jt;
+            col_offset[ j ] = j - j0;
+        }
+
+        // Whether this rank has tiles in each block column.
+        std::vector<char> local_col( col_tile[ m-1 ] + 1, false );
+        for (int64_t jt = 0; jt < int64_t( local_col.size() ); ++jt) {
+            for (int64_t i = 0; i < mt && ! local_col[ jt ]; ++i)
+                local_col[ jt ] = Z.tileIsLocal( i, jt );
+        }
+
+        // Clusters [ begin, end ) containing columns with local tiles.
+        // If several ranks compute a cluster, only the owner of the
+        // first tile of its first column counts its failures.
+        std::vector< std::pair<int64_t, int64_t> > clusters;
+        int64_t begin = 0;
+        for (int64_t j = 1; j <= m; ++j) {
+            if (j == m || Lambda[ j ] - Lambda[ j-1 ] > ortol) {
+                for (int64_t jj = begin; jj < j; ++jj) {
+                    if (local_col[ col_tile[ jj ] ]) {
+                        clusters.push_back( { begin, j } );
+                        break;
+                    }
+                }
+                begin = j;
+            }
+        }
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            for (auto cluster : clusters) {
+                #pragma omp task slate_omp_default_none \
+                    shared( D, E, Lambda, Z, row_offset, col_tile, \
+                            col_offset, local_col, info ) \
+                    firstprivate( cluster, n, mt, onenrm, mpi_rank )
+                {
+                    int64_t begin = cluster.first;
+                    int64_t end   = cluster.second;
+                    std::vector<real_t> X( n * (end - begin) );
+                    int64_t cluster_info = impl::stein_cluster(
+                        n, &D[0], &E[0], onenrm, &Lambda[0], begin, end,
+                        &X[0] );
+
+                    // Copy the rows of local tiles to Z.
+                    for (int64_t j = begin; j < end; ++j) {
+                        int64_t jt = col_tile[ j ];
+                        if (! local_col[ jt ])
+                            continue;
+                        int64_t jj = col_offset[ j ];
+                        real_t const* x = &X[ (j - begin)*n ];
+                        for (int64_t i = 0; i < mt; ++i) {
+                            if (Z.tileIsLocal( i, jt )) {
+                                auto T = Z( i, jt );
+                                for (int64_t ii = 0; ii < T.mb(); ++ii)
+                                    T.at( ii, jj ) = x[ row_offset[ i ] + ii ];
+                            }
+                        }
+                    }
+                    if (Z.tileRank( 0, col_tile[ begin ] ) == mpi_rank) {
+                        #pragma omp atomic
+                        info += cluster_info;
+                    }
+                }
+            }
+        }
+    }
+
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, &info, 1, MPI_INT64_T, MPI_SUM,
+                       Z.mpiComm() ) );
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+int64_t stein<float>(
+    std::vector<float> const& D,
+    std::vector<float> const& E,
+    std::vector<float> const& Lambda,
+    Matrix<float>& Z,
+    Options const& opts);
+
+template
+int64_t stein<double>(
+    std::vector<double> const& D,
+    std::vector<double> const& E,
+    std::vector<double> const& Lambda,
+    Matrix<double>& Z,
+    Options const& opts);
+
+template
+int64_t stein< std::complex<float> >(
+    std::vector<float> const& D,
+    std::vector<float> const& E,
+    std::vector<float> const& Lambda,
+    Matrix< std::complex<float> >& Z,
+    Options const& opts);
+
+template
+int64_t stein< std::complex<double> >(
+    std::vector<double> const& D,
+    std::vector<double> const& E,
+    std::vector<double> const& Lambda,
+    Matrix< std::complex<double> >& Z,
+    Options const& opts);
+
+} // namespace slate
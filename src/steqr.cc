@@ -11,6 +11,71 @@
 
 namespace slate {
 
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Computes all eigenvalues of a symmetric tridiagonal matrix and updates
+/// the local nrows-by-n matrix Z, as in the low-level steqr,
+/// using OpenMP threads.
+///
+/// The local rows of Z are split into blocks, and each thread runs steqr on
+/// its own copy of D and E, applying the rotations to one block.
+/// Since the rotations depend only on D and E, every thread computes the
+/// same rotations, as MPI ranks do for their local rows; see bdsqr.
+///
+/// @ingroup heev_impl
+///
+template <typename scalar_t>
+int64_t steqr(
+    int64_t n,
+    blas::real_type<scalar_t>* D,
+    blas::real_type<scalar_t>* E,
+    scalar_t* Z, int64_t ldz,
+    int64_t nrows )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    // Minimum number of rows per block, so applying the rotations
+    // outweighs computing them redundantly.
+    const int64_t min_block = 32;
+
+    int64_t lwork = std::max( int64_t( 1 ), 2*n - 2 );
+    int64_t nthreads = omp_get_max_threads();
+    int64_t block = std::max( min_block, ceildiv( nrows, nthreads ) );
+    if (nrows <= block) {
+        std::vector<real_t> work( lwork );
+        return slate::steqr( n, D, E, Z, ldz, nrows, &work[0], lwork );
+    }
+
+    // Each block is non-empty, so every call follows the same path.
+    int64_t nblocks = ceildiv( nrows, block );
+    std::vector<real_t> D_in( D, D + n );
+    std::vector<real_t> E_in( E, E + n - 1 );
+    int64_t info = 0;
+
+    #pragma omp parallel for schedule( dynamic, 1 ) slate_omp_default_none \
+        shared( D_in, E_in, info ) \
+        firstprivate( n, nrows, block, nblocks, lwork, D, E, Z, ldz )
+    for (int64_t b = 0; b < nblocks; ++b) {
+        int64_t begin = b*block;
+        int64_t size  = std::min( block, nrows - begin );
+
+        std::vector<real_t> D_b( D_in ), E_b( E_in ), work( lwork );
+        int64_t info_b = slate::steqr( n, &D_b[0], &E_b[0], &Z[ begin ], ldz,
+                                       size, &work[0], lwork );
+
+        // All blocks compute the same D and E; keep the first.
+        if (b == 0) {
+            std::copy( D_b.begin(), D_b.end(), D );
+            std::copy( E_b.begin(), E_b.end(), E );
+            info = info_b;
+        }
+    }
+    return info;
+}
+
+} // namespace impl
+
 //------------------------------------------------------------------------------
 /// Computes all eigenvalues and eigenvectors of a symmetric tridiagonal
 /// matrix using the implicit QL or QR iteration algorithm, as
@@ -19,6 +84,9 @@ namespace slate {
 /// For computing eigenvalues only, uses the Pal-Walker-Kahan variant of
 /// the QL or QR iteration algorithm, implemented in LAPACK's `sterf`.
 ///
+/// Z is redistributed to a 1D block row layout, and each rank updates
+/// its local rows in parallel using OpenMP threads.
+///
 /// ATTENTION: only host computation supported for now
 ///
 /// @ingroup heev_computational
@@ -46,15 +114,11 @@ void steqr(
     int64_t nrows = 0;
     int64_t ldz = 1;
     std::vector<scalar_t> Z1d_data( 1 );
-    std::vector< blas::real_type<scalar_t> > work( 1 );
 
     // Compute the local number of rows of the eigenvectors.
     // Build the matrix Z using 1-dim grid.
     slate::Matrix<scalar_t> Z1d;
     if (wantz) {
-        int64_t lwork = max( 1, 2*n-2 );
-        work.resize( lwork );
-
         // Find the total number of processors.
         int mpi_size;
         slate_mpi_call(
@@ -71,8 +135,8 @@ void steqr(
     }
 
     // Call the eigensolver.
-    int64_t info = steqr(
-        n, &D[0], &E[0], &Z1d_data[0], ldz, nrows, &work[0], work.size() );
+    int64_t info = impl::steqr(
+        n, &D[0], &E[0], &Z1d_data[0], ldz, nrows );
     slate_assert( info == 0 ); // todo: throw errors
 
     // Redstribute the 1-dim eigenvector matrix into 2-dim matrix.
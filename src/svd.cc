@@ -55,6 +55,14 @@ namespace slate {
 ///       - HostNest:  nested OpenMP parallel for loop on CPU host.
 ///       - HostBatch: batched BLAS on CPU host.
 ///       - Devices:   batched BLAS on GPU device.
+///     - Option::MethodSVD:
+///       Bidiagonal SVD solver, used if singular vectors are wanted.
+///       Possible values:
+///       - QR: QR iteration, with rotations applied by OpenMP threads
+///             to blocks of local rows [default].
+///       - DC: LAPACK's bdsdc, computed serially on rank 0,
+///             then redistributed; see bdsdc. Not a distributed solver;
+///             needs O(n^2) memory on rank 0, for min(m, n) = n.
 ///
 /// @ingroup svd
 ///
@@ -177,6 +185,7 @@ void svd(
 
     // Options
     Target target = get_option( opts, Option::Target, Target::HostTask );
+    MethodSVD method = get_option( opts, Option::MethodSVD, MethodSVD::QR );
 
     int64_t m = A.m();
     int64_t n = A.n();
@@ -271,11 +280,32 @@ void svd(
     ge2tb( Ahat, TU1, TV1, opts );
     timers[ "svd::ge2tb" ] = t_ge2tb.stop();
 
-    // Currently, tb2bd and bdsqr run on a single node,
-    // gathers band matrix to rank 0.
+    // Copy band, distributing block columns to ranks in contiguous ranges,
+    // so tb2bd pipelines bulge chasing across ranks, as in heev.
+    // Block column j takes part in about j*nb sweeps, so rank p gets
+    // block columns from nt sqrt( p / mpi_size ) to balance the work.
+    int mpi_size;
+    slate_mpi_call(
+        MPI_Comm_size( A.mpiComm(), &mpi_size ) );
+
+    int64_t nt = ceildiv( min_mn, nb );
+    std::vector<int> col_rank( nt );
+    for (int64_t j = 0; j < nt; ++j) {
+        double x = (j + 0.5) / nt;
+        col_rank[ j ] = std::min( int( mpi_size * x * x ), mpi_size - 1 );
+    }
+    std::function<int64_t (int64_t j)>
+        tileNb = func::uniform_blocksize( min_mn, nb );
+    std::function<int (func::ij_tuple ij)>
+        tileRank = [col_rank]( func::ij_tuple ij ) {
+            return col_rank[ std::max( std::get<0>( ij ), std::get<1>( ij ) ) ];
+        };
+    std::function<int (func::ij_tuple ij)>
+        tileDevice = []( func::ij_tuple ij ) { return HostNum; };
+
     TriangularBandMatrix<scalar_t> Aband( Uplo::Upper, Diag::NonUnit,
-                                          min_mn, nb, nb,
-                                          1, 1, A.mpiComm() );
+                                          min_mn, nb, tileNb,
+                                          tileRank, tileDevice, A.mpiComm() );
     Aband.insertLocalTiles();
 
     // Slice in case Ahat is rectangular.
@@ -285,43 +315,56 @@ void svd(
     // Allocate U2 and VT2 matrices for tb2bd.
     // These are (2nb)-by-vn with (2nb)-by-nb tile size.
     // vn has space for tiles to cover the lower or upper triangle.
-    int64_t nt = Aband.nt();
+    // Each tile is on the rank that computes its first vector in tb2bd,
+    // which is the same for U2 and VT2.
     int64_t vm = 2*nb;
     int64_t vn = nt*(nt + 1)/2*nb;
-    Matrix<scalar_t> VT2( vm, vn, vm, nb, 1, 1, A.mpiComm() );
-    Matrix<scalar_t>  U2( vm, vn, vm, nb, 1, 1, A.mpiComm() );
+    std::vector<int> v_rank( nt*(nt + 1)/2, 0 );
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t vindex = k*nt - k*(k - 1)/2;
+        for (int64_t index = 0; index < nt - k; ++index) {
+            int64_t col = index == 0 ? k*nb + 1 : index*nb + 1 + k*nb;
+            v_rank[ vindex + index ] = col_rank[ std::min( col/nb, nt-1 ) ];
+        }
+    }
+    std::function<int64_t (int64_t i)>
+        tileMbV = func::uniform_blocksize( vm, vm );
+    std::function<int64_t (int64_t j)>
+        tileNbV = func::uniform_blocksize( vn, nb );
+    std::function<int (func::ij_tuple ij)>
+        tileRankV = [v_rank]( func::ij_tuple ij ) {
+            return v_rank[ std::get<1>( ij ) ];
+        };
+    Matrix<scalar_t> VT2( vm, vn, tileMbV, tileNbV, tileRankV,
+                          tileDevice, A.mpiComm() );
+    Matrix<scalar_t>  U2( vm, vn, tileMbV, tileNbV, tileRankV,
+                          tileDevice, A.mpiComm() );
+    VT2.insertLocalTiles();
+    U2.insertLocalTiles();
 
     // Allocate E for super-diagonal.
     std::vector<real_t> E( min_mn - 1 );
 
     // 2. Reduce band to bi-diagonal.
-    if (A.mpiRank() == root) {
-        VT2.insertLocalTiles();
-        U2.insertLocalTiles();
-
-        Timer t_tb2bd;
-        tb2bd( Aband, U2, VT2, opts );
-        timers[ "svd::tb2bd" ] = t_tb2bd.stop();
-
-        // Copy diagonal and super-diagonal to vectors.
-        internal::copytb2bd( Aband, Sigma, E );
-
-        Aband.releaseRemoteWorkspace();
-    }
+    Timer t_tb2bd;
+    tb2bd( Aband, U2, VT2, opts );
+    timers[ "svd::tb2bd" ] = t_tb2bd.stop();
+
+    // Copy diagonal and super-diagonal to vectors.
+    // Each rank copies its block columns; sum to get the whole vectors.
+    internal::copytb2bd( Aband, Sigma, E );
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, &Sigma[0], min_mn, mpi_real_type,
+                       MPI_SUM, A.mpiComm() ) );
+    slate_mpi_call(
+        MPI_Allreduce( MPI_IN_PLACE, &E[0], min_mn-1, mpi_real_type,
+                       MPI_SUM, A.mpiComm() ) );
+
+    Aband.releaseRemoteWorkspace();
 
     scalar_t dummy[1];
 
     if (wantu || wantvt) {
-        int mpi_size;
-        slate_mpi_call(
-            MPI_Comm_size( A.mpiComm(), &mpi_size ) );
-
-        // Bcast the Sigma and E vectors (diagonal and sup/super-diagonal).
-        slate_mpi_call(
-            MPI_Bcast( &Sigma[0], min_mn,   mpi_real_type, root, A.mpiComm() ) );
-        slate_mpi_call(
-            MPI_Bcast( &E[0],     min_mn-1, mpi_real_type, root, A.mpiComm() ) );
-
         // Build the 1D distributed U and VT needed for bdsqr.
         // U3_1d_col  is mlocal_U-by-min_mn  on np-by-1 col grid (np = mpi_size).
         // VT3_1d_row is min_mn-by-nlocal_VT on 1-by-np row grid.
@@ -351,16 +394,22 @@ void svd(
         }
 
         // 3. Bi-diagonal SVD solver.
-        // Call LAPACK bdsqr directly, since SLATE bdsqr hides some
+        // Call low-level bdsqr directly, since SLATE bdsqr hides some
         // redistribute calls that we want to see to optimize the code
         // and reuse memory.
         //bdsqr<scalar_t>( jobu, jobvt, Sigma, E, Uhat, VThat, opts );
         Timer t_bdsvd;
-        lapack::bdsqr( Uplo::Upper, min_mn, nlocal_VT, mlocal_U, 0,
-                       &Sigma[0], &E[0],
-                       &VT3_1d_row_data[0], ldvt,
-                       &U3_1d_col_data[0], ldu,
-                       dummy, 1 );
+        if (method == MethodSVD::DC) {
+            Job jobu3  = wantu  ? Job::Vec : Job::NoVec;
+            Job jobvt3 = wantvt ? Job::Vec : Job::NoVec;
+            bdsdc( jobu3, jobvt3, Sigma, E, U3_1d_col, VT3_1d_row, opts );
+        }
+        else {
+            bdsqr<scalar_t>( Uplo::Upper, min_mn, nlocal_VT, mlocal_U,
+                             &Sigma[0], &E[0],
+                             &VT3_1d_row_data[0], ldvt,
+                             &U3_1d_col_data[0], ldu );
+        }
         timers[ "svd::bdsvd" ] = t_bdsvd.stop();
 
         // Back-transform: U = U0 * U1 * U2 * U3.
@@ -369,25 +418,17 @@ void svd(
         // U2 is the output of tb2bd.
         // U3 is the output of bdsqr.
         if (wantu) {
-            // Redistribute U3 from np-by-1 col grid to 1-by-np row grid.
-            Matrix<scalar_t> U3_1d_row(
-                min_mn, min_mn, nb, 1, mpi_size, A.mpiComm() );
-            U3_1d_row.insertLocalTiles( target );
+            // Redistribute U3 to top-left of U.
             Timer t_red;
-            redistribute( U3_1d_col, U3_1d_row, opts );
+            auto U_11 = U.slice( 0, min_mn-1, 0, min_mn-1 );
+            redistribute( U3_1d_col, U_11, opts );          // U_11 = U3
             timers[ "svd::redistribute" ] = t_red.stop();
 
-            // 2b. Backtransform tb2bd: U3 = U2 * U3.
+            // 2b. Backtransform tb2bd: U_11 = U2 * U_11.
             Timer t_unmbr_tb2bd_U;
-            unmtr_hb2st( Side::Left, Op::NoTrans, U2, U3_1d_row, opts );
+            unmbr_tb2bd( Side::Left, Op::NoTrans, U2, U_11, opts );
             timers[ "svd::unmbr_tb2bd_U" ] = t_unmbr_tb2bd_U.stop();
 
-            // Redistribute U3 to top-left of U.
-            t_red.start();
-            auto U_11 = U.slice( 0, min_mn-1, 0, min_mn-1 );
-            redistribute( U3_1d_row, U_11, opts );          // U_11 = U3
-            timers[ "svd::redistribute" ] += t_red.stop();
-
             // Rest of U is identity.
             if (m > n) {
                 auto U_21 = U.slice( n, m-1, 0, n-1 );
@@ -429,29 +470,17 @@ void svd(
         // VT2 is the output of tb2bd.
         // VT3 is the output of bdsqr.
         if (wantvt) {
-            // Redistribute and conjugate-transpose VT3_1d_row to
-            // V3_1d_row (no-trans), both on 1-by-np row grid.
-            Matrix<scalar_t> V3_1d_row(
-                min_mn, min_mn, nb, 1, mpi_size, A.mpiComm() );
-            V3_1d_row.insertLocalTiles( target );
-
+            // Redistribute VT3 to top-left of VT.
             Timer t_red;
-            auto V3 = conj_transpose( VT3_1d_row );
-            redistribute( V3, V3_1d_row, opts );
-            timers[ "svd::redistribute" ] = t_red.stop();
+            auto VT_11 = VT.slice( 0, min_mn-1, 0, min_mn-1 );
+            redistribute( VT3_1d_row, VT_11, opts );        // VT_11 = VT3
+            timers[ "svd::redistribute" ] += t_red.stop();
 
-            // 2b. Backtransform tb2bd: V = VT2 * V.
+            // 2b. Backtransform tb2bd: VT_11 = VT_11 * VT2^H.
             Timer t_unmbr_tb2bd_V;
-            unmtr_hb2st( Side::Left, Op::NoTrans, VT2, V3_1d_row, opts );
+            unmbr_tb2bd( Side::Right, Op::ConjTrans, VT2, VT_11, opts );
             timers[ "svd::unmbr_tb2bd_V" ] = t_unmbr_tb2bd_V.stop();
 
-            // Redistribute and conjugate-transpose V3_1d_row to top-left of VT.
-            t_red.start();
-            auto VT_11 = VT.slice( 0, min_mn-1, 0, min_mn-1 );
-            auto VT3 = conj_transpose( V3_1d_row );
-            redistribute( VT3, VT_11, opts );               // VT_11 = VT3
-            timers[ "svd::redistribute" ] += t_red.stop();
-
             // Rest of VT is identity.
             if (n > m) {
                 auto VT_12 = VT.slice( 0, m-1, m, n-1 );
@@ -71,6 +71,11 @@ inline MethodTrsm select_algo( TA& A, TB& B, Options const& opts )
 ///           - Auto: let the routine decides [default]
 ///           - trsmA: select trsmA routine
 ///           - trsmB: select trsmB routine
+///         - Option::BcastSharedMemory:
+///           Number of tiles per rank in a node-shared window, through
+///           which ranks on the same node as a tile's owner read
+///           broadcast tiles of A and B without copying them.
+///           0 disables it. Default A.bcastSharedMemory().
 ///         - Option::Target:
 ///           Implementation to target. Possible values:
 ///           - HostTask:  OpenMP tasks on CPU host [default].
@@ -92,6 +97,13 @@ void trsm(blas::Side side,
     if (method == MethodTrsm::Auto)
         method = select_algo( A, B, opts );
 
+    int64_t saved_shared_A = A.bcastSharedMemory();
+    int64_t saved_shared_B = B.bcastSharedMemory();
+    A.setBcastSharedMemory(
+        get_option<Option::BcastSharedMemory>( opts, saved_shared_A ) );
+    B.setBcastSharedMemory(
+        get_option<Option::BcastSharedMemory>( opts, saved_shared_B ) );
+
     switch (method) {
         case MethodTrsm::A:
             trsmA( side, alpha, A, B, opts );
@@ -101,6 +113,9 @@ void trsm(blas::Side side,
             trsmB( side, alpha, A, B, opts );
             break;
     }
+
+    A.setBcastSharedMemory( saved_shared_A );
+    B.setBcastSharedMemory( saved_shared_B );
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,129 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "slate/slate.hh"
+#include "auxiliary/Debug.hh"
+#include "slate/Matrix.hh"
+#include "internal/internal.hh"
+
+namespace slate {
+
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Distributed parallel unmbr_tb2bd.
+/// Generic implementation for any target.
+/// @ingroup svd_specialization
+///
+template <Target target, typename scalar_t>
+void unmbr_tb2bd(
+    Side side, Op op,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    // set min number for omp nested active parallel regions
+    slate::OmpSetMaxActiveLevels set_active_levels( MinOmpActiveLevels );
+
+    #pragma omp parallel
+    #pragma omp master
+    {
+        internal::unmbr_tb2bd<target>( side, op, V, C );
+        C.tileUpdateAllOrigin();
+    }
+    V.releaseWorkspace();
+    C.releaseWorkspace();
+}
+
+} // namespace impl
+
+//------------------------------------------------------------------------------
+/// Multiplies the general m-by-n matrix C by U or V from `slate::tb2bd`
+/// as follows:
+///
+/// op              |  side = Left  |  side = Right
+/// --------------- | ------------- | --------------
+/// op = NoTrans    |  $Q C  $      |  $C Q  $
+/// op = ConjTrans  |  $Q^H C$      |  $C Q^H$
+///
+/// where $Q$ is U or V, the unitary matrix defined as the product of
+/// the elementary reflectors from tb2bd.
+/// Typically, $U_2 U_3$ is computed with side = Left, op = NoTrans,
+/// and $V_3^H V_2^H$ with side = Right, op = ConjTrans.
+///
+/// Unlike `unmtr_hb2st`, C may have any 2D block cyclic distribution.
+///
+/// ATTENTION: only host computation supported for now.
+///
+//------------------------------------------------------------------------------
+/// @tparam scalar_t
+///     One of float, double, std::complex<float>, std::complex<double>.
+//------------------------------------------------------------------------------
+/// @param[in] side
+///     - Side::Left:  apply $Q$ or $Q^H$ from the left;
+///     - Side::Right: apply $Q$ or $Q^H$ from the right.
+///
+/// @param[in] op
+///     - Op::NoTrans    apply $Q$;
+///     - Op::ConjTrans: apply $Q^H$;
+///     - Op::Trans:     apply $Q^T$ (only if real).
+///       In the real case, Op::Trans is equivalent to Op::ConjTrans.
+///       In the complex case, Op::Trans is not allowed.
+///
+/// @param[in] V
+///     Householder vectors U or V as returned by `slate::tb2bd`,
+///     with tiles 2 nb-by-nb.
+///
+/// @param[in,out] C
+///     On entry, the m-by-n matrix $C$.
+///     On exit, $C$ is overwritten by $Q C$, $Q^H C$, $C Q$, or $C Q^H$.
+///     Its tiles along the side dimension must be nb.
+///
+/// @param[in] opts
+///     Additional options, as map of name = value pairs. Currently unused.
+///
+/// @ingroup svd_computational
+///
+template <typename scalar_t>
+void unmbr_tb2bd(
+    Side side, Op op,
+    Matrix<scalar_t>& V,
+    Matrix<scalar_t>& C,
+    Options const& opts)
+{
+    impl::unmbr_tb2bd<Target::HostTask>( side, op, V, C, opts );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmbr_tb2bd<float>(
+    Side side, Op op,
+    Matrix<float>& V,
+    Matrix<float>& C,
+    Options const& opts);
+
+template
+void unmbr_tb2bd<double>(
+    Side side, Op op,
+    Matrix<double>& V,
+    Matrix<double>& C,
+    Options const& opts);
+
+template
+void unmbr_tb2bd< std::complex<float> >(
+    Side side, Op op,
+    Matrix< std::complex<float> >& V,
+    Matrix< std::complex<float> >& C,
+    Options const& opts);
+
+template
+void unmbr_tb2bd< std::complex<double> >(
+    Side side, Op op,
+    Matrix< std::complex<double> >& V,
+    Matrix< std::complex<double> >& C,
+    Options const& opts);
+
+} // namespace slate
@@ -8,6 +8,7 @@
 #include "slate/Matrix.hh"
 #include "slate/TriangularMatrix.hh"
 #include "internal/internal.hh"
+#include "internal/internal_util.hh"
 
 namespace slate {
 
@@ -43,7 +44,7 @@ namespace slate {
 ///
 /// @param[in] A
 ///     On entry, the n-by-n Hermitian matrix $A$, as returned by
-///     `slate::he2hb`.
+///     `slate::he2hb`. Either lower or upper, on any p-by-q process grid.
 ///
 /// @param[in] T
 ///     On entry, triangular matrices of the elementary
@@ -78,9 +79,9 @@ void unmtr_he2hb(
     };
 
     if (A.uplo() == Uplo::Upper) {
-        // todo: never tested.
-        auto A_sub = slate::Matrix<scalar_t>(A, 0, A.nt()-1, 1, A.nt()-1);
-        slate::unmlq(side, op, A_sub, T_sub, C, opts);
+        // he2hb reduced lower( A^H ); apply Q from a copy of it.
+        auto AL = internal::hermitian_lower_from_upper( A );
+        unmtr_he2hb( side, op, AL, T, C, opts );
     }
     else { // uplo == Uplo::Lower
         auto A_sub = slate::Matrix<scalar_t>(A, 1, A.nt()-1, 0,  A.nt()-1);
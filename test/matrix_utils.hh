@@ -26,6 +26,10 @@ void copy_he2gb(
     using blas::conj;
     int64_t nt = A.nt();
     const scalar_t zero = 0;
+    bool lower = A.uplo() == slate::Uplo::Lower;
+    // The band part of the off-diagonal tile is the upper triangle
+    // of A(i+1, i) if lower, or the lower triangle of A(i, i+1) if upper.
+    slate::Uplo uplo_band = lower ? slate::Uplo::Upper : slate::Uplo::Lower;
     set(zero, B);
     for (int64_t i = 0; i < nt; ++i) {
         int tag_i = i+1;
@@ -34,35 +38,48 @@ void copy_he2gb(
             A.tileGetForReading(i, i, slate::LayoutConvert::ColMajor);
             auto Aii = A(i, i);
             auto Bii = B(i, i);
-            Aii.uplo(slate::Uplo::Lower);
-            Bii.uplo(slate::Uplo::Lower);
+            Aii.uplo(A.uplo());
+            Bii.uplo(A.uplo());
             slate::tile::tzcopy( Aii, Bii );
             // Symmetrize the tile.
-            for (int64_t jj = 0; jj < Bii.nb(); ++jj)
-                for (int64_t ii = jj; ii < Bii.mb(); ++ii)
-                    Bii.at(jj, ii) = conj(Bii(ii, jj));
+            for (int64_t jj = 0; jj < Bii.nb(); ++jj) {
+                for (int64_t ii = jj; ii < Bii.mb(); ++ii) {
+                    if (lower)
+                        Bii.at(jj, ii) = conj(Bii(ii, jj));
+                    else
+                        Bii.at(ii, jj) = conj(Bii(jj, ii));
+                }
+            }
         }
-        if (i+1 < nt && B.tileIsLocal(i+1, i)) {
-            // sub-diagonal tile
-            A.tileGetForReading(i+1, i, slate::LayoutConvert::ColMajor);
-            auto Ai1i = A(i+1, i);
-            auto Bi1i = B(i+1, i);
-            Ai1i.uplo(slate::Uplo::Upper);
-            Bi1i.uplo(slate::Uplo::Upper);
-            slate::tile::tzcopy( Ai1i, Bi1i );
-            if (! B.tileIsLocal(i, i+1))
-                B.tileSend(i+1, i, B.tileRank(i, i+1), tag_i);
+        if (i+1 >= nt)
+            continue;
+
+        // Stored off-diagonal tile (i1, j1), and its transpose (i2, j2).
+        int64_t i1 = lower ? i+1 : i;
+        int64_t j1 = lower ? i : i+1;
+        int64_t i2 = j1;
+        int64_t j2 = i1;
+        if (B.tileIsLocal(i1, j1)) {
+            // sub-diagonal or super-diagonal tile
+            A.tileGetForReading(i1, j1, slate::LayoutConvert::ColMajor);
+            auto Aij = A(i1, j1);
+            auto Bij = B(i1, j1);
+            Aij.uplo(uplo_band);
+            Bij.uplo(uplo_band);
+            slate::tile::tzcopy( Aij, Bij );
+            if (! B.tileIsLocal(i2, j2))
+                B.tileSend(i1, j1, B.tileRank(i2, j2), tag_i);
         }
-        if (i+1 < nt && B.tileIsLocal(i, i+1)) {
-            if (! B.tileIsLocal(i+1, i)) {
-                // Remote copy-transpose B(i+1, i) => B(i, i+1);
+        if (B.tileIsLocal(i2, j2)) {
+            if (! B.tileIsLocal(i1, j1)) {
+                // Remote copy-transpose B(i1, j1) => B(i2, j2);
                 // assumes square tiles!
-                B.tileRecv(i+1, i, B.tileRank(i+1, i), slate::Layout::ColMajor, tag_i);
-                slate::tile::deepConjTranspose( B(i+1, i), B(i, i+1) );
+                B.tileRecv(i1, j1, B.tileRank(i1, j1), slate::Layout::ColMajor, tag_i);
+                slate::tile::deepConjTranspose( B(i1, j1), B(i2, j2) );
             }
             else {
-                // Local copy-transpose B(i+1, i) => B(i, i+1).
-                slate::tile::deepConjTranspose( B(i+1, i), B(i, i+1) );
+                // Local copy-transpose B(i1, j1) => B(i2, j2).
+                slate::tile::deepConjTranspose( B(i1, j1), B(i2, j2) );
             }
         }
     }
@@ -71,52 +88,56 @@ void copy_he2gb(
 //------------------------------------------------------------------------------
 // Convert a HermitianMatrix into a General Matrix, ConjTrans/Trans the opposite
 // off-diagonal tiles
-// todo: shouldn't assume the input HermitianMatrix has uplo=lower
 template <typename scalar_t>
 void copy_he2ge(
     slate::HermitianMatrix<scalar_t> A,
     slate::Matrix<scalar_t> B )
 {
-    // todo:: shouldn't assume the input matrix has uplo=lower
-    assert(A.uplo() == slate::Uplo::Lower);
-
     using blas::conj;
     const scalar_t zero = 0;
+    bool lower = A.uplo() == slate::Uplo::Lower;
     set(zero, B);
     for (int64_t j = 0; j < A.nt(); ++j) {
-        // todo: shouldn't assume uplo=lowwer
         for (int64_t i = j; i < A.nt(); ++i) {
+            // Stored tile (i1, j1), and its transpose (i2, j2).
+            int64_t i1 = lower ? i : j;
+            int64_t j1 = lower ? j : i;
+            int64_t i2 = j1;
+            int64_t j2 = i1;
             if (i == j) { // diagonal tiles
                 if (B.tileIsLocal(i, j)) {
                     auto Aij = A(i, j);
                     auto Bij = B(i, j);
-                    Aij.uplo(slate::Uplo::Lower);
-                    Bij.uplo(slate::Uplo::Lower);
+                    Aij.uplo(A.uplo());
+                    Bij.uplo(A.uplo());
                     slate::tile::tzcopy( Aij, Bij );
                     for (int64_t jj = 0; jj < Bij.nb(); ++jj) {
                         for (int64_t ii = jj; ii < Bij.mb(); ++ii) {
-                            Bij.at(jj, ii) = conj(Bij(ii, jj));
+                            if (lower)
+                                Bij.at(jj, ii) = conj(Bij(ii, jj));
+                            else
+                                Bij.at(ii, jj) = conj(Bij(jj, ii));
                         }
                     }
                 }
             }
             else {
-                if (B.tileIsLocal(i, j)) {
-                    auto Aij = A(i, j);
-                    auto Bij = B(i, j);
+                if (B.tileIsLocal(i1, j1)) {
+                    auto Aij = A(i1, j1);
+                    auto Bij = B(i1, j1);
                     slate::tile::gecopy( Aij, Bij );
-                    if (! B.tileIsLocal(j, i)) {
-                        B.tileSend(i, j, B.tileRank(j, i));
+                    if (! B.tileIsLocal(i2, j2)) {
+                        B.tileSend(i1, j1, B.tileRank(i2, j2));
                     }
                 }
-                if (B.tileIsLocal(j, i)) {
-                    if (! B.tileIsLocal(i, j)) {
+                if (B.tileIsLocal(i2, j2)) {
+                    if (! B.tileIsLocal(i1, j1)) {
                         B.tileRecv(
-                            j, i, B.tileRank(i, j), slate::Layout::ColMajor);
-                        slate::tile::deepConjTranspose( B(j, i) );
+                            i2, j2, B.tileRank(i1, j1), slate::Layout::ColMajor);
+                        slate::tile::deepConjTranspose( B(i2, j2) );
                     }
                     else {
-                        slate::tile::deepConjTranspose( B(i, j), B(j, i) );
+                        slate::tile::deepConjTranspose( B(i1, j1), B(i2, j2) );
                     }
                 }
             }
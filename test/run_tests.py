@@ -424,7 +424,7 @@ if (opts.lu):
     #[ 'gerfs', gen + dtype + la + n + trans ],
     #[ 'geequ', gen + dtype + la + n ],
     [ 'gesv_mixed',   gen + dtype_double + la + n + ge_matrix + nonuniform_nb ],
-    [ 'gesv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1' + ge_matrix + nonuniform_nb ],
+    [ 'gesv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1,10 --factor s,h,b' + ge_matrix + nonuniform_nb ],
     [ 'gesv_rbt', gen + dtype + la + n + ge_matrix ],
     ]
 
@@ -448,7 +448,7 @@ if (opts.chol):
     #[ 'porfs', gen + dtype + la + n + uplo ],
     #[ 'poequ', gen + dtype + la + n ],  # only diagonal elements (no uplo)
     [ 'posv_mixed', gen + dtype_double + la + n + he_matrix ],
-    [ 'posv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1' + he_matrix ],
+    [ 'posv_mixed_gmres',  gen + dtype_double + la + n + ' --nrhs 1,10 --factor s,h,b' + he_matrix ],
     [ 'trtri', gen + dtype + la + n + uplo + diag ],
     ]
 
@@ -542,29 +542,35 @@ if (opts.rq):
 
 # symmetric/Hermitian eigenvalues
 if (opts.syev):
-    # todo: uplo
     if ('n' in jobz):
         # Requires ref to check. Only QR.
-        cmds += [[ 'heev', gen + dtype + la + n + ' --jobz n --ref y --method-eig qr' ]]
+        cmds += [[ 'heev', gen + dtype + la + n + uplo + ' --jobz n --ref y --method-eig qr' ]]
     if ('v' in jobz):
-        cmds += [[ 'heev', gen + dtype + la + n + ' --jobz v --method-eig dc' ]]
-        cmds += [[ 'heev', gen + dtype + la + n + ' --jobz v --method-eig qr' ]]
+        cmds += [[ 'heev', gen + dtype + la + n + uplo + ' --jobz v --method-eig dc' ]]
+        cmds += [[ 'heev', gen + dtype + la + n + uplo + ' --jobz v --method-eig qr' ]]
+        cmds += [[ 'heev', gen + dtype + la + n + uplo + ' --jobz v --method-eig bisection' ]]
+
+    # Subsets of eigenvalues use bisection and inverse iteration.
+    cmds += [
+    [ 'heev', gen + dtype + la + n + uplo + jobz + ' --ref y --il 1 --iu 10' ],
+    [ 'heev', gen + dtype + la + n + uplo + jobz + ' --ref y --fraction-start 0.5 --fraction 0.1' ],
+    [ 'heev', gen + dtype + la + n + uplo + jobz + ' --ref y --vl -1 --vu 1' ],
+    ]
 
     cmds += [
     # heev uses only side=l, no-trans. side=r and trans don't yet work
     # with multiple ranks.
-    # todo uplo, nk
+    # todo nk
     #[ 'unmtr_he2hb', gen + dtype_real    + side + trans    + n ],  # real does trans = N, T, C
     #[ 'unmtr_he2hb', gen + dtype_complex + side + trans_nc + n ],  # complex does trans = N, C
-    [ 'unmtr_he2hb', gen + dtype_real    + ' --side l --trans n' + n ],
-    [ 'unmtr_he2hb', gen + dtype_complex + ' --side l --trans n' + n ],
+    [ 'unmtr_he2hb', gen + dtype_real    + uplo + ' --side l --trans n' + n ],
+    [ 'unmtr_he2hb', gen + dtype_complex + uplo + ' --side l --trans n' + n ],
 
     # todo: uplo, side, trans, nk
     [ 'unmtr_hb2st', gen_no_target + dtype_real    + n ],
     [ 'unmtr_hb2st', gen_no_target + dtype_complex + n ],
 
-    # todo: uplo
-    [ 'he2hb', gen + dtype + n ],
+    [ 'he2hb', gen + dtype + n + uplo ],
     [ 'hb2st', gen_no_target + dtype + n ],
 
     [ 'stedc', gen + n ],
@@ -579,6 +585,17 @@ if (opts.syev):
     [ 'steqr',  grid + check + ref + tol + repeat + dtype + n + ' --jobz n,v' ],
     ]
 
+    # he2hb and heev also on non-square 1 x np and np x 1 grids,
+    # unless the grid is given.
+    np = int( opts.np )
+    if (not opts.grid and np > 1):
+        for grid_ns in (' --grid 1x%d' % np, ' --grid %dx1' % np):
+            cmds += [
+            [ 'he2hb', gen + grid_ns + dtype + n + uplo ],
+            [ 'unmtr_he2hb', gen + grid_ns + dtype + uplo + ' --side l --trans n' + n ],
+            [ 'heev',  gen + grid_ns + dtype + la + n + uplo + ' --jobz v --method-eig dc' ],
+            ]
+
 # generalized symmetric/Hermitian eigenvalues
 if (opts.sygv):
     cmds += [
@@ -606,6 +623,7 @@ if (opts.svd):
         cmds += [[ 'svd', gen + dtype + la + mn + ' --jobu n --jobvt n' + ge_matrix ]]
     if ('v' in jobu or 's' in jobu):
         cmds += [[ 'svd', gen + dtype + la + mn + ' --jobu v --jobvt v' + ge_matrix ]]
+        cmds += [[ 'svd', gen + dtype + la + mn + ' --jobu v --jobvt v --method-svd dc' + ge_matrix ]]
     if ('a' in jobu):
         cmds += [[ 'svd', gen + dtype + la + mn + ' --jobu a --jobvt a' + ge_matrix ]]
 
@@ -614,7 +632,7 @@ if (opts.svd):
     [ 'ge2tb', gen + dtype + n + tall + ' --jobu v --jobvt v' ],
     # tb2bd, bdsqr don't take origin, target
     [ 'tb2bd', gen_no_target + dtype + n + ' --jobu v --jobvt v' ],
-    [ 'bdsqr', gen_no_target + dtype + n + uplo ],
+    [ 'bdsqr', gen_no_target + dtype + n + uplo + ' --method-svd qr,dc' ],
     ]
 
 # norms
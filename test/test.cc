@@ -3,6 +3,7 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#include <cmath>
 #include <complex>
 
 #include <iostream>
@@ -54,6 +55,7 @@ using slate::MethodGels,   slate::MethodGels_help;
 using slate::MethodGemm,   slate::MethodGemm_help;
 using slate::MethodHemm,   slate::MethodHemm_help;
 using slate::MethodLU,     slate::MethodLU_help;
+using slate::MethodSVD,    slate::MethodSVD_help;
 using slate::MethodTrsm,   slate::MethodTrsm_help;
 using slate::NormScope,    slate::NormScope_help;
 using slate::Origin,       slate::Origin_help;
@@ -396,6 +398,7 @@ Params::Params():
     method_gemm  ( "gemm",    4, PT_List, MethodGemm::Auto, MethodGemm_help ),
     method_hemm  ( "hemm",    4, PT_List, MethodHemm::Auto, MethodHemm_help ),
     method_lu    ( "lu",      5, PT_List, MethodLU::PartialPiv, MethodLU_help ),
+    method_svd   ( "svd",     3, PT_List, MethodSVD::QR, MethodSVD_help ),
     method_trsm  ( "trsm",    4, PT_List, MethodTrsm::Auto, MethodTrsm_help ),
 
     grid_order( "go",         3, PT_List, GridOrder::Col, "(go) MPI grid order: c=Col, r=Row" ),
@@ -463,6 +466,7 @@ Params::Params():
                 " to deflate, e.g., --deflate '1 2/4 3/5'" ),
     itermax   ( "itermax",    7,    PT_List, 30,     -1, 1e6, "Maximum number of iterations for refinement" ),
     fallback  ( "fallback",   0,    PT_List, 'y',  "ny",      "If refinement fails, fallback to a robust solver" ),
+    factor    ( "factor",     6,    PT_List, 's',  "shb",     "Storage precision of the factor in mixed solvers: s=single, h=half, b=bfloat16" ),
     depth     ( "depth",      5,    PT_List,  2,      0, 1e3, "Number of butterflies to apply" ),
 
     //----- output parameters
@@ -527,6 +531,7 @@ Params::Params():
     method_gemm.name("gemm", "method-gemm");
     method_hemm.name("hemm", "method-hemm");
     method_lu.name("lu", "method-lu");
+    method_svd.name("svd", "method-svd");
     method_trsm.name("trsm", "method-trsm");
 
     // change names of matrix B's params
@@ -570,6 +575,51 @@ Params::Params():
     // routine's parameters are marked by the test routine; see main
 }
 
+// -----------------------------------------------------------------------------
+/// Sets range, vl, vu, il, iu for eigen/singular value routines of order n,
+/// from the vl, vu, il, iu, fraction_start, and fraction parameters,
+/// and marks them as used.
+/// If vl or vu is finite, range = Value; if il or iu is set, or fraction
+/// selects a subset, range = Index; otherwise range = All.
+/// Sets il_out, iu_out to the indices actually used.
+///
+void Params::get_range(
+    int64_t n, lapack::Range* range,
+    double* vl, double* vu, int64_t* il, int64_t* iu )
+{
+    *vl = this->vl();
+    *vu = this->vu();
+    *il = this->il();
+    *iu = this->iu();
+    double frac_start = this->fraction_start();
+    double frac       = this->fraction();
+
+    if (! std::isinf( *vl ) || ! std::isinf( *vu )) {
+        *range = lapack::Range::Value;
+        *il = 1;
+        *iu = n;
+    }
+    else if (frac_start != 0 || frac != 1) {
+        *range = lapack::Range::Index;
+        *il = std::min( n, 1 + int64_t( frac_start * n ) );
+        *iu = std::min( n, *il - 1 + int64_t( frac * n ) );
+    }
+    else if (*il != 1 || (*iu != -1 && *iu != n)) {
+        *range = lapack::Range::Index;
+        if (*iu == -1)
+            *iu = n;
+        *il = std::min( *il, n );
+        *iu = std::min( *iu, n );
+    }
+    else {
+        *range = lapack::Range::All;
+        *il = 1;
+        *iu = n;
+    }
+    il_out() = *il;
+    iu_out() = *iu;
+}
+
 // -----------------------------------------------------------------------------
 /// Prints an error in an MPI-aware fashion.
 /// If some ranks have a non-empty error message, rank 0 prints one of them
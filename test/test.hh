@@ -205,6 +205,9 @@ public:
 
     Params();
 
+    void get_range( int64_t n, lapack::Range* range,
+                    double* vl, double* vu, int64_t* il, int64_t* iu );
+
     // Field members are explicitly public.
     // Order here determines output order.
     //----- test framework parameters
@@ -237,6 +240,7 @@ public:
     testsweeper::ParamEnum< slate::MethodGemm >     method_gemm;
     testsweeper::ParamEnum< slate::MethodHemm >     method_hemm;
     testsweeper::ParamEnum< slate::MethodLU >       method_lu;
+    testsweeper::ParamEnum< slate::MethodSVD >      method_svd;
     testsweeper::ParamEnum< slate::MethodTrsm >     method_trsm;
 
     testsweeper::ParamEnum< slate::GridOrder >      grid_order;
@@ -308,6 +312,7 @@ public:
     testsweeper::ParamString  deflate;
     testsweeper::ParamInt     itermax;
     testsweeper::ParamChar    fallback;
+    testsweeper::ParamChar    factor;
     testsweeper::ParamInt     depth;
 
     //----- output parameters
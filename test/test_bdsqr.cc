@@ -39,6 +39,7 @@ void test_bdsqr_work(Params& params, bool run)
     bool check = params.check() == 'y';
     bool trace = params.trace() == 'y';
     slate::Origin origin = params.origin();
+    slate::MethodSVD method_svd = params.method_svd();
 
     // mark non-standard output values
     params.time();
@@ -127,7 +128,10 @@ void test_bdsqr_work(Params& params, bool run)
     //==================================================
     // Run SLATE test.
     //==================================================
-    slate::bdsqr<scalar_t>(jobu, jobvt, D, E, U, VT);
+    if (method_svd == slate::MethodSVD::DC)
+        slate::bdsdc<scalar_t>(jobu, jobvt, D, E, U, VT);
+    else
+        slate::bdsqr<scalar_t>(jobu, jobvt, D, E, U, VT);
 
     params.time() = barrier_get_wtime(MPI_COMM_WORLD) - time;
 
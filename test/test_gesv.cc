@@ -137,11 +137,16 @@ void test_gesv_work(Params& params, bool run)
 
     int64_t itermax = 0;
     bool fallback = true;
+    slate::FactorPrecision factor = slate::FactorPrecision::Single;
     if (is_iterative) {
         params.iters();
         fallback = params.fallback() == 'y';
         itermax = params.itermax();
     }
+    if (params.routine == "gesv_mixed"
+        || params.routine == "gesv_mixed_gmres") {
+        factor = slate::FactorPrecision( params.factor() );
+    }
 
     int64_t depth = 0;
     if (params.routine == "gesv_rbt") {
@@ -174,6 +179,7 @@ void test_gesv_work(Params& params, bool run)
         {slate::Option::Depth, depth},
         {slate::Option::MaxIterations, itermax},
         {slate::Option::UseFallbackSolver, fallback},
+        {slate::Option::FactorPrecision, factor},
     };
 
     int64_t info = 0;
@@ -82,10 +82,29 @@ void test_hb2st_work(Params& params, bool run)
     auto Afull = slate::HermitianMatrix<scalar_t>::fromLAPACK(
         uplo, n, &Afull_data[0], lda, nb, p, q, MPI_COMM_WORLD);
 
-    // Copy band of Afull, currently to rank 0.
+    // Copy band of Afull. As in heev, distribute block columns in
+    // contiguous ranges, so hb2st pipelines bulge chasing across ranks.
+    // Distributed hb2st requires lower, so upper is all on rank 0.
+    int mpi_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    int64_t nt = Afull.nt();
+    std::vector<int> col_rank( nt );
+    for (int64_t j = 0; j < nt; ++j) {
+        double x = (j + 0.5) / nt;
+        col_rank[ j ] = upper ? 0
+                      : std::min( int( mpi_size * x * x ), mpi_size - 1 );
+    }
+    std::function<int64_t (int64_t j)>
+        tileNb = slate::func::uniform_blocksize( n, nb );
+    std::function<int (slate::func::ij_tuple ij)>
+        tileRank = [col_rank]( slate::func::ij_tuple ij ) {
+            return col_rank[ std::min( std::get<0>( ij ), std::get<1>( ij ) ) ];
+        };
+    std::function<int (slate::func::ij_tuple ij)>
+        tileDevice = []( slate::func::ij_tuple ij ) { return slate::HostNum; };
+
     auto Aband = slate::HermitianBandMatrix<scalar_t>(
-        uplo, n, band, nb,
-        1, 1, MPI_COMM_WORLD);
+        uplo, n, band, tileNb, tileRank, tileDevice, MPI_COMM_WORLD);
     Aband.insertLocalTiles();
     Aband.he2hbGather( Afull );
 
@@ -97,8 +116,8 @@ void test_hb2st_work(Params& params, bool run)
     // Matrix to store Householder vectors.
     // Could pack into a lower triangular matrix, but we store each
     // parallelogram in a 2nb-by-nb tile, with nt(nt + 1)/2 tiles.
+    // Here, V is on rank 0, so hb2st sends vectors computed on other ranks.
     int64_t vm = 2*nb;
-    int64_t nt = Afull.nt();
     int64_t vn = nt*(nt + 1)/2*nb;
     slate::Matrix<scalar_t> V(vm, vn, vm, nb, 1, 1, MPI_COMM_WORLD);
     V.insertLocalTiles();
@@ -121,11 +140,8 @@ void test_hb2st_work(Params& params, bool run)
 
     //==================================================
     // Run SLATE test.
-    // Currently runs only on rank 0.
     //==================================================
-    if (mpi_rank == 0) {
-        slate::hb2st(Aband, V);
-    }
+    slate::hb2st(Aband, V);
 
     time = barrier_get_wtime(MPI_COMM_WORLD) - time;
     params.time() = time;
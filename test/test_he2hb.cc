@@ -59,16 +59,6 @@ void test_he2hb_work(Params& params, bool run)
     MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
     gridinfo(mpi_rank, p, q, &myrow, &mycol);
 
-    // Skip invalid or unimplemented options.
-    if (uplo == slate::Uplo::Upper) {
-        params.msg() = "skipping: Uplo::Upper isn't supported.";
-        return;
-    }
-    if (p != q) {
-        params.msg() = "skipping: requires square process grid (p == q).";
-        return;
-    }
-
     // Matrix A: figure out local size.
     int64_t mlocal = num_local_rows_cols(n, nb, myrow, p);
     int64_t nlocal = num_local_rows_cols(n, nb, mycol, q);
@@ -155,10 +145,14 @@ void test_he2hb_work(Params& params, bool run)
         //                     one, TriangularMatrix(B));
         for (int64_t j = 0; j < A.nt(); ++j) {
             for (int64_t i = j; i < A.nt(); ++i) {
-                if (Aref.tileIsLocal(i, j)) {
-                    auto Aij = Aref(i, j);
-                    auto Bij = B(i, j);
-                    // if i == j, Aij was Lower; set it to General for axpy.
+                // Tile (i, j) of lower, or (j, i) of upper.
+                int64_t ii = uplo == slate::Uplo::Lower ? i : j;
+                int64_t jj = uplo == slate::Uplo::Lower ? j : i;
+                if (Aref.tileIsLocal(ii, jj)) {
+                    auto Aij = Aref(ii, jj);
+                    auto Bij = B(ii, jj);
+                    // if i == j, Aij was Lower or Upper;
+                    // set it to General for axpy.
                     Aij.uplo(slate::Uplo::General);
                     slate::tile::add( -one, Aij, Bij );
                 }
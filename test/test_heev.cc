@@ -15,6 +15,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <limits>
+#include <string>
 #include <utility>
 
 //------------------------------------------------------------------------------
@@ -51,6 +52,12 @@ void test_heev_work(Params& params, bool run)
     slate::MethodEig method_eig = params.method_eig();
     params.matrix.mark();
 
+    // Range of eigenvalues to find, from vl, vu, il, iu, or fraction.
+    slate::Range range;
+    double vl, vu;
+    int64_t il, iu;
+    params.get_range( n, &range, &vl, &vu, &il, &iu );
+
     // mark non-standard output values
     params.time();
     params.ref_time();
@@ -91,30 +98,9 @@ void test_heev_work(Params& params, bool run)
     slate::HermitianMatrix<scalar_t> A( uplo, n, nb, p, q, MPI_COMM_WORLD );
 
     // Vector Lambda (global output) has eigenvalues in ascending order.
+    // For a subset, heev resizes it to the number of eigenvalues found.
     std::vector<real_t> Lambda( n );
 
-    // Test that invalid or unimplemented options throw exceptions.
-    bool invalid = false;
-    if (uplo == slate::Uplo::Upper) {
-        params.msg() = "Uplo::Upper isn't supported.";
-        invalid = true;
-    }
-    else if (p != q) {
-        params.msg() = "requires square process grid (p == q).";
-        invalid = true;
-    }
-    if (invalid) {
-        params.okay() = false;  // fails unless caught below
-        try {
-            slate::eig_vals( A, Lambda, opts );
-        }
-        catch (slate::Exception const& ex) {
-            //params.msg() += std::string(" Caught: ") + ex.what();
-            params.okay() = testsweeper::skipped;
-        }
-        return;
-    }
-
     // Figure out local size.
     // matrix A (local input), m-by-n, symmetric matrix
     int64_t mlocA = num_local_rows_cols(n, nb, myrow, p);
@@ -163,7 +149,7 @@ void test_heev_work(Params& params, bool run)
     slate::Matrix<scalar_t> Aref_gen;
     if (check || ref) {
         Aref_data.resize( lldA * nlocA );
-        Lambda_ref.resize( Lambda.size() );
+        Lambda_ref.resize( n );
         Aref = slate::HermitianMatrix<scalar_t>::fromScaLAPACK(
                    uplo, n, &Aref_data[0], lldA, nb, p, q, MPI_COMM_WORLD);
         Aref_gen = slate::Matrix<scalar_t>::fromScaLAPACK(
@@ -181,7 +167,17 @@ void test_heev_work(Params& params, bool run)
         //==================================================
         // Run SLATE test.
         //==================================================
-        if (jobz == slate::Job::NoVec) {
+        if (range != slate::Range::All) {
+            if (jobz == slate::Job::NoVec) {
+                slate::heev( range, real_t( vl ), real_t( vu ), il, iu,
+                             A, Lambda, opts );
+            }
+            else {
+                slate::heev( range, real_t( vl ), real_t( vu ), il, iu,
+                             A, Lambda, Z, opts );
+            }
+        }
+        else if (jobz == slate::Job::NoVec) {
             slate::eig_vals( A, Lambda, opts );
             // Or slate::eig( A, Lambda, opts );
             // Using traditional BLAS/LAPACK name
@@ -192,6 +188,7 @@ void test_heev_work(Params& params, bool run)
             // Using traditional BLAS/LAPACK name
             // slate::heev( A, Lambda, Z, opts );
         }
+        int64_t m = Lambda.size();
 
         time = barrier_get_wtime(MPI_COMM_WORLD) - time;
 
@@ -207,7 +204,69 @@ void test_heev_work(Params& params, bool run)
             params.time6() = slate::timers[ "heev::unmtr_he2hb" ];
         }
 
-        if (check && jobz == slate::Job::Vec) {
+        if (check && jobz == slate::Job::Vec && range != slate::Range::All) {
+            //==================================================
+            // For a subset of m eigenpairs, test results by checking
+            // the residual
+            //
+            //      || A Z - Z Lambda ||_1
+            //     ------------------------ < tol * epsilon
+            //          || A ||_1 * N
+            //
+            // and orthogonality
+            //
+            //      || I - Z^H Z ||_1
+            //     ------------------- < tol * epsilon
+            //              N
+            //
+            // where Z is the first m columns.
+            //==================================================
+            if (m > 0) {
+                auto Zm = Z.slice( 0, n-1, 0, m-1 );
+
+                // Compute R = Zm Lambda.
+                auto R = Zm.emptyLike();
+                R.insertLocalTiles();
+                slate::copy( Zm, R );
+
+                int64_t mt = R.mt();
+                int64_t nt = R.nt();
+                int64_t jj = 0;
+                for (int64_t j = 0; j < nt; ++j) {
+                    #pragma omp parallel for slate_omp_default_none \
+                        firstprivate( mt, j, jj ) shared( R, Lambda )
+                    for (int64_t i = 0; i < mt; ++i) {
+                        if (R.tileIsLocal( i, j )) {
+                            auto T = R( i, j );
+                            scalar_t* T_data = T.data();
+                            int64_t ldt = T.stride();
+                            int64_t mb  = T.mb();
+                            int64_t nb2 = T.nb();
+                            for (int64_t tj = 0; tj < nb2; ++tj)
+                                for (int64_t ti = 0; ti < mb; ++ti)
+                                    T_data[ ti + tj*ldt ] *= Lambda[ jj + tj ];
+                        }
+                    }
+                    jj += R.tileNb( j );
+                }
+
+                // R = A Zm - Zm Lambda, with the original A in Aref.
+                slate::hemm( slate::Side::Left, one, Aref, Zm, -one, R );
+                real_t Anorm = slate::norm( slate::Norm::One, Aref );
+                params.error2() = slate::norm( slate::Norm::One, R ) / (Anorm * n);
+                params.okay() = (params.error2() <= tol);
+
+                // I - Zm^H Zm
+                slate::Matrix<scalar_t> Im( m, m, nb, p, q, MPI_COMM_WORLD );
+                Im.insertLocalTiles();
+                slate::set( zero, one, Im );
+                auto ZmH = conj_transpose( Zm );
+                slate::gemm( -one, ZmH, Zm, one, Im );
+                params.ortho() = slate::norm( slate::Norm::One, Im ) / n;
+                params.okay() = params.okay() && (params.ortho() <= tol);
+            }
+        }
+        else if (check && jobz == slate::Job::Vec) {
             //==================================================
             // Test results by checking backwards error
             //
@@ -368,13 +427,40 @@ void test_heev_work(Params& params, bool run)
             params.ref_time() = time;
 
             if (! ref_only) {
-                // Reference Scalapack was run, check reference against test
-                // Perform a local operation to get differences Lambda = Lambda - Lambda_ref
-                blas::axpy( n, -1.0, &Lambda_ref[0], 1, &Lambda[0], 1 );
-
-                // Relative forward error: || Lambda_ref - Lambda || / || Lambda_ref ||.
-                params.error() = blas::asum( n, &Lambda[0], 1 )
-                    / blas::asum( n, &Lambda_ref[0], 1 );
+                // Reference Scalapack was run, check reference against test.
+                // For a subset, compare with the matching reference
+                // eigenvalues, starting at offset.
+                int64_t m = Lambda.size();
+                int64_t offset = 0;
+                int64_t m_ref = n;
+                if (range == slate::Range::Index) {
+                    offset = il - 1;
+                    m_ref = iu - il + 1;
+                }
+                else if (range == slate::Range::Value) {
+                    while (offset < n && Lambda_ref[ offset ] <= vl)
+                        ++offset;
+                    m_ref = 0;
+                    while (offset + m_ref < n
+                           && Lambda_ref[ offset + m_ref ] <= vu)
+                        ++m_ref;
+                }
+                if (m != m_ref) {
+                    params.okay() = false;
+                    params.msg() = "found " + std::to_string( m )
+                                 + " eigenvalues, expected "
+                                 + std::to_string( m_ref );
+                }
+                else if (m > 0) {
+                    // Perform a local operation to get differences
+                    // Lambda = Lambda - Lambda_ref
+                    blas::axpy( m, -1.0, &Lambda_ref[ offset ], 1, &Lambda[0], 1 );
+
+                    // Relative forward error:
+                    // || Lambda_ref - Lambda || / || Lambda_ref ||.
+                    params.error() = blas::asum( m, &Lambda[0], 1 )
+                        / blas::asum( m, &Lambda_ref[ offset ], 1 );
+                }
 
                 params.okay() = params.okay() && (params.error() <= tol);
             }
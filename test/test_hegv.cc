@@ -96,10 +96,6 @@ void test_hegv_work(Params& params, bool run)
         params.msg() = "skipping: Uplo::Upper isn't supported.";
         return;
     }
-    if (p != q) {
-        params.msg() = "skipping: requires square process grid (p == q).";
-        return;
-    }
 
     // Figure out local size.
     // matrix A (local input/local output), n-by-n, Hermitian
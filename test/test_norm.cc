@@ -586,6 +586,39 @@ void test_norm_work( Params& params, bool run )
                     error /= sqrt( m*n );
                 }
 
+                // Check fused norms, computing all norms in one pass,
+                // against ScaLAPACK, since norm uses the same engine.
+                if constexpr (std::is_same< matrix_type, Matrix<scalar_t> >::value) {
+                    std::vector<Norm> all_norms = {
+                        Norm::Max, Norm::One, Norm::Inf, Norm::Fro };
+                    real_t all_values[ 4 ];
+                    slate::norms( all_norms, A, all_values, opts );
+                    for (int k = 0; k < 4; ++k) {
+                        Norm op_norm_k = all_norms[ k ];
+                        if (trans != slate::Op::NoTrans) {
+                            if (op_norm_k == Norm::One)
+                                op_norm_k = Norm::Inf;
+                            else if (op_norm_k == Norm::Inf)
+                                op_norm_k = Norm::One;
+                        }
+                        real_t ref_k = scalapack_norm_dispatch(
+                            op_norm_k, uplo, diag, m, n, A,
+                            &Aref_data[0], Aref_desc, &work[0] );
+                        real_t error_k = std::abs( all_values[ k ] - ref_k )
+                                       / ref_k;
+                        if (op_norm_k == Norm::One) {
+                            error_k /= sqrt( m );
+                        }
+                        else if (op_norm_k == Norm::Inf) {
+                            error_k /= sqrt( n );
+                        }
+                        else if (op_norm_k == Norm::Fro) {
+                            error_k /= sqrt( m*n );
+                        }
+                        error = std::max( error, error_k );
+                    }
+                }
+
                 if (verbose && A.mpiRank() == 0) {
                     printf( "norm %15.8e, ref %15.8e, ref - norm %5.2f, error %9.2e\n",
                             A_norm, A_norm_ref, A_norm_ref - A_norm, error );
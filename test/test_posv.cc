@@ -114,11 +114,15 @@ void test_posv_work(Params& params, bool run)
 
     int64_t itermax = 0;
     bool fallback = true;
+    slate::FactorPrecision factor = slate::FactorPrecision::Single;
     if (is_iterative) {
         params.iters();
         fallback = params.fallback() == 'y';
         itermax = params.itermax();
     }
+    if (is_iterative) {
+        factor = slate::FactorPrecision( params.factor() );
+    }
 
     if (! run) {
         params.matrix.kind.set_default( "rand_dominant" );
@@ -138,6 +142,7 @@ void test_posv_work(Params& params, bool run)
         {slate::Option::MethodHemm, method_hemm},
         {slate::Option::MaxIterations, itermax},
         {slate::Option::UseFallbackSolver, fallback},
+        {slate::Option::FactorPrecision, factor},
     };
 
     if ((params.routine == "posv_mixed" || params.routine == "posv_mixed_gmres")
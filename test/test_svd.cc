@@ -48,6 +48,7 @@ void test_svd_work( Params& params, bool run )
     int timer_level = params.timer_level();
     slate::Origin origin = params.origin();
     slate::Target target = params.target();
+    slate::MethodSVD method_svd = params.method_svd();
     params.matrix.mark();
 
     mark_params_for_test_Matrix( params );
@@ -109,7 +110,8 @@ void test_svd_work( Params& params, bool run )
         {slate::Option::Lookahead, lookahead},
         {slate::Option::Target, target},
         {slate::Option::MaxPanelThreads, panel_threads},
-        {slate::Option::InnerBlocking, ib}
+        {slate::Option::InnerBlocking, ib},
+        {slate::Option::MethodSVD, method_svd},
     };
 
     bool wantu  = (jobu  == Job::Vec
@@ -95,10 +95,28 @@ void test_tb2bd_work(Params& params, bool run)
     auto Afull = slate::Matrix<scalar_t>::fromLAPACK(
         n, n, &Afull_data[0], lda, nb, p, q, MPI_COMM_WORLD);
 
-    // Copy band of Afull, currently to rank 0.
+    // Copy band of Afull. As in svd, distribute block columns in
+    // contiguous ranges, so tb2bd pipelines bulge chasing across ranks.
+    int mpi_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    int64_t nt = Afull.nt();
+    std::vector<int> col_rank( nt );
+    for (int64_t j = 0; j < nt; ++j) {
+        double x = (j + 0.5) / nt;
+        col_rank[ j ] = std::min( int( mpi_size * x * x ), mpi_size - 1 );
+    }
+    std::function<int64_t (int64_t j)>
+        tileNb = slate::func::uniform_blocksize( n, nb );
+    std::function<int (slate::func::ij_tuple ij)>
+        tileRank = [col_rank]( slate::func::ij_tuple ij ) {
+            return col_rank[ std::max( std::get<0>( ij ), std::get<1>( ij ) ) ];
+        };
+    std::function<int (slate::func::ij_tuple ij)>
+        tileDevice = []( slate::func::ij_tuple ij ) { return slate::HostNum; };
+
     auto Aband = slate::TriangularBandMatrix<scalar_t>(
-        slate::Uplo::Upper, slate::Diag::NonUnit, n, ku, nb,
-        1, 1, MPI_COMM_WORLD);
+        slate::Uplo::Upper, slate::Diag::NonUnit, n, ku, tileNb,
+        tileRank, tileDevice, MPI_COMM_WORLD);
     Aband.insertLocalTiles();
     Aband.ge2tbGather( Afull );
 
@@ -106,35 +124,33 @@ void test_tb2bd_work(Params& params, bool run)
         print_matrix("Aband", Aband, params);
     }
 
-    slate::Matrix<scalar_t> U, U1d, VT, V1d;
-    // Create U and U1d. Set U to Identity.
+    slate::Matrix<scalar_t> U, VT;
+    // Create U. Set U to Identity.
     if (wantu) {
         U = slate::Matrix<scalar_t>(n, n, nb, p, q, MPI_COMM_WORLD);
         U.insertLocalTiles(origin_target);
         set(zero, one, U);
-        U1d = slate::Matrix<scalar_t>(U.m(), U.n(), U.tileNb(0), 1, p*q, MPI_COMM_WORLD);
-        U1d.insertLocalTiles(origin_target);
     }
 
-    // Create VT and V1d. Set VT to Identity.
+    // Create VT. Set VT to Identity.
     if (wantvt) {
         VT = slate::Matrix<scalar_t>(n, n, nb, p, q, MPI_COMM_WORLD);
         VT.insertLocalTiles(origin_target);
         set(zero, one, VT);
-        // 1-d V matrix
-        V1d = slate::Matrix<scalar_t>(VT.m(), VT.n(), VT.tileNb(0), 1, p*q, MPI_COMM_WORLD);
-        V1d.insertLocalTiles(origin_target);
     }
 
     // Singular values.
     std::vector<real_t> Sigma_ref(n);
 
     // Create U2 and V2 needed for tb2bd.
+    // Here, U2 and V2 are on rank 0, so tb2bd sends vectors computed
+    // on other ranks.
     int64_t vm = 2*nb;
-    int64_t nt = Afull.nt();
     int64_t vn = nt*(nt + 1)/2*nb;
     slate::Matrix<scalar_t> V2(vm, vn, vm, nb, 1, 1, MPI_COMM_WORLD);
     slate::Matrix<scalar_t> U2(vm, vn, vm, nb, 1, 1, MPI_COMM_WORLD);
+    V2.insertLocalTiles();
+    U2.insertLocalTiles();
 
     if (check && mpi_rank == 0) {
         //==================================================
@@ -155,13 +171,8 @@ void test_tb2bd_work(Params& params, bool run)
 
     //==================================================
     // Run SLATE test.
-    // Currently runs only on rank 0.
     //==================================================
-    if (mpi_rank == 0) {
-        V2.insertLocalTiles();
-        U2.insertLocalTiles();
-        slate::tb2bd(Aband, U2, V2);
-    }
+    slate::tb2bd(Aband, U2, V2);
 
     time = barrier_get_wtime(MPI_COMM_WORLD) - time;
     params.time() = time;
@@ -169,17 +180,13 @@ void test_tb2bd_work(Params& params, bool run)
     if (trace) slate::trace::Trace::finish();
 
     //==================================================
-    // Back transform U and VT of the band matrix..
+    // Back transform U and VT of the band matrix.
     //==================================================
     if (wantu) {
-        slate::redistribute(U, U1d, opts);
-        slate::unmtr_hb2st(slate::Side::Left, slate::Op::NoTrans, U2, U1d, opts);
-        slate::redistribute(U1d, U, opts);
+        slate::unmbr_tb2bd(slate::Side::Left, slate::Op::NoTrans, U2, U, opts);
     }
     if (wantvt) {
-        slate::redistribute(VT, V1d, opts);
-        slate::unmtr_hb2st(slate::Side::Left, slate::Op::NoTrans, V2, V1d, opts);
-        slate::redistribute(V1d, VT, opts);
+        slate::unmbr_tb2bd(slate::Side::Right, slate::Op::ConjTrans, V2, VT, opts);
     }
 
     if (check) {
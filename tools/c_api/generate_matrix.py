@@ -306,7 +306,7 @@ for matrix_type in matrix_types:
                     else:
                         contents0 += '    slate::Tile<' +  data_type[2] + '> T = A_->at(i, j);\n'
                         contents0 += '    slate_Tile' +  data_type[1] + ' T_;\n'
-                        contents0 += '    std::memcpy(&T_, &T, sizeof(slate::Tile<' +  data_type[2] + '>));\n'
+                        contents0 += '    std::memcpy(&T_, &T, sizeof(T_));\n'
                         contents0 += '    return(T_);\n'
                         # contents0 += '    slate::Tile<' +  data_type[2] + '> T = A_->at(i, j);\n'
                         # contents0 += '    return(*reinterpret_cast<slate_Tile' +  data_type[1] + '*>(&T));\n'
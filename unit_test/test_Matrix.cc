@@ -3,6 +3,7 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
+#include "slate/slate.hh"
 #include "slate/Matrix.hh"
 #include "slate/internal/util.hh"
 
@@ -1014,6 +1015,130 @@ void test_Matrix_tileErase()
     test_assert_throw_std( T = A( i, j ) );
 }
 
+//------------------------------------------------------------------------------
+/// Tests tileExists after insert and erase, and measures the cost of tile
+/// lookups compared to lookups in a std::map with the same keys, which is
+/// what MatrixStorage used before it had a dense tile index.
+void test_Matrix_tileLookup()
+{
+    slate::Matrix<double> A(m, n, mb, nb, p, q, mpi_comm);
+    A.insertLocalTiles();
+
+    using ij_tuple = std::tuple<int64_t, int64_t>;
+    std::map< ij_tuple, std::shared_ptr<int> > map;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            test_assert( A.tileExists( i, j ) == A.tileIsLocal( i, j ) );
+            if (A.tileIsLocal( i, j ))
+                map[ { i, j } ] = std::make_shared<int>( 0 );
+        }
+    }
+
+    // Erased tiles no longer exist; re-inserted tiles do.
+    int64_t i0 = rand() % A.mt();
+    int64_t j0 = rand() % A.nt();
+    if (A.tileIsLocal( i0, j0 )) {
+        A.tileErase( i0, j0, HostNum );
+        test_assert( ! A.tileExists( i0, j0 ) );
+        A.tileInsert( i0, j0, HostNum );
+        test_assert( A.tileExists( i0, j0 ) );
+    }
+
+    const int repeat = 100;
+    int64_t cnt = 0;
+    double time = omp_get_wtime();
+    for (int r = 0; r < repeat; ++r)
+        for (int64_t j = 0; j < A.nt(); ++j)
+            for (int64_t i = 0; i < A.mt(); ++i)
+                cnt += A.tileExists( i, j );
+    double time_index = omp_get_wtime() - time;
+
+    int64_t cnt_map = 0;
+    time = omp_get_wtime();
+    for (int r = 0; r < repeat; ++r)
+        for (int64_t j = 0; j < A.nt(); ++j)
+            for (int64_t i = 0; i < A.mt(); ++i)
+                cnt_map += map.find( { i, j } ) != map.end();
+    double time_map = omp_get_wtime() - time;
+
+    test_assert( cnt == cnt_map );
+
+    if (verbose) {
+        double lookups = double( repeat ) * A.mt() * A.nt();
+        printf( "\n    tileExists %.2f ns/lookup, std::map %.2f ns/lookup\n",
+                time_index / lookups * 1e9, time_map / lookups * 1e9 );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Tests out-of-core mode: with a host memory budget of a few tiles,
+/// local tiles are evicted to disk and read back intact on access.
+void test_Matrix_hostMemoryBudget()
+{
+    slate::Matrix<double> A(m, n, mb, nb, p, q, mpi_comm);
+    A.insertLocalTiles();
+
+    int64_t budget = 3 * sizeof(double) * mb * nb;
+    A.setHostMemoryBudget( budget );
+    test_assert( A.hostMemoryBudget() == budget );
+
+    // Tiles set here are evicted while setting later ones.
+    int64_t num_local = 0;
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                for (int64_t jj = 0; jj < T.nb(); ++jj)
+                    for (int64_t ii = 0; ii < T.mb(); ++ii)
+                        T.at( ii, jj ) = i*1000 + j + ii + jj*1e-3;
+                ++num_local;
+            }
+        }
+    }
+    // No Tile objects are in use, so everything beyond budget is evicted,
+    // regardless of the number of threads.
+    test_assert( A.hostResidentBytes() <= budget );
+
+    // A Tile object in use pins its tile, while all others cycle through.
+    if (num_local > 3) {
+        int64_t i0 = -1, j0 = -1;
+        for (int64_t j = 0; j < A.nt() && i0 < 0; ++j)
+            for (int64_t i = 0; i < A.mt() && i0 < 0; ++i)
+                if (A.tileIsLocal( i, j )) {
+                    i0 = i;
+                    j0 = j;
+                }
+        auto T0 = A( i0, j0 );
+        auto T0_copy = T0;
+        for (int64_t j = 0; j < A.nt(); ++j)
+            for (int64_t i = 0; i < A.mt(); ++i)
+                if (A.tileIsLocal( i, j ))
+                    test_assert( A( i, j ).at( 0, 0 ) == i*1000 + j );
+        test_assert( T0_copy.data() == A( i0, j0 ).data() );
+        for (int64_t jj = 0; jj < T0.nb(); ++jj)
+            for (int64_t ii = 0; ii < T0.mb(); ++ii)
+                test_assert( T0_copy.at( ii, jj )
+                             == i0*1000 + j0 + ii + jj*1e-3 );
+    }
+
+    for (int budget_iter = 0; budget_iter < 2; ++budget_iter) {
+        for (int64_t j = 0; j < A.nt(); ++j) {
+            for (int64_t i = 0; i < A.mt(); ++i) {
+                if (A.tileIsLocal( i, j )) {
+                    auto T = A( i, j );
+                    for (int64_t jj = 0; jj < T.nb(); ++jj)
+                        for (int64_t ii = 0; ii < T.mb(); ++ii)
+                            test_assert( T.at( ii, jj )
+                                         == i*1000 + j + ii + jj*1e-3 );
+                }
+            }
+        }
+        // Second pass: disabling out-of-core reads all tiles back.
+        A.setHostMemoryBudget( 0 );
+    }
+    test_assert( A.hostMemoryBudget() == 0 );
+}
+
 //------------------------------------------------------------------------------
 /// Tests Matrix(), mt, nt, op, insertLocalTiles on host.
 void test_Matrix_insertLocalTiles()
@@ -1551,6 +1676,66 @@ static void test_Matrix_slice()
     }
 }
 
+//------------------------------------------------------------------------------
+/// Tests out-of-core mode with tiles whose host instance is Invalid, as when
+/// the valid instance is on a GPU: they are evicted without being written,
+/// then loaded without being read.
+static void test_Matrix_hostMemoryBudget_invalid()
+{
+    using namespace test;  // for globals mpi_rank, etc.
+
+    slate::Matrix<double> A(m, n, mb, nb, p, q, mpi_comm);
+    A.insertLocalTiles();
+
+    // Mark host instances Invalid; there is no other way without GPUs.
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto& tile_node = A.storage_->at( A.globalIndex( i, j ) );
+                auto T = tile_node[ HostNum ];
+                auto T_invalid = new Tile<double>(
+                    T->mb(), T->nb(), T->data(), T->stride(), HostNum,
+                    TileKind::SlateOwned, T->layout() );
+                tile_node.eraseOn( HostNum );
+                tile_node.insertOn( HostNum, T_invalid, MOSI::Invalid );
+            }
+        }
+    }
+
+    // Evicts all but one tile, none of them written.
+    int64_t budget = sizeof(double) * mb * nb;
+    A.setHostMemoryBudget( budget );
+
+    // Loading each tile must not read beyond the end of the backing file.
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                test_assert( A.tileState( i, j ) == MOSI::Invalid );
+                A.tileModified( i, j );
+                for (int64_t jj = 0; jj < T.nb(); ++jj)
+                    for (int64_t ii = 0; ii < T.mb(); ++ii)
+                        T.at( ii, jj ) = i*1000 + j + ii + jj*1e-3;
+            }
+        }
+    }
+    test_assert( A.hostResidentBytes() <= budget );
+
+    // Now Modified, tiles are written when evicted and read back intact.
+    for (int64_t j = 0; j < A.nt(); ++j) {
+        for (int64_t i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal( i, j )) {
+                auto T = A( i, j );
+                for (int64_t jj = 0; jj < T.nb(); ++jj)
+                    for (int64_t ii = 0; ii < T.mb(); ++ii)
+                        test_assert( T.at( ii, jj )
+                                     == i*1000 + j + ii + jj*1e-3 );
+            }
+        }
+    }
+    A.setHostMemoryBudget( 0 );
+}
+
 }; // class Debug
 }  // namespace slate
 
@@ -1635,6 +1820,389 @@ void test_tileSend_tileRecv()
     }
 }
 
+//------------------------------------------------------------------------------
+/// Broadcasts each block column across its block rows with listBcast,
+/// sending whole tiles, packed tiles, and segmented tiles,
+/// and checks the received tiles.
+void test_listBcast()
+{
+    int lda = roundup(m, nb);
+    std::vector<double> Ad( lda*n );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        m, n, Ad.data(), lda, nb, p, q, mpi_comm );
+
+    for (int j = 0; j < A.nt(); ++j) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal(i, j)) {
+                auto T = A(i, j);
+                for (int jj = 0; jj < T.nb(); ++jj)
+                    for (int ii = 0; ii < T.mb(); ++ii)
+                        T.at(ii, jj) = i + j/1000. + ii*1e-6 + jj*1e-9;
+            }
+        }
+    }
+
+    // { pack size, segment size } in bytes; 0 disables each.
+    // Segments are 3 columns, with a shorter last segment.
+    // The last config also uses node-aware broadcast.
+    std::vector< std::pair<int64_t, int64_t> > configs = {
+        { 0, 0 }, { 8*nb*nb, 0 }, { 1024*1024, 0 }, { 0, 8*nb*3 }, { 0, 0 },
+    };
+    for (auto& config : configs) {
+        A.setBcastNodeAware( &config == &configs.back() );
+        A.setBcastPackSize( config.first );
+        A.setBcastSegmentSize( config.second );
+        test_assert( A.bcastPackSize() == config.first );
+        test_assert( A.bcastSegmentSize() == config.second );
+
+        for (int k = 0; k < A.nt(); ++k) {
+            using BcastList = typename slate::Matrix<double>::BcastList;
+            BcastList bcast_list;
+            for (int i = 0; i < A.mt(); ++i) {
+                bcast_list.push_back( {i, k, {A.sub(i, i, 0, A.nt()-1)}} );
+            }
+            A.listBcast( bcast_list, slate::Layout::ColMajor, k );
+
+            for (int i = 0; i < A.mt(); ++i) {
+                // Every rank in block row i has tile A(i, k).
+                bool in_row = false;
+                for (int j = 0; j < A.nt(); ++j)
+                    in_row |= A.tileIsLocal(i, j);
+                test_assert( A.tileExists(i, k) == in_row );
+                if (in_row) {
+                    auto T = A(i, k);
+                    for (int jj = 0; jj < T.nb(); ++jj)
+                        for (int ii = 0; ii < T.mb(); ++ii)
+                            test_assert( T(ii, jj)
+                                         == i + k/1000. + ii*1e-6 + jj*1e-9 );
+                }
+            }
+            A.releaseRemoteWorkspace();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Broadcasts all tiles of a block row on a 1-by-mpi_size grid across the row
+/// in one listBcast, and checks the received tiles. Tiles have different
+/// roots, hence different trees, and alternate between the ends of the row,
+/// so ranks receive them out of list order. Each rank must still forward
+/// them in the order its children posted receives.
+void test_listBcast_row()
+{
+    int nt = 4*mpi_size;
+    std::vector<double> Ad( nb*nb*nt );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        nb, nb*nt, Ad.data(), nb, nb, 1, mpi_size, mpi_comm );
+
+    for (int j = 0; j < A.nt(); ++j) {
+        if (A.tileIsLocal(0, j)) {
+            auto T = A(0, j);
+            for (int jj = 0; jj < T.nb(); ++jj)
+                for (int ii = 0; ii < T.mb(); ++ii)
+                    T.at(ii, jj) = j + ii*1e-3 + jj*1e-6;
+        }
+    }
+
+    // With packing, each rank is the root of one packed message
+    // and receives the others.
+    for (int64_t pack_size : { 0, 8*nb*nb }) {
+        A.setBcastPackSize( pack_size );
+
+        using BcastList = typename slate::Matrix<double>::BcastList;
+        BcastList bcast_list;
+        for (int j = 0; j < nt; ++j) {
+            int k = (j % 2 == 0 ? j/2 : nt-1 - j/2);
+            bcast_list.push_back( {0, k, {A.sub(0, 0, 0, nt-1)}} );
+        }
+        A.listBcast( bcast_list, slate::Layout::ColMajor, 0 );
+
+        for (int j = 0; j < A.nt(); ++j) {
+            auto T = A(0, j);
+            for (int jj = 0; jj < T.nb(); ++jj)
+                for (int ii = 0; ii < T.mb(); ++ii)
+                    test_assert( T(ii, jj) == j + ii*1e-3 + jj*1e-6 );
+        }
+        A.releaseRemoteWorkspace();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Broadcasts each block column along block rows with listBcast through the
+/// node-shared window, and checks the received tiles.
+/// With 2 tiles per rank in the window, some tiles are sent as usual.
+void test_listBcast_shared()
+{
+    int lda = roundup(m, nb);
+    std::vector<double> Ad( lda*n );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        m, n, Ad.data(), lda, nb, p, q, mpi_comm );
+
+    for (int j = 0; j < A.nt(); ++j) {
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal(i, j)) {
+                auto T = A(i, j);
+                for (int jj = 0; jj < T.nb(); ++jj)
+                    for (int ii = 0; ii < T.mb(); ++ii)
+                        T.at(ii, jj) = i + j/1000. + ii*1e-6 + jj*1e-9;
+            }
+        }
+    }
+
+    test_assert( A.bcastSharedMemory() == 0 );
+    A.setBcastSharedMemory( 2 );
+    test_assert( A.bcastSharedMemory() == 2 );
+
+    for (int k = 0; k < A.nt(); ++k) {
+        using BcastList = typename slate::Matrix<double>::BcastList;
+        BcastList bcast_list;
+        for (int i = 0; i < A.mt(); ++i) {
+            bcast_list.push_back( {i, k, {A.sub(i, i, 0, A.nt()-1)}} );
+        }
+        // The second time, tiles are already here.
+        A.listBcast( bcast_list, slate::Layout::ColMajor, k );
+        A.listBcast( bcast_list, slate::Layout::ColMajor, k );
+
+        for (int i = 0; i < A.mt(); ++i) {
+            bool in_row = false;
+            for (int j = 0; j < A.nt(); ++j)
+                in_row |= A.tileIsLocal(i, j);
+            test_assert( A.tileExists(i, k) == in_row );
+            if (in_row) {
+                auto T = A(i, k);
+                for (int jj = 0; jj < T.nb(); ++jj)
+                    for (int ii = 0; ii < T.mb(); ++ii)
+                        test_assert( T(ii, jj)
+                                     == i + k/1000. + ii*1e-6 + jj*1e-9 );
+            }
+        }
+        // Releasing the tiles frees their slots for the next column.
+        A.releaseRemoteWorkspace();
+    }
+
+    A.setBcastSharedMemory( 0 );
+    test_assert( A.bcastSharedMemory() == 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Broadcasts all tiles of a block row on a 1-by-mpi_size grid across the row
+/// in one listBcast through the node-shared window with one slot per rank,
+/// and checks the received tiles. Slots are exhausted, so each rank gets its
+/// owner's first tile through the window and the rest as messages, which
+/// interleave with slot indices and messages from the other owners.
+void test_listBcast_shared_full()
+{
+    int nt = 3*mpi_size;
+    std::vector<double> Ad( nb*nb*nt );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        nb, nb*nt, Ad.data(), nb, nb, 1, mpi_size, mpi_comm );
+
+    for (int j = 0; j < A.nt(); ++j) {
+        if (A.tileIsLocal(0, j)) {
+            auto T = A(0, j);
+            for (int jj = 0; jj < T.nb(); ++jj)
+                for (int ii = 0; ii < T.mb(); ++ii)
+                    T.at(ii, jj) = j + ii*1e-3 + jj*1e-6;
+        }
+    }
+
+    A.setBcastSharedMemory( 1 );
+
+    // Twice, to check releasing the tiles frees their slots.
+    for (int iter = 0; iter < 2; ++iter) {
+        using BcastList = typename slate::Matrix<double>::BcastList;
+        BcastList bcast_list;
+        for (int j = 0; j < nt; ++j) {
+            int k = (j % 2 == 0 ? j/2 : nt-1 - j/2);
+            bcast_list.push_back( {0, k, {A.sub(0, 0, 0, nt-1)}} );
+        }
+        A.listBcast( bcast_list, slate::Layout::ColMajor, 0 );
+
+        for (int j = 0; j < A.nt(); ++j) {
+            auto T = A(0, j);
+            for (int jj = 0; jj < T.nb(); ++jj)
+                for (int ii = 0; ii < T.mb(); ++ii)
+                    test_assert( T(ii, jj) == j + ii*1e-3 + jj*1e-6 );
+        }
+        A.releaseRemoteWorkspace();
+    }
+
+    A.setBcastSharedMemory( 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Sums each block column across its block rows into the tile owner
+/// with listReduce, and checks the sums.
+void test_listReduce()
+{
+    int lda = roundup(m, nb);
+    std::vector<double> Ad( lda*n );
+
+    auto A = slate::Matrix<double>::fromLAPACK(
+        m, n, Ad.data(), lda, nb, p, q, mpi_comm );
+
+    for (int k = 0; k < A.nt(); ++k) {
+        using ReduceList = typename slate::Matrix<double>::ReduceList;
+        ReduceList reduce_list;
+        std::vector<double> sums( A.mt() );
+        for (int i = 0; i < A.mt(); ++i) {
+            // Ranks in block row i contribute rank + 1 to every element.
+            std::set<int> reduce_set = { A.tileRank(i, k) };
+            A.sub(i, i, 0, A.nt()-1).getRanks( &reduce_set );
+            for (int rank : reduce_set)
+                sums[ i ] += rank + 1;
+            if (reduce_set.count( mpi_rank )) {
+                if (! A.tileIsLocal(i, k))
+                    A.tileInsert(i, k);
+                A(i, k).set( mpi_rank + 1 );
+                A.tileModified(i, k);
+            }
+            reduce_list.push_back(
+                {i, k, A.sub(i, i, k, k), {A.sub(i, i, 0, A.nt()-1)}} );
+        }
+        A.listReduce( reduce_list, slate::Layout::ColMajor, k );
+
+        for (int i = 0; i < A.mt(); ++i) {
+            if (A.tileIsLocal(i, k)) {
+                auto T = A(i, k);
+                for (int jj = 0; jj < T.nb(); ++jj)
+                    for (int ii = 0; ii < T.mb(); ++ii)
+                        test_assert( T(ii, jj) == sums[ i ] );
+            }
+            else {
+                // Non-root contributors erase their workspace tile.
+                test_assert( ! A.tileExists(i, k) );
+            }
+        }
+    }
+
+    if (mpi_size <= 1)
+        return;
+
+    // Reduce tile (0, 0) twice in one list: first to another rank, then
+    // back to its owner, which must not accumulate into the tile while
+    // its first send is in flight. The owner gets 2*own + other.
+    int owner = A.tileRank(0, 0);
+    int64_t io = -1, jo = -1;
+    for (int64_t j = 0; j < A.nt() && io < 0; ++j) {
+        for (int64_t i = 0; i < A.mt() && io < 0; ++i) {
+            if (A.tileRank(i, j) != owner) {
+                io = i;
+                jo = j;
+            }
+        }
+    }
+    if (io < 0)
+        return;
+    int other = A.tileRank(io, jo);
+
+    if (mpi_rank == owner || mpi_rank == other) {
+        if (! A.tileIsLocal(0, 0))
+            A.tileInsert(0, 0);
+        A(0, 0).set( mpi_rank + 1 );
+        A.tileModified(0, 0);
+    }
+    using ReduceList = typename slate::Matrix<double>::ReduceList;
+    ReduceList reduce_list = {
+        {0, 0, A.sub(io, io, jo, jo), {A.sub(0, 0, 0, 0)}},
+        {0, 0, A.sub(0, 0, 0, 0), {A.sub(io, io, jo, jo)}},
+    };
+    A.listReduce( reduce_list, slate::Layout::ColMajor, A.nt() );
+
+    if (mpi_rank == owner) {
+        auto T = A(0, 0);
+        for (int jj = 0; jj < T.nb(); ++jj)
+            for (int ii = 0; ii < T.mb(); ++ii)
+                test_assert( T(ii, jj) == 2*(owner + 1) + (other + 1) );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Redistributes between matrices with different tile sizes, grids, and
+/// transpose ops, and checks B = A, with entries set from global indices.
+void test_redistribute()
+{
+    using scalar_t = std::complex<double>;
+    using blas::conj;
+
+    // Entry (i, j) of the m-by-n matrix being redistributed.
+    auto entry = []( int64_t i, int64_t j ) {
+        return scalar_t( i + 1000*j, j - i );
+    };
+
+    // Calls f( Tile, ii, jj, i, j ) on each local element of A, where
+    // (i, j) are global indices; A must not be transposed.
+    auto for_each = []( slate::Matrix<scalar_t>& A, auto&& f ) {
+        for (int64_t tj = 0; tj < A.nt(); ++tj) {
+            for (int64_t ti = 0; ti < A.mt(); ++ti) {
+                if (A.tileIsLocal( ti, tj )) {
+                    auto T = A( ti, tj );
+                    for (int64_t jj = 0; jj < T.nb(); ++jj)
+                        for (int64_t ii = 0; ii < T.mb(); ++ii)
+                            f( T, ii, jj, ti*A.tileMb( 0 ) + ii,
+                               tj*A.tileNb( 0 ) + jj );
+                }
+            }
+        }
+    };
+
+    // Source and destination ops, and the grids of each.
+    int mb2 = mb + 3, nb2 = std::max( nb - 2, 1 );
+    for (auto opA : { slate::Op::NoTrans, slate::Op::Trans,
+                      slate::Op::ConjTrans }) {
+        for (auto opB : { slate::Op::NoTrans, slate::Op::Trans,
+                          slate::Op::ConjTrans }) {
+            // Underlying storage of op(A) and op(B), each m-by-n.
+            bool transA = opA != slate::Op::NoTrans;
+            bool transB = opB != slate::Op::NoTrans;
+            slate::Matrix<scalar_t> A0(
+                transA ? n : m, transA ? m : n, mb, nb,
+                slate::GridOrder::Col, p, q, mpi_comm );
+            slate::Matrix<scalar_t> B0(
+                transB ? n : m, transB ? m : n, mb2, nb2,
+                slate::GridOrder::Row, q, p, mpi_comm );
+            A0.insertLocalTiles();
+            B0.insertLocalTiles();
+
+            // Element (i, j) of A0 is op(A)(j, i) if A is transposed.
+            for_each( A0, [&]( auto& T, int64_t ii, int64_t jj,
+                               int64_t i, int64_t j ) {
+                scalar_t a = transA ? entry( j, i ) : entry( i, j );
+                T.at( ii, jj ) = opA == slate::Op::ConjTrans ? conj( a ) : a;
+            } );
+            for_each( B0, [&]( auto& T, int64_t ii, int64_t jj,
+                               int64_t i, int64_t j ) {
+                T.at( ii, jj ) = 0;
+            } );
+
+            auto A = A0;
+            auto B = B0;
+            if (opA == slate::Op::Trans)
+                A = transpose( A0 );
+            else if (opA == slate::Op::ConjTrans)
+                A = conj_transpose( A0 );
+            if (opB == slate::Op::Trans)
+                B = transpose( B0 );
+            else if (opB == slate::Op::ConjTrans)
+                B = conj_transpose( B0 );
+
+            slate::redistribute( A, B );
+
+            for_each( B0, [&]( auto& T, int64_t ii, int64_t jj,
+                               int64_t i, int64_t j ) {
+                scalar_t b = transB ? entry( j, i ) : entry( i, j );
+                if (opB == slate::Op::ConjTrans)
+                    b = conj( b );
+                test_assert( T.at( ii, jj ) == b );
+            } );
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 void test_releaseRemoteWorkspace()
 {
@@ -2130,6 +2698,10 @@ void run_tests()
     run_test(test_Matrix_tileInsert_new,       "Matrix::tileInsert(i, j, dev) ",           mpi_comm);
     run_test(test_Matrix_tileInsert_data,      "Matrix::tileInsert(i, j, dev, data, lda)", mpi_comm);
     run_test(test_Matrix_tileErase,            "Matrix::tileErase",                        mpi_comm);
+    run_test(test_Matrix_tileLookup,           "Matrix::tileExists lookup",                mpi_comm);
+    run_test(test_Matrix_hostMemoryBudget,     "Matrix::setHostMemoryBudget",              mpi_comm);
+    run_test(slate::Debug::test_Matrix_hostMemoryBudget_invalid,
+                                               "Matrix::setHostMemoryBudget(Invalid)",     mpi_comm);
     run_test(test_Matrix_tileReduceFromSet,    "Matrix::tileReduceFromSet(i, j, set,...)", mpi_comm);
     run_test(test_Matrix_insertLocalTiles,     "Matrix::insertLocalTiles()",               mpi_comm);
     run_test(test_Matrix_insertLocalTiles_dev, "Matrix::insertLocalTiles(on_devices)",     mpi_comm);
@@ -2147,6 +2719,12 @@ void run_tests()
     if (mpi_rank == 0)
         printf("\nCommunication\n");
     run_test(test_tileSend_tileRecv, "tileSend, tileRecv", mpi_comm);
+    run_test(test_listBcast, "listBcast", mpi_comm);
+    run_test(test_listBcast_row, "listBcast_row", mpi_comm);
+    run_test(test_listBcast_shared, "listBcast_shared", mpi_comm);
+    run_test(test_listBcast_shared_full, "listBcast_shared_full", mpi_comm);
+    run_test(test_listReduce, "listReduce", mpi_comm);
+    run_test(test_redistribute, "redistribute", mpi_comm);
     run_test(test_releaseRemoteWorkspace, "releaseRemoteWorkspace", mpi_comm);
 }
 
@@ -16,6 +16,7 @@ namespace test {
 //------------------------------------------------------------------------------
 // global variables
 int nb;
+int verbose = 0;
 
 //------------------------------------------------------------------------------
 /// Tests Memory(size) constructor. Doesn't allocate memory.
@@ -40,11 +41,8 @@ void test_addHostBlocks()
 
     const int cnt = 5;
     mem.addHostBlocks(cnt);
-    // Memory class no longer reserves CPU blocks, it allocates on-the-fly.
-    //test_assert( int( mem.available( HostNum ) ) == cnt );
-    //test_assert( int( mem.capacity(  HostNum ) ) == cnt );
-    test_assert( int( mem.available( HostNum ) ) == 0 );
-    test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+    test_assert( int( mem.available( HostNum ) ) == cnt );
+    test_assert( int( mem.capacity(  HostNum ) ) == cnt );
 
     // Devices still 0.
     for (int dev = 0; dev < mem.num_devices_; ++dev) {
@@ -108,11 +106,9 @@ void test_alloc_host()
     for (int i = 0; i < 2*cnt; ++i) {
         hx[i] = (double*) mem.alloc( HostNum, sizeof(double) * nb * nb, nullptr );
         test_assert(hx[i] != nullptr);
-        // Memory class no longer reserves CPU blocks, it allocates on-the-fly.
-        //test_assert( int( mem.available( HostNum ) ) == max( cnt-(i+1), 0 ) );
-        //test_assert( int( mem.capacity(  HostNum ) ) == max( cnt, i+1 ) );
-        test_assert( int( mem.available( HostNum ) ) == 0 );
-        test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+        test_assert( uintptr_t( hx[i] ) % mem.hostAlignment() == 0 );
+        test_assert( int( mem.available( HostNum ) ) == max( cnt-(i+1), 0 ) );
+        test_assert( int( mem.capacity(  HostNum ) ) == max( cnt, i+1 ) );
 
         // Touch memory to verify it is valid.
         for (int j = 0; j < nb*nb; ++j) {
@@ -125,21 +121,61 @@ void test_alloc_host()
     for (int i = 0; i < some; ++i) {
         mem.free( hx[i], HostNum );
         hx[i] = nullptr;
-        //test_assert( int( mem.available( HostNum ) ) == i+1 );
-        //test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
-        test_assert( int( mem.available( HostNum ) ) == 0 );
-        test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+        test_assert( int( mem.available( HostNum ) ) == i+1 );
+        test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
     }
 
     // Re-alloc some.
     for (int i = 0; i < some; ++i) {
         hx[i] = (double*) mem.alloc( HostNum, sizeof(double) * nb * nb, nullptr);
         test_assert(hx[i] != nullptr);
-        //test_assert( int( mem.available( HostNum ) ) == some - ( i+1 ) );
-        //test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
-        test_assert( int( mem.available( HostNum ) ) == 0 );
-        test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+        test_assert( int( mem.available( HostNum ) ) == some - ( i+1 ) );
+        test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
+    }
+
+    // Free all.
+    for (int i = 0; i < 2*cnt; ++i) {
+        mem.free( hx[i], HostNum );
     }
+    test_assert( int( mem.available( HostNum ) ) == 2*cnt );
+    test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
+}
+
+//------------------------------------------------------------------------------
+/// Tests that host blocks freed by one thread are reused by other threads,
+/// rather than allocating new blocks.
+void test_alloc_host_threaded()
+{
+    slate::Memory mem(sizeof(double) * nb * nb);
+
+    const int cnt = 4;
+    int num_threads = omp_get_max_threads();
+    mem.addHostBlocks( cnt * num_threads );
+
+    // Each round, every thread allocates, touches, and frees cnt blocks.
+    for (int round = 0; round < 10; ++round) {
+        #pragma omp parallel
+        {
+            double* hx[ cnt ];
+            for (int i = 0; i < cnt; ++i) {
+                hx[i] = (double*) mem.alloc( HostNum, sizeof(double) * nb * nb,
+                                             nullptr );
+                for (int j = 0; j < nb*nb; ++j) {
+                    hx[i][j] = j;
+                }
+            }
+            // Free only after all threads allocated, so the pool
+            // is never transiently short.
+            #pragma omp barrier
+            for (int i = 0; i < cnt; ++i) {
+                mem.free( hx[i], HostNum );
+            }
+        }
+    }
+
+    // No new blocks should have been needed.
+    test_assert( int( mem.available( HostNum ) ) == cnt * num_threads );
+    test_assert( int( mem.capacity(  HostNum ) ) == cnt * num_threads );
 }
 
 //------------------------------------------------------------------------------
@@ -215,10 +251,8 @@ void test_clearHostBlocks()
 
     const int cnt = 5;
     mem.addHostBlocks(cnt);
-    //test_assert( int( mem.available( HostNum ) ) == cnt );
-    //test_assert( int( mem.capacity(  HostNum ) ) == cnt );
-    test_assert( int( mem.available( HostNum ) ) == 0 );
-    test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+    test_assert( int( mem.available( HostNum ) ) == cnt );
+    test_assert( int( mem.capacity(  HostNum ) ) == cnt );
 
     // Allocate 2*cnt blocks.
     for (int i = 0; i < 2*cnt; ++i) {
@@ -226,8 +260,7 @@ void test_clearHostBlocks()
     }
 
     test_assert( int( mem.available( HostNum ) ) == 0 );
-    //test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
-    test_assert( int( mem.capacity(  HostNum ) ) == 0 );
+    test_assert( int( mem.capacity(  HostNum ) ) == 2*cnt );
 
     mem.clearHostBlocks();
 
@@ -281,6 +314,73 @@ void test_clearDeviceBlocks()
         delete dev_queues[dev];
 }
 
+//------------------------------------------------------------------------------
+/// Measures alloc/free throughput of host and device blocks
+/// for 1, 2, 4, ..., max threads.
+/// Each thread repeatedly allocates a few blocks, then frees them,
+/// similar to tasks fetching and releasing workspace tiles.
+/// The throughput table is printed, with more iterations, only if verbose.
+void test_alloc_throughput()
+{
+    const int cnt = 4;
+    const int iters = verbose ? 10000 : 100;
+    int max_threads = omp_get_max_threads();
+
+    // One device per slot, plus host.
+    int num_devices = slate::Memory::num_devices_;
+    std::vector< blas::Queue* > dev_queues( num_devices );
+    for (int dev = 0; dev < num_devices; ++dev)
+        dev_queues[ dev ] = new blas::Queue( dev );
+
+    if (verbose) {
+        printf( "\n%9s  %12s", "threads", "host Mop/s" );
+        for (int dev = 0; dev < num_devices; ++dev)
+            printf( "  dev %d Mop/s", dev );
+        printf( "\n" );
+    }
+
+    for (int nt = 1; nt <= max_threads; nt *= 2) {
+        if (verbose)
+            printf( "%9d", nt );
+        for (int device = HostNum; device < num_devices; ++device) {
+            slate::Memory mem( sizeof(double) * nb * nb );
+            blas::Queue* queue
+                = (device == HostNum ? nullptr : dev_queues[ device ]);
+
+            double time = omp_get_wtime();
+            #pragma omp parallel num_threads( nt )
+            {
+                void* blocks[ cnt ];
+                for (int iter = 0; iter < iters; ++iter) {
+                    for (int i = 0; i < cnt; ++i)
+                        blocks[ i ] = mem.alloc( device,
+                                                 sizeof(double) * nb * nb,
+                                                 queue );
+                    for (int i = 0; i < cnt; ++i)
+                        mem.free( blocks[ i ], device );
+                }
+            }
+            time = omp_get_wtime() - time;
+
+            // Each alloc and each free counts as one op.
+            double mops = 2. * cnt * iters * nt / time * 1e-6;
+            if (verbose)
+                printf( "  %12.2f", mops );
+
+            test_assert( mem.allocated( device ) == 0 );
+            if (device == HostNum)
+                mem.clearHostBlocks();
+            else
+                mem.clearDeviceBlocks( device, queue );
+        }
+        if (verbose)
+            printf( "\n" );
+    }
+
+    for (int dev = 0; dev < num_devices; ++dev)
+        delete dev_queues[ dev ];
+}
+
 //------------------------------------------------------------------------------
 /// Runs all tests. Called by unit test main().
 void run_tests()
@@ -289,9 +389,11 @@ void run_tests()
     run_test(test_addHostBlocks,     "addHostBlocks");
     run_test(test_addDeviceBlocks,   "addDeviceBlocks");
     run_test(test_alloc_host,        "alloc and free (alloc_host)");
+    run_test(test_alloc_host_threaded, "alloc and free (alloc_host_threaded)");
     run_test(test_alloc_device,      "alloc and free (alloc_device)");
     run_test(test_clearHostBlocks,   "clearHostBlocks");
     run_test(test_clearDeviceBlocks, "clearDeviceBlocks");
+    run_test(test_alloc_throughput,  "alloc and free throughput");
 }
 
 }  // namespace test
@@ -303,8 +405,12 @@ int main(int argc, char** argv)
 
     // global nb
     nb = 16;
-    if (argc > 1) {
-        nb = atoi(argv[1]);
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[ i ];
+        if (arg == "-v")
+            ++verbose;
+        else
+            nb = atoi( argv[ i ] );
     }
     printf("nb = %d\n", nb);
     return unit_test_main();  // which calls run_tests()
@@ -450,6 +450,115 @@ void test_gemm(slate::Target target)
     }}}
 }
 
+// -----------------------------------------------------------------------------
+// HostTask gemm on a matrix from fromScaLAPACK, whose local tiles are one
+// column-major array, is done by a few large gemm calls (gemm_contiguous).
+// Compare it with a copy of C in tiles allocated by SLATE, which is updated
+// one tile at a time. Covers partial last tiles, all op(A) and op(B),
+// splitting local C along rows (m > n) and cols (m < n) across threads,
+// and the trailing submatrix.
+template <typename scalar_t>
+void test_gemm_contiguous()
+{
+    auto msg = __func__ + ("< " + type_name<scalar_t>() + " >");
+    Test name(msg.c_str());
+
+    using real_t = blas::real_type<scalar_t>;
+    const blas::Layout layout = blas::Layout::ColMajor;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+
+    int nb = 16;
+    int k = 16;
+    int p = 1;
+    int q = 1;
+    int shapes[][2] = { { 75, 37 }, { 37, 75 } };
+
+    scalar_t alpha, beta;
+    lapack::larnv(1, iseed, 1, &alpha);
+    lapack::larnv(1, iseed, 1, &beta);
+
+    for (auto& shape : shapes) {
+    for (int ia = 0; ia < 3; ++ia) {
+    for (int ib = 0; ib < 3; ++ib) {
+    for (int i0 = 0; i0 < 2; ++i0) {
+        int m = shape[ 0 ];
+        int n = shape[ 1 ];
+
+        int ldc = m + 3;
+        std::vector<scalar_t> Cdata(ldc*n);
+        lapack::larnv(1, iseed, Cdata.size(), Cdata.data());
+        auto C = slate::Matrix<scalar_t>::fromScaLAPACK(
+            m, n, Cdata.data(), ldc, nb, nb, p, q, g_mpi_comm);
+
+        slate::Matrix<scalar_t> Cref(m, n, nb, p, q, g_mpi_comm);
+        Cref.insertLocalTiles();
+        for (int j = 0; j < C.nt(); ++j) {
+            for (int i = 0; i < C.mt(); ++i) {
+                auto Cij = C(i, j);
+                auto Rij = Cref(i, j);
+                for (int jj = 0; jj < Cij.nb(); ++jj)
+                    for (int ii = 0; ii < Cij.mb(); ++ii)
+                        Rij.at(ii, jj) = Cij(ii, jj);
+            }
+        }
+
+        // op(A) is m-by-k, op(B) is k-by-n.
+        int Am = (ia == 0 ? m : k);
+        int An = (ia == 0 ? k : m);
+        std::vector<scalar_t> Adata(Am*An);
+        lapack::larnv(1, iseed, Adata.size(), Adata.data());
+        auto A = slate::Matrix<scalar_t>::fromLAPACK(
+            Am, An, Adata.data(), Am, nb, p, q, g_mpi_comm);
+        if (ia == 1)
+            A = transpose(A);
+        else if (ia == 2)
+            A = conj_transpose( A );
+
+        int Bm = (ib == 0 ? k : n);
+        int Bn = (ib == 0 ? n : k);
+        std::vector<scalar_t> Bdata(Bm*Bn);
+        lapack::larnv(1, iseed, Bdata.size(), Bdata.data());
+        auto B = slate::Matrix<scalar_t>::fromLAPACK(
+            Bm, Bn, Bdata.data(), Bm, nb, p, q, g_mpi_comm);
+        if (ib == 1)
+            B = transpose(B);
+        else if (ib == 2)
+            B = conj_transpose( B );
+
+        test_message("gemm( opA=%c, opB=%c ), m %d, n %d, offset %d",
+                     char(A.op()), char(B.op()), m, n, i0);
+
+        // With i0 = 1, update the trailing submatrix.
+        int64_t mt = C.mt();
+        int64_t nt = C.nt();
+        #pragma omp parallel num_threads(3)
+        #pragma omp master
+        {
+            slate::internal::gemm<slate::Target::HostTask>(
+                alpha, A.sub(i0, mt-1, 0, 0), B.sub(0, 0, i0, nt-1),
+                beta,  C.sub(i0, mt-1, i0, nt-1), layout);
+            slate::internal::gemm<slate::Target::HostTask>(
+                alpha, A.sub(i0, mt-1, 0, 0), B.sub(0, 0, i0, nt-1),
+                beta,  Cref.sub(i0, mt-1, i0, nt-1), layout);
+        }
+
+        real_t eps = std::numeric_limits<real_t>::epsilon();
+        real_t tol = 3*sqrt(k)*eps;
+        for (int j = 0; j < C.nt(); ++j) {
+            for (int i = 0; i < C.mt(); ++i) {
+                auto Cij = C(i, j);
+                auto Rij = Cref(i, j);
+                for (int jj = 0; jj < Cij.nb(); ++jj) {
+                    for (int ii = 0; ii < Cij.mb(); ++ii) {
+                        real_t error = std::abs(Cij(ii, jj) - Rij(ii, jj));
+                        test_assert(error <= tol * (1 + std::abs(Rij(ii, jj))));
+                    }
+                }
+            }
+        }
+    }}}}
+}
+
 // -----------------------------------------------------------------------------
 template <typename scalar_t>
 void test_syrk(slate::Target target)
@@ -848,6 +957,8 @@ int main(int argc, char** argv)
             test_gemm<double>(targets[it]);
             test_gemm< std::complex<double> >(targets[it]);
         }
+        test_gemm_contiguous<double>();
+        test_gemm_contiguous< std::complex<double> >();
     }
     if (do_all || do_syrk) {
         for (int it = 0; it < numtargets; ++it) {
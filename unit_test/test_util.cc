@@ -30,6 +30,57 @@ void test_gpu_aware_mpi()
     test_assert( ! slate::gpu_aware_mpi() );
 }
 
+//------------------------------------------------------------------------------
+/// Checks that the node-aware broadcast pattern reaches every rank once,
+/// and crosses nodes only once per node.
+void test_nodeBcastPattern()
+{
+    // 12 ranks, 4 nodes of 3 ranks each, numbered round-robin
+    // so ranks on a node aren't adjacent.
+    int size = 12;
+    int num_nodes = 4;
+    std::vector<int> node_ids( size );
+    for (int r = 0; r < size; ++r)
+        node_ids[ r ] = r % num_nodes;
+
+    for (int radix : { 2, 4 }) {
+        for (int root : { 0, 5 }) {
+            // Participating ranks, with root first; skip rank 7.
+            std::vector<int> ranks = { root };
+            for (int r = 0; r < size; ++r) {
+                if (r != root && r != 7)
+                    ranks.push_back( r );
+            }
+            int n = ranks.size();
+
+            std::vector<int> parent( n, -1 );
+            int inter_node = 0;
+            for (int index = 0; index < n; ++index) {
+                std::list<int> recv_from, send_to;
+                slate::internal::nodeBcastPattern(
+                    ranks, node_ids, index, radix, recv_from, send_to );
+
+                test_assert( recv_from.size() == (index == 0 ? 0u : 1u) );
+                for (int dst : send_to) {
+                    test_assert( 0 < dst && dst < n );
+                    test_assert( parent[ dst ] == -1 );
+                    parent[ dst ] = index;
+                    if (node_ids[ ranks[ dst ] ] != node_ids[ ranks[ index ] ])
+                        ++inter_node;
+                }
+            }
+            // Every rank except the root is sent to, by its parent.
+            for (int index = 1; index < n; ++index) {
+                std::list<int> recv_from, send_to;
+                slate::internal::nodeBcastPattern(
+                    ranks, node_ids, index, radix, recv_from, send_to );
+                test_assert( parent[ index ] == recv_from.front() );
+            }
+            test_assert( inter_node == num_nodes - 1 );
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 /// Runs all tests. Called by unit test main().
 void run_tests()
@@ -37,6 +88,8 @@ void run_tests()
     if (mpi_rank == 0) {
         run_test(
             test_gpu_aware_mpi, "gpu_aware_mpi()");
+        run_test(
+            test_nodeBcastPattern, "internal::nodeBcastPattern");
     }
 }
 